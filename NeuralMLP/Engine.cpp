@@ -22,17 +22,71 @@ Engine::Engine(NVLib::Logger* logger, NVLib::Parameters* parameters)
 {
     _logger = logger; _parameters = parameters;
 
+    _mode = ArgUtils::GetString(parameters, "mode", "train");
+    _trainData = nullptr; _loadSeconds = 0; _loopAllocations = NVL_AI::AllocationStats();
+
     _logger->Log(1, "Loading training data");
-    auto dataPath = ArgUtils::GetString(parameters, "input");
-    _trainData = NVL_AI::NeuralUtils::LoadData(dataPath);
+    _dataPath = ArgUtils::GetString(parameters, "input");
+    if (_mode != "shards" && _mode != "distributed") LoadTrainData(_dataPath);
 
-    _logger->Log(1, "Setup the given network");
-    auto networkConfig = ArgUtils::GetString(parameters, "ann_config");
     _learnRate = ArgUtils::GetDouble(parameters, "learn_rate");
-    _network = NVL_AI::NeuralUtils::CreateNetwork(networkConfig, _learnRate, _trainData->GetInputs().cols, _trainData->GetOutputs().cols);
+    _settings = NVL_AI::NetworkSettings();
+    _settings.Backend = ArgUtils::GetString(parameters, "backend", "opencv");
+    _settings.Structure = ArgUtils::GetString(parameters, "ann_config");
+    _settings.LearnRate = _learnRate;
+    _settings.Optimizer = ArgUtils::GetString(parameters, "optimizer", "backprop");
+    _settings.Momentum = ArgUtils::GetDouble(parameters, "momentum", 0.9);
+    _settings.BatchSize = ArgUtils::GetInteger(parameters, "batch_size", 1);
+    _settings.Epochs = ArgUtils::GetInteger(parameters, "epochs", 500);
+    _settings.InputScaling = ArgUtils::GetString(parameters, "input_scaling", "standard");
+    _settings.OutputScaling = ArgUtils::GetString(parameters, "output_scaling", "minmax");
+    _settings.TrainThreads = ArgUtils::GetInteger(parameters, "train_threads", 1);
+    _settings.TrainMode = ArgUtils::GetString(parameters, "train_mode", "sync");
+    if (_settings.Backend == "native") _logger->Log(1, "Using the native backend (%s kernels, %s optimizer, batch size %i)", NVL_AI::MathKernels::GetInstructionSet().c_str(), _settings.Optimizer.c_str(), _settings.BatchSize);
+    if (_settings.Backend == "native" && _settings.TrainThreads != 1) _logger->Log(1, "Training on %i threads (%s mode)", NVL_AI::ParallelTrainer::GetWorkerCount(_settings.TrainThreads, _settings.TrainMode, _settings.BatchSize), _settings.TrainMode.c_str());
+    _scoreMetric = ArgUtils::GetString(parameters, "score_metric", "total");
+    NVL_AI::Scorer::GetLoss(NVL_AI::Score(), _scoreMetric); // Fail early on an unknown metric
     _iterations = ArgUtils::GetInteger(parameters, "iterations");
+    _patience = ArgUtils::GetInteger(parameters, "patience", 0);
+    _minImprovement = ArgUtils::GetDouble(parameters, "min_improvement", 0);
+    _targetScore = ArgUtils::GetDouble(parameters, "target_score", 1e-4);
     _outputPath = ArgUtils::GetString(parameters, "output");
 
+    if (_mode == "sweep" || _mode == "kfold" || _mode == "shards" || _mode == "distributed") return;
+    if (_mode != "train" && _mode != "follow") throw runtime_error("Unknown mode: " + _mode);
+
+    // ARFF records carry a single class, so a model with more outputs cannot follow them (checked before it is trained)
+    auto outputCount = _trainData->GetOutputs().cols;
+    if (_mode == "follow" && outputCount != 1) throw runtime_error(NVLib::Formatter() << "Follow mode reads ARFF records, which have one class column, but the model has " << outputCount << " outputs");
+
+    auto validationSplit = ArgUtils::GetDouble(parameters, "validation_split", 0);
+    if (validationSplit > 0)
+    {
+        NVL_AI::NeuralUtils::SplitData(_trainData, validationSplit, ArgUtils::GetInteger(parameters, "validation_seed", 0x5eed), _fitView, _validationView);
+        _logger->Log(1, "Holding out %i of %i rows for validation", _validationView->GetRowCount(), _trainData->GetRowCount());
+    }
+
+    _resumePath = ArgUtils::GetString(parameters, "resume_from", "");
+    if (_resumePath.empty())
+    {
+        _logger->Log(1, "Setup the given network");
+        _network = NVL_AI::NetworkFactory::Create(_settings, _trainData->GetInputs().cols, _trainData->GetOutputs().cols);
+    }
+    else
+    {
+        _logger->Log(1, "Loading the network to carry on from: %s", _resumePath.c_str());
+        _network = NVL_AI::NetworkFactory::Load(_settings, _resumePath);
+    }
+    _scorer = Ptr<NVL_AI::Scorer>(new NVL_AI::Scorer(_validationView != nullptr ? _validationView.get() : _trainData));
+    _checkpoints = Ptr<NVL_AI::CheckpointWriter>(new NVL_AI::CheckpointWriter(_outputPath));
+
+    auto metricsPath = ArgUtils::GetString(parameters, "metrics_output", "");
+    auto prometheusPath = ArgUtils::GetString(parameters, "metrics_prometheus", "");
+    if (!metricsPath.empty() || !prometheusPath.empty())
+    {
+        _metrics = Ptr<NVL_AI::TrainingMetrics>(new NVL_AI::TrainingMetrics(metricsPath, prometheusPath, ArgUtils::GetDouble(parameters, "metrics_interval", 5)));
+        _metrics->SetLoadSeconds(_loadSeconds);
+    }
 }
 
 /**
@@ -44,6 +98,43 @@ Engine::~Engine()
     if (_trainData != nullptr) delete _trainData;
 }
 
+//--------------------------------------------------
+// Data Loading
+//--------------------------------------------------
+
+/**
+ * Load the training data. A binary dataset is mapped as it is, and an ARFF file goes through the binary
+ * dataset cache unless it has been switched off
+ * @param dataPath The path to the dataset that we are loading
+ */
+void Engine::LoadTrainData(const string& dataPath)
+{
+    auto loadThreads = ArgUtils::GetInteger(_parameters, "load_threads", 0);
+
+    if (NVL_AI::DataCache::IsBinaryPath(dataPath))
+    {
+        auto start = chrono::steady_clock::now();
+        _trainData = NVL_AI::DataCache::LoadBinary(dataPath);
+        _loadSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        _logger->Log(1, "Mapped binary dataset %s: %i rows in %f seconds", dataPath.c_str(), _trainData->GetRowCount(), _loadSeconds);
+    }
+    else if (ArgUtils::GetBoolean(_parameters, "data_cache", true))
+    {
+        auto cache = NVL_AI::DataCache(dataPath, loadThreads);
+        _trainData = cache.Load();
+        auto rows = _trainData->GetInputs().rows;
+        _logger->Log(1, "%s dataset cache %s: %i rows in %f seconds", cache.IsHit() ? "Mapped" : "Created", cache.GetCachePath().c_str(), rows, cache.GetSeconds());
+        _loadSeconds = cache.GetSeconds();
+    }
+    else 
+    {
+        auto reader = NVL_AI::ArffReader(dataPath, loadThreads);
+        _trainData = reader.Read();
+        _logger->Log(1, "Loaded %i rows in %f seconds (%f rows/sec)", reader.GetRowCount(), reader.GetSeconds(), reader.GetRowsPerSecond());
+        _loadSeconds = reader.GetSeconds();
+    }
+}
+
 //--------------------------------------------------
 // Execution Entry Point
 //--------------------------------------------------
@@ -53,28 +144,466 @@ Engine::~Engine()
  */
 void Engine::Run()
 {
-    _logger->Log(1, "Initialize Training");
-    auto train = ml::TrainData::create(_trainData->GetInputs(), ml::ROW_SAMPLE, _trainData->GetOutputs());
-	_network->train(train);
+    if (_mode == "sweep") { RunSweep(); return; }
+    if (_mode == "kfold") { RunFolds(); return; }
+    if (_mode == "shards") { RunShards(); return; }
+    if (_mode == "distributed") { RunDistributed(); return; }
+
+    auto fitData = _fitView != nullptr ? _fitView.get() : _trainData;
+    auto scoreName = string(_validationView != nullptr ? "validation " : "") + _scoreMetric;
+
+    auto start = chrono::steady_clock::now();
+    if (_resumePath.empty())
+    {
+        _logger->Log(1, "Initialize Training");
+        _network->Train(fitData, false);
+        if (_network->GetCopyBytes() > 0) _logger->Log(1, "Training on a scaled copy of the data, which holds %i MB on top of it", (int) (_network->GetCopyBytes() >> 20));
+    }
 
 	_logger->Log(1, "Starting training");
-	auto bestScore = NVL_AI::NeuralUtils::GetScore(_trainData, _network);
-    _logger->Log(1, "Initial Score: %f", bestScore);
-    for (auto i = 0; i < _iterations; i++) 
+    auto stopping = NVL_AI::EarlyStopping(_patience, _minImprovement, _targetScore);
+    auto first = GetResumeIteration(fitData, stopping);
+    if (first == 0) stopping.Update(-1, NVL_AI::Scorer::GetLoss(_scorer->Evaluate(_network), _scoreMetric));
+    _logger->Log(1, "Initial Score (%s): %f", scoreName.c_str(), stopping.GetBestScore());
+
+    auto iteration = first; auto metrics = NVL_AI::IterationMetrics(); _loopAllocations = NVL_AI::AllocationStats();
+    _checkpoints->SetRun(_scoreMetric, _dataPath, fitData->GetRowCount());
+    while (iteration < _iterations && !stopping.IsStopped())
 	{
-		_network->train(train,  ml::ANN_MLP::UPDATE_WEIGHTS);
-		auto current = NVL_AI::NeuralUtils::GetScore(_trainData, _network);
-		_logger->Log(1, "Iteration %i: %f", i, current);
+        auto phaseStart = chrono::steady_clock::now(); auto allocationStart = NVL_AI::AllocationCounter::GetStats();
+		_network->Train(fitData, true);
+        auto trainEnd = chrono::steady_clock::now();
+		auto score = _scorer->Evaluate(_network);
+		auto current = NVL_AI::Scorer::GetLoss(score, _scoreMetric);
+        auto scoreEnd = chrono::steady_clock::now(); auto allocations = NVL_AI::AllocationCounter::GetChange(allocationStart);
+		_logger->Log(1, "Iteration %i: %f (mae: %f, rmse: %f, max: %f, r2: %f)", iteration, current, score.MAE, score.RMSE, score.MaxError, score.R2);
 
-        if (current < bestScore) 
+        // The state records the last completed iteration as well as the best one, so it is updated every iteration
+        // (which is counted with the training and scoring); only a new best model is copied into a snapshot
+        auto improved = stopping.Update(iteration, current);
+        if (improved) 
         {
             _logger->Log(1, "Best result so far, saving");
-            NVL_AI::NeuralUtils::Save(_outputPath, _network);
-            bestScore = current;
-            if (bestScore < 1e-4) 
+            _checkpoints->Submit(_network->GetModel(), iteration, stopping.GetBestIteration(), stopping.GetBestScore());
+        }
+        else
+        {
+            auto updateStart = NVL_AI::AllocationCounter::GetStats();
+            _checkpoints->Update(iteration, stopping.GetBestIteration(), stopping.GetBestScore());
+            auto change = NVL_AI::AllocationCounter::GetChange(updateStart); allocations.Count += change.Count; allocations.Bytes += change.Bytes;
+        }
+        if (iteration > first) { _loopAllocations.Count += allocations.Count; _loopAllocations.Bytes += allocations.Bytes; }
+
+        if (_metrics != nullptr)
+        {
+            metrics.Iteration = iteration; metrics.Score = current;
+            metrics.Samples = (long) fitData->GetRowCount() * _network->GetEpochs();
+            metrics.TrainSeconds = chrono::duration<double>(trainEnd - phaseStart).count();
+            metrics.ScoreSeconds = chrono::duration<double>(scoreEnd - trainEnd).count();
+            metrics.CheckpointSeconds = chrono::duration<double>(chrono::steady_clock::now() - scoreEnd).count();
+            metrics.Allocations = allocations.Count; metrics.AllocatedBytes = allocations.Bytes;
+            _metrics->SetCheckpointStats(_checkpoints->GetWriteCount(), _checkpoints->GetLastWriteSeconds(), _checkpoints->GetWriteSeconds());
+            _metrics->Record(metrics);
+        }
+        iteration++;
+	}
+
+    // Estimate the time saved from the average time of the iterations that did run
+    auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    auto skipped = _iterations - iteration;
+    if (stopping.IsStopped()) _logger->Log(1, "Terminating after %i of %i iterations: %s", iteration, _iterations, stopping.GetReason().c_str());
+    _logger->Log(1, "Best %s: %f at iteration %i. Saved %i iterations (about %f seconds) against the full budget", scoreName.c_str(), stopping.GetBestScore(), stopping.GetBestIteration(), skipped, iteration > first ? skipped * seconds / (iteration - first) : 0.0);
+
+    // The first iteration warms up the buffers, so the allocations after it show whether the loop is allocation free
+    auto warmIterations = max(1, iteration - first - 1);
+    _logger->Log(1, "Heap allocations while training, scoring and updating the checkpoint state: %f per iteration after the first (%f bytes); %i by the background threads", (double) _loopAllocations.Count / warmIterations, (double) _loopAllocations.Bytes / warmIterations, (int) NVL_AI::AllocationCounter::GetBackgroundStats().Count);
+
+    _checkpoints->Flush();
+    _logger->Log(1, "Checkpoints written: %i (skipped %i that were replaced before they were written)", _checkpoints->GetWriteCount(), _checkpoints->GetSkipCount());
+
+    if (_metrics != nullptr)
+    {
+        _metrics->SetCheckpointStats(_checkpoints->GetWriteCount(), _checkpoints->GetLastWriteSeconds(), _checkpoints->GetWriteSeconds());
+        _metrics->Export();
+        _logger->Log(1, "Time by phase: load %f, train %f, score %f, checkpoint %f seconds (peak memory %i MB)", _loadSeconds, _metrics->GetTrainSeconds(), _metrics->GetScoreSeconds(), _metrics->GetCheckpointSeconds(), (int) (NVL_AI::TrainingMetrics::GetPeakMemory() >> 20));
+    }
+
+    if (_mode == "follow") RunFollow(fitData, max(0, iteration - 1));
+}
+
+/**
+ * Work out where a resumed run carries on from. The state saved beside the checkpoint restores the best score and
+ * the iteration counter (from the last iteration that completed, which may be well after the best one that the
+ * checkpoint holds), but only when it belongs to the same data and metric; a model that is loaded without a
+ * matching state is fine-tuned from iteration 0, against its score on the data it is given now.
+ * @param fitData The data that we are training on
+ * @param stopping The early stopping rule, which is given the best score so far
+ * @return The first iteration to run
+ */
+int Engine::GetResumeIteration(NVL_AI::TrainData * fitData, NVL_AI::EarlyStopping& stopping)
+{
+    if (_resumePath.empty()) return 0;
+
+    auto state = NVL_AI::CheckpointState();
+    auto found = NVL_AI::CheckpointWriter::ReadState(NVL_AI::CheckpointWriter::GetStatePath(_resumePath), state);
+
+    if (!found || state.Data != _dataPath || state.Rows != fitData->GetRowCount() || state.Metric != _scoreMetric)
+    {
+        _logger->Log(1, "No saved state matches this data, so the loaded network is fine-tuned from iteration 0");
+        return 0;
+    }
+
+    stopping.Update(state.BestIteration, state.Score);
+    _logger->Log(1, "Resuming after iteration %i with a best %s of %f from iteration %i (%i iterations left)", state.Iteration, _scoreMetric.c_str(), state.Score, state.BestIteration, max(0, _iterations - state.Iteration - 1));
+    return state.Iteration + 1;
+}
+
+//--------------------------------------------------
+// Sweep
+//--------------------------------------------------
+
+/**
+ * Train a grid of structures, learning rates and iteration budgets side by side on the one dataset,
+ * cutting the losing trials by successive halving, and save the winner. The trials are ranked on the
+ * sweep_validation_split share of the rows, which none of them train on.
+ */
+void Engine::RunSweep()
+{
+    auto sweep = NVL_AI::SweepSettings();
+    sweep.Base = _settings; sweep.Metric = _scoreMetric;
+    sweep.Structures = NVL_AI::Sweeper::ParseList(ArgUtils::GetString(_parameters, "sweep_structures", _settings.Structure));
+    sweep.LearnRates = _parameters->Contains("sweep_learn_rates") ? NVL_AI::Sweeper::ParseValues(ArgUtils::GetString(_parameters, "sweep_learn_rates")) : vector<double> { _learnRate };
+    auto budgets = _parameters->Contains("sweep_iterations") ? NVL_AI::Sweeper::ParseValues(ArgUtils::GetString(_parameters, "sweep_iterations")) : vector<double> { (double)_iterations };
+    for (auto budget : budgets) sweep.Budgets.push_back((int) round(budget));
+    sweep.MinIterations = ArgUtils::GetInteger(_parameters, "sweep_min_iterations", 10);
+    sweep.Eta = ArgUtils::GetInteger(_parameters, "sweep_eta", 3);
+    sweep.ThreadCount = ArgUtils::GetInteger(_parameters, "sweep_threads", 0);
+    sweep.ValidationSplit = ArgUtils::GetDouble(_parameters, "sweep_validation_split", 0.2);
+    sweep.ValidationSeed = ArgUtils::GetInteger(_parameters, "validation_seed", 0x5eed);
+
+    auto sweeper = NVL_AI::Sweeper(_trainData, sweep);
+    _logger->Log(1, "Starting a sweep of %i trials, ranked on %i %s rows", (int) sweeper.GetTrials().size(), sweeper.GetValidationData()->GetRowCount(), sweep.ValidationSplit > 0 ? "held out" : "training");
+    auto leaderboard = sweeper.Run();
+    _logger->Log(1, "Sweep finished after %i rungs (%i tasks stolen between workers)", sweeper.GetRungCount(), sweeper.GetStealCount());
+
+    auto leaderboardPath = ArgUtils::GetString(_parameters, "sweep_leaderboard", "Output/leaderboard.csv");
+    auto writer = ofstream(leaderboardPath);
+    if (!writer.is_open()) throw runtime_error("Unable to open the leaderboard file: " + leaderboardPath);
+    writer << "rank,structure,learn_rate,budget,iterations,score,status,seconds" << endl;
+
+    for (auto i = 0; i < (int) leaderboard.size(); i++)
+    {
+        auto& trial = leaderboard[i];
+        auto status = string(i == 0 ? "winner" : "finished");
+        if (i > 0 && trial->CutRung >= 0) status = NVLib::Formatter() << "cut at rung " << trial->CutRung;
+        _logger->Log(1, "%i. [%s] lr %f, %i/%i iterations: %f (%s, %f seconds)", i + 1, trial->Settings.Structure.c_str(), trial->Settings.LearnRate, trial->Iterations, trial->Budget, trial->BestScore, status.c_str(), trial->Seconds);
+        writer << (i + 1) << ",\"" << trial->Settings.Structure << "\"," << trial->Settings.LearnRate << "," << trial->Budget << "," << trial->Iterations << "," << trial->BestScore << "," << status << "," << trial->Seconds << endl;
+    }
+
+    _logger->Log(1, "Leaderboard written to %s", leaderboardPath.c_str());
+
+    NVL_AI::NeuralUtils::SaveModel(_outputPath, *leaderboard[0]->BestModel, NVL_AI::ModelFile::IsBinaryPath(_outputPath));
+    _logger->Log(1, "Winning model saved to %s", _outputPath.c_str());
+}
+
+//--------------------------------------------------
+// Cross Validation
+//--------------------------------------------------
+
+/**
+ * Run k-fold cross validation, training the folds side by side on views of the one dataset,
+ * and report the held out score of each fold and their mean and spread
+ */
+void Engine::RunFolds()
+{
+    auto foldCount = ArgUtils::GetInteger(_parameters, "kfold_folds", 5);
+    auto iterations = ArgUtils::GetInteger(_parameters, "kfold_iterations", _iterations);
+    auto threadCount = ArgUtils::GetInteger(_parameters, "kfold_threads", 0);
+
+    auto validator = NVL_AI::CrossValidator(_trainData, _settings, foldCount, iterations, threadCount);
+    _logger->Log(1, "Starting %i-fold cross validation (%i iterations per fold)", foldCount, iterations);
+    auto results = validator.Run();
+
+    for (auto& fold : results)
+    {
+        auto& score = fold.TestScore;
+        _logger->Log(1, "Fold %i: %i train rows, %i test rows, %f seconds", fold.Fold, fold.TrainRows, fold.TestRows, fold.Seconds);
+        _logger->Log(1, "Fold %i: train %s %f, test mae: %f, rmse: %f, max: %f, r2: %f", fold.Fold, _scoreMetric.c_str(), NVL_AI::Scorer::GetLoss(fold.TrainScore, _scoreMetric), score.MAE, score.RMSE, score.MaxError, score.R2);
+    }
+
+    auto mean = NVL_AI::CrossValidator::GetMean(results); auto deviation = NVL_AI::CrossValidator::GetDeviation(results);
+    _logger->Log(1, "Mean over %i folds: mae %f (+/- %f), rmse %f (+/- %f), max %f (+/- %f), r2 %f (+/- %f)", foldCount, mean.MAE, deviation.MAE, mean.RMSE, deviation.RMSE, mean.MaxError, deviation.MaxError, mean.R2, deviation.R2);
+}
+
+//--------------------------------------------------
+// Out-of-core
+//--------------------------------------------------
+
+/**
+ * Train on a dataset that does not fit in memory. The binary form of the dataset is streamed through a ring of
+ * shard buffers (loaded in the background, in a new order each pass), so memory is set by shard_memory_mb rather
+ * than by the dataset. Each iteration makes one pass over every shard, so no shard is fitted on its own before the
+ * next one is seen. Scores come from an evenly spaced sample of rows.
+ */
+void Engine::RunShards()
+{
+    auto path = _dataPath;
+    if (!NVL_AI::DataCache::IsBinaryPath(path))
+    {
+        // An ARFF file is streamed into its cache a batch at a time, which is then read like any binary dataset
+        auto cache = NVL_AI::DataCache(path, ArgUtils::GetInteger(_parameters, "load_threads", 0));
+        cache.Stream(ArgUtils::GetInteger(_parameters, "shard_parse_rows", 65536)); path = cache.GetCachePath();
+        _logger->Log(1, "%s dataset cache %s in %f seconds", cache.IsHit() ? "Found" : "Created", path.c_str(), cache.GetSeconds());
+    }
+
+    auto memory = (uint64_t) ArgUtils::GetInteger(_parameters, "shard_memory_mb", 256) << 20;
+    auto reader = NVL_AI::ShardReader(path, memory, ArgUtils::GetInteger(_parameters, "shard_buffers", 2), ArgUtils::GetInteger(_parameters, "shard_seed", 0x5eed));
+    _logger->Log(1, "Streaming %i rows as %i shards of %i rows through %i buffers", (int) reader.GetRowCount(), reader.GetShardCount(), reader.GetShardRows(), reader.GetBufferCount());
+
+    auto sample = Ptr<NVL_AI::TrainData>(reader.ReadSample(ArgUtils::GetInteger(_parameters, "shard_score_rows", reader.GetShardRows())));
+    auto scorer = NVL_AI::Scorer(sample.get());
+    auto checkpoints = NVL_AI::CheckpointWriter(_outputPath);
+    auto settings = _settings; settings.Epochs = 1;
+    auto network = NVL_AI::NetworkFactory::Create(settings, reader.GetInputCount(), reader.GetOutputCount());
+
+    _logger->Log(1, "Starting training");
+    auto stopping = NVL_AI::EarlyStopping(_patience, _minImprovement, _targetScore);
+    auto started = false; auto iteration = 0;
+
+    while (iteration < _iterations && !stopping.IsStopped())
+    {
+        auto start = chrono::steady_clock::now();
+
+        reader.StartEpoch();
+        for (auto shard = reader.Next(); shard != nullptr; shard = reader.Next())
+        {
+            network->Train(shard.get(), started); started = true;
+        }
+
+        auto score = scorer.Evaluate(network);
+        auto current = NVL_AI::Scorer::GetLoss(score, _scoreMetric);
+        auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        _logger->Log(1, "Iteration %i: %f (mae: %f, rmse: %f, max: %f, r2: %f) in %f seconds", iteration, current, score.MAE, score.RMSE, score.MaxError, score.R2, seconds);
+
+        if (stopping.Update(iteration, current))
+        {
+            _logger->Log(1, "Best result so far, saving");
+            checkpoints.Submit(network->GetModel());
+        }
+        iteration++;
+    }
+
+    if (stopping.IsStopped()) _logger->Log(1, "Terminating after %i of %i iterations: %s", iteration, _iterations, stopping.GetReason().c_str());
+    _logger->Log(1, "Best sample %s: %f at iteration %i", _scoreMetric.c_str(), stopping.GetBestScore(), stopping.GetBestIteration());
+
+    checkpoints.Flush();
+    _logger->Log(1, "Peak memory %i MB", (int) (NVL_AI::TrainingMetrics::GetPeakMemory() >> 20));
+}
+
+//--------------------------------------------------
+// Distributed
+//--------------------------------------------------
+
+/**
+ * Train one network across several worker processes, each on its own block of rows. The workers train on their own
+ * for distributed_sync iterations at a time and then average their weights, so that they all hold the same network
+ * after each sync. This process starts distributed_launch of the workers itself (as forks, numbered up from
+ * distributed_rank), so one launch can run the whole job on one machine while a job across machines starts a share
+ * of the workers on each. Each worker maps the binary form of the dataset (an ARFF input is streamed into its cache
+ * first) and only reads its own block of rows. The first worker scores the network on the whole mapped dataset,
+ * decides when to stop and writes the checkpoints.
+ */
+void Engine::RunDistributed()
+{
+    if (_settings.Backend != "native") throw runtime_error("Distributed training needs the native backend");
+
+    auto workers = ArgUtils::GetInteger(_parameters, "distributed_workers", 2);
+    auto rank = ArgUtils::GetInteger(_parameters, "distributed_rank", 0);
+    auto launch = ArgUtils::GetInteger(_parameters, "distributed_launch", workers - rank);
+    if (launch < 1 || rank + launch > workers) throw runtime_error(NVLib::Formatter() << "Unable to launch workers " << rank << " to " << rank + launch - 1 << " of " << workers);
+
+    // An ARFF file is streamed into its cache once per launch (before the workers start), so that the workers can map it
+    auto path = _dataPath;
+    if (!NVL_AI::DataCache::IsBinaryPath(path))
+    {
+        auto cache = NVL_AI::DataCache(path, ArgUtils::GetInteger(_parameters, "load_threads", 0));
+        cache.Stream(); path = cache.GetCachePath();
+        _logger->Log(1, "%s dataset cache %s in %f seconds", cache.IsHit() ? "Found" : "Created", path.c_str(), cache.GetSeconds());
+    }
+
+    // The segment name and job id are settled before the fork, so that the local workers share them. Left to itself a
+    // launch names its segment after its own process id and picks a random job id, so no worker can join a segment
+    // that a crashed run or another job left behind; a shared memory job started by several launches names both.
+    auto type = ArgUtils::GetString(_parameters, "distributed_transport", "shm");
+    auto address = ArgUtils::GetString(_parameters, "distributed_address", "");
+    auto jobText = ArgUtils::GetString(_parameters, "distributed_job", "");
+    if (type == "shm" && launch < workers && (address.empty() || jobText.empty())) throw runtime_error("A shared memory job started by several launches needs distributed_address and distributed_job");
+
+    if (address.empty()) address = type == "tcp" ? string("127.0.0.1:5757") : string(NVLib::Formatter() << "/neuralmlp_" << getpid());
+    auto job = jobText.empty() ? ((uint64_t) random_device()() << 32) | random_device()() : (uint64_t) stoull(jobText);
+
+    // Start the other local workers
+    auto children = vector<pid_t>(); cout << flush;
+    for (auto i = 1; i < launch; i++)
+    {
+        auto child = fork();
+        if (child < 0) throw runtime_error("Unable to start a worker process");
+        if (child == 0) { rank += i; children.clear(); break; }
+        children.push_back(child);
+    }
+
+    auto trainer = NVL_AI::DistributedTrainer(NVL_AI::Transport::Create(type, address, rank, workers, ArgUtils::GetDouble(_parameters, "distributed_timeout", 60), job));
+    auto partition = Ptr<NVL_AI::TrainData>(trainer.LoadPartition(path));
+    _logger->Log(1, "Worker %i of %i joined over %s with %i rows", rank, workers, type.c_str(), partition->GetRowCount());
+
+    auto network = NVL_AI::NetworkFactory::Create(_settings, partition->GetInputs().cols, partition->GetOutputs().cols);
+    auto native = dynamic_cast<NVL_AI::NativeNetwork *>(network.get());
+    auto syncEvery = max(1, ArgUtils::GetInteger(_parameters, "distributed_sync", 1));
+    auto leader = rank == 0;
+
+    auto scoreData = leader ? Ptr<NVL_AI::TrainData>(NVL_AI::DataCache::LoadBinary(path)) : partition;
+    auto scorer = NVL_AI::Scorer(scoreData.get());
+    auto checkpoints = leader ? Ptr<NVL_AI::CheckpointWriter>(new NVL_AI::CheckpointWriter(_outputPath)) : nullptr;
+    auto stopping = NVL_AI::EarlyStopping(_patience, _minImprovement, _targetScore);
+    auto start = chrono::steady_clock::now();
+
+    network->Train(partition.get(), false); trainer.Average(*native);
+    if (leader) stopping.Update(-1, NVL_AI::Scorer::GetLoss(scorer.Evaluate(network), _scoreMetric));
+    if (leader) _logger->Log(1, "Initial Score (%s): %f", _scoreMetric.c_str(), stopping.GetBestScore());
+
+    auto iteration = 0;
+    while (iteration < _iterations)
+    {
+        for (auto i = 0; i < syncEvery && iteration < _iterations; i++, iteration++) network->Train(partition.get(), true);
+        trainer.Average(*native);
+
+        if (leader)
+        {
+            auto score = scorer.Evaluate(network);
+            auto current = NVL_AI::Scorer::GetLoss(score, _scoreMetric);
+            _logger->Log(1, "Iteration %i: %f (mae: %f, rmse: %f, max: %f, r2: %f)", iteration - 1, current, score.MAE, score.RMSE, score.MaxError, score.R2);
+
+            if (stopping.Update(iteration - 1, current))
             {
-                _logger->Log(1, "Low score found, terminating!");
+                _logger->Log(1, "Best result so far, saving");
+                checkpoints->Submit(network->GetModel());
             }
         }
-	}
-}
\ No newline at end of file
+
+        if (trainer.Agree(leader && stopping.IsStopped())) break;
+    }
+
+    if (leader)
+    {
+        auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (stopping.IsStopped()) _logger->Log(1, "Terminating after %i of %i iterations: %s", iteration, _iterations, stopping.GetReason().c_str());
+        _logger->Log(1, "Best %s: %f at iteration %i", _scoreMetric.c_str(), stopping.GetBestScore(), stopping.GetBestIteration());
+        _logger->Log(1, "%i syncs took %f of %f seconds", trainer.GetSyncCount(), trainer.GetSyncSeconds(), seconds);
+        checkpoints->Flush();
+    }
+
+    // Wait for the local workers, failing if any of them did
+    auto failed = 0;
+    for (auto child : children)
+    {
+        auto status = 0; waitpid(child, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) failed++;
+    }
+    if (failed > 0) throw runtime_error(NVLib::Formatter() << failed << " of the worker processes failed");
+}
+
+//--------------------------------------------------
+// Follow
+//--------------------------------------------------
+
+/**
+ * Keep training on the records that are appended to the input (or that arrive on follow_source, which may be a pipe
+ * or "-" for stdin) once the normal training is done. New records are taken in micro-batches of follow_batch_rows,
+ * each mixed with follow_replay_ratio times as many older rows from a bounded replay buffer, and the network makes
+ * one pass over them (its epoch limit is dropped to 1 for this). Each batch is scored before it is trained on, so the
+ * log reports how the network does on data it has not seen. The network is saved every follow_checkpoint_rows rows or
+ * follow_checkpoint_seconds seconds, whichever comes first. The run ends when a stream closes, after follow_idle_seconds without new records, or after
+ * follow_max_rows records (a limit of 0 switches either of these off).
+ * @param fitData The data that the network was trained on, which seeds the replay buffer
+ * @param iteration The last iteration of the training that came before, which the checkpoints record
+ */
+void Engine::RunFollow(NVL_AI::TrainData * fitData, int iteration)
+{
+    auto source = ArgUtils::GetString(_parameters, "follow_source", "");
+    if (source.empty()) source = _dataPath;
+    if (source == _dataPath && NVL_AI::DataCache::IsBinaryPath(source)) throw runtime_error("Follow mode reads ARFF records, so it cannot follow a binary dataset: " + source);
+
+    auto inputCount = _trainData->GetInputs().cols; auto outputCount = _trainData->GetOutputs().cols;
+
+    // When the input is followed, the records that were loaded at the start are skipped rather than trained on again
+    auto follower = NVL_AI::ArffFollower(source, inputCount, source == _dataPath ? _trainData->GetRowCount() : 0);
+
+    auto batchRows = max(1, ArgUtils::GetInteger(_parameters, "follow_batch_rows", 256));
+    auto replayRatio = max(0.0, ArgUtils::GetDouble(_parameters, "follow_replay_ratio", 1));
+    auto replay = NVL_AI::ReplayBuffer(ArgUtils::GetInteger(_parameters, "follow_replay_rows", 10000), inputCount, outputCount, ArgUtils::GetInteger(_parameters, "follow_seed", 0x5eed));
+    replay.Add(fitData);
+
+    auto pollMs = ArgUtils::GetInteger(_parameters, "follow_poll_ms", 200);
+    auto checkpointRows = ArgUtils::GetInteger(_parameters, "follow_checkpoint_rows", 10000);
+    auto checkpointSeconds = ArgUtils::GetDouble(_parameters, "follow_checkpoint_seconds", 30);
+    auto maxRows = ArgUtils::GetInteger(_parameters, "follow_max_rows", 0);
+    auto idleSeconds = ArgUtils::GetDouble(_parameters, "follow_idle_seconds", 0);
+
+    _logger->Log(1, "Following %s in batches of %i rows (replaying %f older rows per new row from %i kept)", source.c_str(), batchRows, replayRatio, replay.GetSize());
+
+    auto capacity = batchRows + (int) ceil(batchRows * replayRatio);
+    Mat inputs = Mat_<float>(capacity, inputCount); Mat outputs = Mat_<float>(capacity, outputCount); Mat predictions;
+
+    // Each micro-batch is a small incremental update, not a fit to the full epoch budget
+    _network->SetMaxEpochs(1);
+
+    auto start = chrono::steady_clock::now(); auto lastSave = start; auto lastRow = start;
+    auto trained = 0; auto unsaved = 0; auto steps = 0; auto errorSum = 0.0;
+
+    auto save = [&]()
+    {
+        auto mae = errorSum / unsaved;
+        auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        _logger->Log(1, "Followed %i rows (%i bad) in %i steps: %f rows/sec, mae on unseen rows %f since the last save", trained, follower.GetBadCount(), steps, seconds > 0 ? trained / seconds : 0.0, mae);
+
+        _checkpoints->SetRun("follow_mae", source, fitData->GetRowCount() + trained);
+        _checkpoints->Submit(_network->GetModel(), iteration, iteration, mae);
+        unsaved = 0; errorSum = 0; lastSave = chrono::steady_clock::now();
+    };
+
+    while (maxRows == 0 || trained < maxRows)
+    {
+        if (follower.GetPendingRows() == 0) follower.Poll(pollMs);
+
+        auto limit = maxRows == 0 ? batchRows : min(batchRows, maxRows - trained);
+        Mat newInputs = inputs.rowRange(0, limit); Mat newOutputs = outputs.rowRange(0, limit);
+        auto rows = follower.Take(newInputs, newOutputs);
+        auto now = chrono::steady_clock::now();
+
+        if (rows > 0)
+        {
+            // Test then train: the new rows are scored before the network has seen them
+            _network->Predict(inputs.rowRange(0, rows), predictions);
+            for (auto row = 0; row < rows; row++) for (auto column = 0; column < outputCount; column++) errorSum += abs(predictions.at<float>(row, column) - outputs.at<float>(row, column)) / outputCount;
+
+            auto replayed = replay.Sample((int) round(rows * replayRatio), inputs, outputs, rows);
+            Mat batchInputs = inputs.rowRange(0, rows + replayed); Mat batchOutputs = outputs.rowRange(0, rows + replayed);
+            auto batch = NVL_AI::TrainData(batchInputs, batchOutputs);
+            _network->Train(&batch, true);
+
+            replay.Add(inputs, outputs, rows);
+            trained += rows; unsaved += rows; steps++; lastRow = now;
+        }
+
+        auto saveDue = (checkpointRows > 0 && unsaved >= checkpointRows) || (checkpointSeconds > 0 && chrono::duration<double>(now - lastSave).count() >= checkpointSeconds);
+        if (unsaved > 0 && saveDue) save();
+
+        if (rows > 0) continue;
+        if (follower.IsClosed()) { _logger->Log(1, "The followed source has closed"); break; }
+        if (idleSeconds > 0 && chrono::duration<double>(now - lastRow).count() >= idleSeconds) { _logger->Log(1, "No new rows for %f seconds", idleSeconds); break; }
+    }
+
+    if (unsaved > 0) save();
+    _checkpoints->Flush();
+    _logger->Log(1, "Follow mode trained on %i new rows (dropped %i bad rows); checkpoints written: %i", trained, follower.GetBadCount(), _checkpoints->GetWriteCount());
+}
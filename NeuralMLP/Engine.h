@@ -8,13 +8,31 @@
 
 #pragma once
 
+#include <chrono>
+#include <random>
 #include <iostream>
 using namespace std;
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include <NVLib/Logger.h>
 
 #include <NeuralMLPLib/ArgUtils.h>
+#include <NeuralMLPLib/DataCache.h>
 #include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/MathKernels.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/CheckpointWriter.h>
+#include <NeuralMLPLib/EarlyStopping.h>
+#include <NeuralMLPLib/TrainingMetrics.h>
+#include <NeuralMLPLib/AllocationCounter.h>
+#include <NeuralMLPLib/Sweeper.h>
+#include <NeuralMLPLib/CrossValidator.h>
+#include <NeuralMLPLib/ShardReader.h>
+#include <NeuralMLPLib/DistributedTrainer.h>
+#include <NeuralMLPLib/ArffFollower.h>
+#include <NeuralMLPLib/ReplayBuffer.h>
 
 namespace NVL_App
 {
@@ -25,14 +43,39 @@ namespace NVL_App
 		NVLib::Logger* _logger;
 
 		NVL_AI::TrainData * _trainData;
-		Ptr<ml::ANN_MLP> _network;
+		Ptr<NVL_AI::TrainData> _fitView;
+		Ptr<NVL_AI::TrainData> _validationView;
+		NVL_AI::NetworkSettings _settings;
+		string _mode;
+		string _dataPath;
+		Ptr<NVL_AI::Network> _network;
+		Ptr<NVL_AI::Scorer> _scorer;
+		string _scoreMetric;
+		Ptr<NVL_AI::CheckpointWriter> _checkpoints;
+		Ptr<NVL_AI::TrainingMetrics> _metrics;
+		double _loadSeconds;
 		int _iterations;
+		int _patience;
+		double _minImprovement;
+		double _targetScore;
 		string _outputPath;
+		string _resumePath;
 		double _learnRate;
+		NVL_AI::AllocationStats _loopAllocations;
 	public:
 		Engine(NVLib::Logger* logger, NVLib::Parameters * parameters);
 		~Engine();
 
 		void Run();
+
+		inline NVL_AI::AllocationStats& GetLoopAllocations() { return _loopAllocations; }
+	private:
+		void LoadTrainData(const string& dataPath);
+		int GetResumeIteration(NVL_AI::TrainData * fitData, NVL_AI::EarlyStopping& stopping);
+		void RunSweep();
+		void RunFolds();
+		void RunShards();
+		void RunDistributed();
+		void RunFollow(NVL_AI::TrainData * fitData, int iteration);
 	};
 }
@@ -0,0 +1,92 @@
+//--------------------------------------------------
+// Benchmarks comparing the generated fixed-topology predictor with the runtime networks
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+
+// Generated at build time by NeuralMLPCodeGen from BENCHMARK_MODEL
+#include <BenchmarkPredictor.h>
+
+//--------------------------------------------------
+// Benchmark Helpers
+//--------------------------------------------------
+
+Mat CreateRow();
+
+//--------------------------------------------------
+// Benchmark Methods
+//--------------------------------------------------
+
+/**
+ * @brief Time a single row through the generated predictor
+ */
+static void BM_CodeGen_Generated(benchmark::State& state)
+{
+	auto row = CreateRow(); float output[NVL_Generated::BenchmarkPredictor::OutputCount];
+
+	for (auto _ : state)
+	{
+		NVL_Generated::BenchmarkPredictor::Predict(row.ptr<float>(), output);
+		benchmark::DoNotOptimize(output); benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CodeGen_Generated)->Unit(benchmark::kNanosecond);
+
+/**
+ * @brief Time a single row through ANN_MLP::predict with the same model
+ */
+static void BM_CodeGen_AnnPredict(benchmark::State& state)
+{
+	auto network = NVL_AI::NeuralUtils::LoadNetwork(BENCHMARK_MODEL);
+	auto row = CreateRow(); Mat output;
+
+	for (auto _ : state)
+	{
+		network->predict(row, output);
+		benchmark::DoNotOptimize(output.data);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CodeGen_AnnPredict)->Unit(benchmark::kNanosecond);
+
+/**
+ * @brief Time a single row through the native backend with the same model
+ */
+static void BM_CodeGen_NativePredict(benchmark::State& state)
+{
+	auto network = NVL_AI::NetworkFactory::Load("native", BENCHMARK_MODEL, 1);
+	auto row = CreateRow(); Mat output;
+
+	for (auto _ : state)
+	{
+		network->Predict(row, output);
+		benchmark::DoNotOptimize(output.data);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CodeGen_NativePredict)->Unit(benchmark::kNanosecond);
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a single row of inputs in the range of problem.arff
+ * @return Mat The resultant row
+ */
+Mat CreateRow()
+{
+	Mat result = Mat_<float>(1, (int) NVL_Generated::BenchmarkPredictor::InputCount); randu(result, 0, 100);
+	return result;
+}
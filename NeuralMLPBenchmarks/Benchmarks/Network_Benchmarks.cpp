@@ -0,0 +1,129 @@
+//--------------------------------------------------
+// Benchmarks comparing the network backends
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/QuantizedNetwork.h>
+
+//--------------------------------------------------
+// Benchmark Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateData(int rows);
+Ptr<NVL_AI::ModelData> CreateModel(int width);
+string GetBackend(const benchmark::State& state);
+
+//--------------------------------------------------
+// Benchmark Methods
+//--------------------------------------------------
+
+/**
+ * @brief Time a single train(UPDATE_WEIGHTS) step of the 60,60,60 network in config.xml
+ */
+static void BM_Network_Train(benchmark::State& state)
+{
+	auto data = CreateData(state.range(1));
+	auto network = NVL_AI::NetworkFactory::Create(GetBackend(state), "60,60,60", 0.01, 3);
+	network->Train(data, false);
+
+	for (auto _ : state) network->Train(data, true);
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_Network_Train)->ArgNames({ "native", "rows" })->Args({ 0, 256 })->Args({ 1, 256 })->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Time prediction with the 60,60,60 network in config.xml
+ */
+static void BM_Network_Predict(benchmark::State& state)
+{
+	auto data = CreateData(state.range(1));
+	auto network = NVL_AI::NetworkFactory::Create(GetBackend(state), "60,60,60", 0.01, 3);
+	network->Train(data, false);
+
+	Mat outputs;
+	for (auto _ : state) network->Predict(data->GetInputs(), outputs);
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_Network_Predict)->ArgNames({ "native", "rows" })->Args({ 0, 100000 })->Args({ 1, 100000 })->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Time prediction with three hidden layers of the given width, on the native backend and quantized to INT8
+ */
+static void BM_Network_QuantizedPredict(benchmark::State& state)
+{
+	auto data = CreateData(10000); auto model = CreateModel((int) state.range(1));
+	auto network = state.range(0) == 1 ? Ptr<NVL_AI::Network>(new NVL_AI::QuantizedNetwork(model, data)) : Ptr<NVL_AI::Network>(new NVL_AI::NativeNetwork(*model));
+
+	Mat outputs;
+	for (auto _ : state) network->Predict(data->GetInputs(), outputs);
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_Network_QuantizedPredict)->ArgNames({ "int8", "width" })->ArgsProduct({ { 0, 1 }, { 60, 256, 1024 } })->Unit(benchmark::kMillisecond);
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a dataset in the style of problem.arff, with the class as (p[0] * p[1]) - p[2]
+ * @param rows The number of rows to create
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateData(int rows)
+{
+	Mat inputs = Mat_<float>(rows, 3); randu(inputs, 0, 100);
+	Mat outputs = Mat_<float>(rows, 1);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto p = inputs.ptr<float>(row);
+		outputs.at<float>(row) = (p[0] * p[1]) - p[2];
+	}
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
+
+/**
+ * @brief Create an untrained model with three hidden layers of the same width, random weights and the input scaling
+ * of problem.arff (training a wide network first would take longer than the benchmark itself)
+ * @param width The width of the hidden layers
+ * @return Ptr<NVL_AI::ModelData> The resultant model
+ */
+Ptr<NVL_AI::ModelData> CreateModel(int width)
+{
+	auto result = Ptr<NVL_AI::ModelData>(new NVL_AI::ModelData(vector<int> { 3, width, width, width, 1 }, 0.01));
+
+	for (auto layer = 1; layer < result->GetLayerCount(); layer++)
+	{
+		auto limit = 2.0 / sqrt((double) result->GetWeights(layer).rows);
+		randu(result->GetWeights(layer), -limit, limit);
+	}
+
+	for (auto i = 0; i < 3; i++) { result->GetInputScale().at<double>(0, 2 * i) = 0.02; result->GetInputScale().at<double>(0, 2 * i + 1) = -1.0; }
+	result->GetOutputScale().at<double>(0, 0) = 5000.0; result->GetOutputScale().at<double>(0, 1) = 0.0;
+
+	return result;
+}
+
+/**
+ * @brief Retrieve the backend that a benchmark is running against
+ * @param state The state of the benchmark (the first argument selects the backend)
+ * @return string The name of the backend
+ */
+string GetBackend(const benchmark::State& state)
+{
+	return state.range(0) == 1 ? "native" : "opencv";
+}
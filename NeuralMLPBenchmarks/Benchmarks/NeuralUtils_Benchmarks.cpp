@@ -0,0 +1,206 @@
+//--------------------------------------------------
+// Benchmarks of the NeuralUtils hot paths, over a matrix of row counts, column counts and layer topologies
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+
+//--------------------------------------------------
+// Benchmark Helpers
+//--------------------------------------------------
+
+const vector<string> TOPOLOGIES = { "10", "60,60,60" };
+
+Mat CreateUtilsData(int rows, int columns);
+NVL_AI::TrainData * CreateUtilsTrainData(int rows, int columns);
+void DataMatrix(benchmark::internal::Benchmark * benchmark);
+void NetworkMatrix(benchmark::internal::Benchmark * benchmark);
+
+//--------------------------------------------------
+// Data Benchmarks
+//--------------------------------------------------
+
+/**
+ * @brief Time loading a synthetic ARFF file with LoadData
+ */
+static void BM_NeuralUtils_LoadData(benchmark::State& state)
+{
+	auto data = CreateUtilsData(state.range(0), state.range(1));
+	NVL_AI::NeuralUtils::WriteData("bench_load.arff", "bench", "Benchmark dataset", data);
+	auto fileSize = (long) ifstream("bench_load.arff", ios::binary | ios::ate).tellg();
+
+	for (auto _ : state)
+	{
+		auto trainData = NVL_AI::NeuralUtils::LoadData("bench_load.arff");
+		benchmark::DoNotOptimize(trainData->GetInputs().data);
+		delete trainData;
+	}
+
+	state.SetItemsProcessed(state.iterations() * data.rows);
+	state.SetBytesProcessed(state.iterations() * fileSize);
+	NVLib::FileUtils::Remove("bench_load.arff");
+}
+BENCHMARK(BM_NeuralUtils_LoadData)->Apply(DataMatrix)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Time writing a synthetic dataset out as ARFF with WriteData
+ */
+static void BM_NeuralUtils_WriteData(benchmark::State& state)
+{
+	auto data = CreateUtilsData(state.range(0), state.range(1));
+
+	for (auto _ : state) NVL_AI::NeuralUtils::WriteData("bench_write.arff", "bench", "Benchmark dataset", data);
+
+	state.SetItemsProcessed(state.iterations() * data.rows);
+	NVLib::FileUtils::Remove("bench_write.arff");
+}
+BENCHMARK(BM_NeuralUtils_WriteData)->Apply(DataMatrix)->Unit(benchmark::kMillisecond);
+
+//--------------------------------------------------
+// Network Benchmarks
+//--------------------------------------------------
+
+/**
+ * @brief Time building an (untrained) network with CreateNetwork
+ */
+static void BM_NeuralUtils_CreateNetwork(benchmark::State& state)
+{
+	auto& topology = TOPOLOGIES[state.range(1)];
+
+	for (auto _ : state)
+	{
+		auto network = NVL_AI::NeuralUtils::CreateNetwork(topology, 0.01, state.range(0));
+		benchmark::DoNotOptimize(network.get());
+	}
+}
+BENCHMARK(BM_NeuralUtils_CreateNetwork)->ArgNames({ "columns", "topology" })->ArgsProduct({ { 3, 32 }, { 0, 1 } });
+
+/**
+ * @brief Time a single train(UPDATE_WEIGHTS) step (one epoch, rather than the default of up to 500)
+ */
+static void BM_NeuralUtils_TrainStep(benchmark::State& state)
+{
+	auto data = CreateUtilsTrainData(state.range(0), state.range(1));
+	auto network = NVL_AI::NeuralUtils::CreateNetwork(TOPOLOGIES[state.range(2)], 0.01, state.range(1));
+	network->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER, 1, 0));
+	auto train = ml::TrainData::create(data->GetInputs(), ml::ROW_SAMPLE, data->GetOutputs());
+	network->train(train);
+
+	for (auto _ : state) network->train(train, ml::ANN_MLP::UPDATE_WEIGHTS);
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_NeuralUtils_TrainStep)->Apply(NetworkMatrix)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Time predicting every row of the dataset
+ */
+static void BM_NeuralUtils_Predict(benchmark::State& state)
+{
+	auto data = CreateUtilsTrainData(state.range(0), state.range(1));
+	auto network = NVL_AI::NeuralUtils::CreateNetwork(TOPOLOGIES[state.range(2)], 0.01, state.range(1));
+	network->train(ml::TrainData::create(data->GetInputs(), ml::ROW_SAMPLE, data->GetOutputs()));
+
+	Mat outputs;
+	for (auto _ : state) network->predict(data->GetInputs(), outputs);
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_NeuralUtils_Predict)->Apply(NetworkMatrix)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Time scoring a network with GetScore
+ */
+static void BM_NeuralUtils_GetScore(benchmark::State& state)
+{
+	auto data = CreateUtilsTrainData(state.range(0), state.range(1));
+	auto network = NVL_AI::NeuralUtils::CreateNetwork(TOPOLOGIES[state.range(2)], 0.01, state.range(1));
+	network->train(ml::TrainData::create(data->GetInputs(), ml::ROW_SAMPLE, data->GetOutputs()));
+
+	for (auto _ : state) benchmark::DoNotOptimize(NVL_AI::NeuralUtils::GetScore(data, network));
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_NeuralUtils_GetScore)->Apply(NetworkMatrix)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Time saving a network with Save
+ */
+static void BM_NeuralUtils_Save(benchmark::State& state)
+{
+	auto data = CreateUtilsTrainData(1000, state.range(0));
+	auto network = NVL_AI::NeuralUtils::CreateNetwork(TOPOLOGIES[state.range(1)], 0.01, state.range(0));
+	network->train(ml::TrainData::create(data->GetInputs(), ml::ROW_SAMPLE, data->GetOutputs()));
+
+	for (auto _ : state) NVL_AI::NeuralUtils::Save("bench_model.xml", network);
+
+	NVLib::FileUtils::Remove("bench_model.xml");
+	delete data;
+}
+BENCHMARK(BM_NeuralUtils_Save)->ArgNames({ "columns", "topology" })->ArgsProduct({ { 3, 32 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a synthetic dataset in the layout that WriteData expects (the class is the last column)
+ * @param rows The number of rows
+ * @param columns The number of input columns
+ * @return Mat The resultant data
+ */
+Mat CreateUtilsData(int rows, int columns)
+{
+	Mat result = Mat_<double>(rows, columns + 1); randu(result, 0, 100);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto values = result.ptr<double>(row);
+		values[columns] = (values[0] * values[1 % columns]) - values[columns - 1];
+	}
+
+	return result;
+}
+
+/**
+ * @brief Create a synthetic set of training data
+ * @param rows The number of rows
+ * @param columns The number of input columns
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateUtilsTrainData(int rows, int columns)
+{
+	Mat data = CreateUtilsData(rows, columns); Mat values; data.convertTo(values, CV_32F);
+	Mat inputs = values.colRange(0, columns).clone(); Mat outputs = values.col(columns).clone();
+	return new NVL_AI::TrainData(inputs, outputs);
+}
+
+/**
+ * @brief The matrix of the data benchmarks: row counts by column counts
+ * @param benchmark The benchmark that is being set up
+ */
+void DataMatrix(benchmark::internal::Benchmark * benchmark)
+{
+	benchmark->ArgNames({ "rows", "columns" });
+	for (auto rows : { 10000, 100000 }) for (auto columns : { 3, 32 }) benchmark->Args({ rows, columns });
+}
+
+/**
+ * @brief The matrix of the network benchmarks: row counts by column counts by topologies
+ * @param benchmark The benchmark that is being set up
+ */
+void NetworkMatrix(benchmark::internal::Benchmark * benchmark)
+{
+	benchmark->ArgNames({ "rows", "columns", "topology" });
+	for (auto rows : { 1000, 10000 }) for (auto columns : { 3, 32 }) for (auto topology = 0; topology < (int) TOPOLOGIES.size(); topology++) benchmark->Args({ rows, columns, topology });
+}
@@ -0,0 +1,132 @@
+//--------------------------------------------------
+// Benchmarks measuring how quickly each training mode reaches a target score, and how training scales with threads
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+
+// The mean absolute error (as a fraction of the output range) that counts as reaching the target
+#define TARGET_ERROR 0.02
+
+// The number of train() calls that a run is allowed before it gives up
+#define MAX_CALLS 200
+
+//--------------------------------------------------
+// Benchmark Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateProblemData(int rows);
+NVL_AI::NetworkSettings GetSettings(int mode);
+
+//--------------------------------------------------
+// Benchmark Methods
+//--------------------------------------------------
+
+/**
+ * @brief Time a full training run, from fresh weights until the mean absolute error reaches the target.
+ * Mode 0 is the current OpenCV BACKPROP setup, mode 1 is the same thing on the native backend and modes
+ * 2-4 are the native mini-batch optimizers (momentum, adam and rmsprop).
+ */
+static void BM_Training_TimeToTarget(benchmark::State& state)
+{
+	auto data = CreateProblemData(4096);
+	auto settings = GetSettings(state.range(0));
+
+	double minimum, maximum; minMaxLoc(data->GetOutputs(), &minimum, &maximum);
+	auto target = TARGET_ERROR * (maximum - minimum) * data->GetOutputs().rows;
+
+	auto scorer = NVL_AI::Scorer(data);
+	auto calls = 0; auto score = 0.0;
+
+	for (auto _ : state)
+	{
+		auto network = NVL_AI::NetworkFactory::Create(settings, 3);
+
+		network->Train(data, false); calls = 1;
+		score = scorer.Evaluate(network).Total;
+
+		while (score > target && calls < MAX_CALLS)
+		{
+			network->Train(data, true); calls++;
+			score = scorer.Evaluate(network).Total;
+		}
+	}
+
+	state.counters["calls"] = calls;
+	state.counters["reached"] = score <= target ? 1 : 0;
+	state.counters["mae"] = score / data->GetOutputs().rows;
+	delete data;
+}
+BENCHMARK(BM_Training_TimeToTarget)->ArgName("mode")->DenseRange(0, 4)->Iterations(1)->Unit(benchmark::kSecond);
+
+/**
+ * @brief Measure the training throughput of the native backend as the number of training threads grows, in either
+ * mode (0 is "sync", 1 is "hogwild"), on a batch large enough to give every thread a useful slice
+ */
+static void BM_Training_ThreadScaling(benchmark::State& state)
+{
+	auto data = CreateProblemData(16384);
+	auto settings = GetSettings(2);
+	settings.BatchSize = 256; settings.Epochs = 1;
+	settings.TrainThreads = state.range(0); settings.TrainMode = state.range(1) == 0 ? "sync" : "hogwild";
+
+	auto network = NVL_AI::NetworkFactory::Create(settings, 3);
+	network->Train(data, false);
+
+	for (auto _ : state) network->Train(data, true);
+
+	state.SetItemsProcessed(state.iterations() * data->GetInputs().rows);
+	delete data;
+}
+BENCHMARK(BM_Training_ThreadScaling)->ArgNames({ "threads", "mode" })->ArgsProduct({ { 1, 2, 4, 8, 16, 32 }, { 0, 1 } })->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a dataset in the style of problem.arff, with the class as (p[0] * p[1]) - p[2]
+ * @param rows The number of rows to create
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateProblemData(int rows)
+{
+	Mat inputs = Mat_<float>(rows, 3); randu(inputs, 0, 100);
+	Mat outputs = Mat_<float>(rows, 1);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto p = inputs.ptr<float>(row);
+		outputs.at<float>(row) = (p[0] * p[1]) - p[2];
+	}
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
+
+/**
+ * @brief Retrieve the settings for a training mode on the 60,60,60 network in config.xml
+ * @param mode The mode that we are benchmarking
+ * @return NVL_AI::NetworkSettings The resultant settings
+ */
+NVL_AI::NetworkSettings GetSettings(int mode)
+{
+	auto result = NVL_AI::NetworkSettings();
+	result.Structure = "60,60,60"; result.LearnRate = 0.01;
+
+	if (mode == 0) return result;
+
+	result.Backend = "native";
+	if (mode == 1) return result;
+
+	const char * optimizers[] = { "momentum", "adam", "rmsprop" };
+	result.Optimizer = optimizers[mode - 2]; result.BatchSize = 32; result.Epochs = 10;
+	if (result.Optimizer == "adam" || result.Optimizer == "rmsprop") result.LearnRate = 0.002;
+
+	return result;
+}
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+#--------------------------------------------------------
+# Compares a Google Benchmark JSON run against a stored baseline, flagging regressions
+#
+# Usage: compare_benchmarks.py baseline.json current.json [--threshold 0.10] [--metric real_time|cpu_time]
+#
+# The exit code is 1 when any benchmark is slower than the baseline by more than the threshold, and 2 when either
+# file is missing (make benchmark_baseline stores the first baseline) or the two runs come from different build types.
+#
+# @author: Wild Boar
+#
+# Date Created: 2026-10-17
+#--------------------------------------------------------
+
+import os
+import sys
+import json
+import argparse
+
+UNITS = { "ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0 }
+
+def load_times(path, metric):
+    """Load the time of each benchmark in seconds (the mean aggregate when the run has repetitions)"""
+    with open(path) as reader:
+        runs = json.load(reader)["benchmarks"]
+
+    repeated = any(run.get("run_type") == "aggregate" for run in runs)
+
+    times = {}
+    for run in runs:
+        if run.get("error_occurred"): continue
+        if repeated and (run.get("run_type") != "aggregate" or run.get("aggregate_name") != "mean"): continue
+        times[run.get("run_name", run["name"])] = run[metric] * UNITS[run.get("time_unit", "ns")]
+    return times
+
+def load_build_type(path):
+    """Load the build type that make benchmark_json records in the context of a run (None when it was not recorded)"""
+    with open(path) as reader:
+        return json.load(reader).get("context", {}).get("build_type")
+
+def format_time(seconds):
+    """Format a time in the most readable unit"""
+    for unit, scale in (("s", 1.0), ("ms", 1e-3), ("us", 1e-6)):
+        if seconds >= scale: return "%.3f %s" % (seconds / scale, unit)
+    return "%.1f ns" % (seconds / 1e-9)
+
+def main():
+    parser = argparse.ArgumentParser(description = "Compare a benchmark run against a baseline")
+    parser.add_argument("baseline", help = "The baseline JSON file (--benchmark_out_format=json)")
+    parser.add_argument("current", help = "The JSON file of the run being checked")
+    parser.add_argument("--threshold", type = float, default = 0.10, help = "The slowdown that counts as a regression (0.10 is 10%%)")
+    parser.add_argument("--metric", default = "real_time", choices = [ "real_time", "cpu_time" ], help = "The time that is compared")
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.baseline):
+        print("No baseline found at %s: run 'make benchmark_baseline' to store one from this build" % args.baseline, file = sys.stderr)
+        return 2
+    if not os.path.isfile(args.current):
+        print("No benchmark results found at %s: run 'make benchmark_json' first" % args.current, file = sys.stderr)
+        return 2
+
+    baseline_type = load_build_type(args.baseline)
+    current_type = load_build_type(args.current)
+    if baseline_type is None or baseline_type != current_type:
+        print("The baseline was recorded from a '%s' build and the current run from a '%s' build: rebuild with the same CMAKE_BUILD_TYPE, or run 'make benchmark_baseline' to store a new baseline" % (baseline_type or "unknown", current_type or "unknown"), file = sys.stderr)
+        return 2
+    if current_type not in ("Release", "RelWithDebInfo"):
+        print("Warning: both runs come from a '%s' build, so they time unoptimized code" % current_type, file = sys.stderr)
+
+    baseline = load_times(args.baseline, args.metric)
+    current = load_times(args.current, args.metric)
+
+    regressions = 0
+    width = max([ len(name) for name in current ] + [ 9 ])
+    print("%-*s %12s %12s %9s" % (width, "Benchmark", "Baseline", "Current", "Change"))
+
+    for name in sorted(current):
+        if name not in baseline:
+            print("%-*s %12s %12s %9s  new" % (width, name, "-", format_time(current[name]), "-"))
+            continue
+
+        change = current[name] / baseline[name] - 1.0 if baseline[name] > 0 else 0.0
+        status = ""
+        if change > args.threshold: status = "REGRESSION"; regressions += 1
+        elif change < -args.threshold: status = "improved"
+        print("%-*s %12s %12s %+8.1f%%  %s" % (width, name, format_time(baseline[name]), format_time(current[name]), change * 100, status))
+
+    for name in sorted(set(baseline) - set(current)): print("%-*s %12s %12s %9s  missing" % (width, name, format_time(baseline[name]), "-", "-"))
+
+    print("\n%i of %i benchmarks regressed by more than %.0f%%" % (regressions, len(current), args.threshold * 100))
+    return 1 if regressions > 0 else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,55 @@
+//--------------------------------------------------
+// Implementation code for the code generator Engine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Engine.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * Main Constructor
+ * @param logger The logger that we are using for the system
+ * @param parameters The input parameters
+ */
+Engine::Engine(NVLib::Logger* logger, NVLib::Parameters* parameters) 
+{
+    _logger = logger; _parameters = parameters;
+
+    _modelPath = ArgUtils::GetString(parameters, "model");
+    _outputPath = ArgUtils::GetString(parameters, "output");
+
+    _logger->Log(1, "Loading model %s", _modelPath.c_str());
+    auto model = NVL_AI::NeuralUtils::LoadModel(_modelPath);
+    _generator = Ptr<NVL_AI::CodeGenerator>(new NVL_AI::CodeGenerator(model, ArgUtils::GetString(parameters, "class_name", "ModelPredictor"), ArgUtils::GetString(parameters, "namespace", "NVL_Generated")));
+}
+
+/**
+ * Main Terminator 
+ */
+Engine::~Engine() 
+{
+    delete _parameters; 
+}
+
+//--------------------------------------------------
+// Execution Entry Point
+//--------------------------------------------------
+
+/**
+ * Entry point function
+ */
+void Engine::Run()
+{
+    auto separator = _modelPath.find_last_of('/');
+    auto sourceName = separator == string::npos ? _modelPath : _modelPath.substr(separator + 1);
+
+    _generator->Write(_outputPath, sourceName);
+    _logger->Log(1, "Predictor %s::%s written to %s", _generator->GetNamespace().c_str(), _generator->GetClassName().c_str(), _outputPath.c_str());
+}
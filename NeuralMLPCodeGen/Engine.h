@@ -0,0 +1,37 @@
+//--------------------------------------------------
+// Defines the engine that turns a saved model into a fixed-topology C++ predictor
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Logger.h>
+
+#include <NeuralMLPLib/ArgUtils.h>
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/CodeGenerator.h>
+
+namespace NVL_App
+{
+	class Engine
+	{
+	private:
+		NVLib::Parameters * _parameters;
+		NVLib::Logger* _logger;
+
+		string _modelPath;
+		string _outputPath;
+		Ptr<NVL_AI::CodeGenerator> _generator;
+	public:
+		Engine(NVLib::Logger* logger, NVLib::Parameters * parameters);
+		~Engine();
+
+		void Run();
+	};
+}
@@ -0,0 +1,61 @@
+//--------------------------------------------------
+// Implementation code for the generator Engine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Engine.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * Main Constructor
+ * @param logger The logger that we are using for the system
+ * @param parameters The input parameters
+ */
+Engine::Engine(NVLib::Logger* logger, NVLib::Parameters* parameters) 
+{
+    _logger = logger; _parameters = parameters;
+
+    _settings = NVL_AI::GeneratorSettings();
+    _settings.Expression = ArgUtils::GetString(parameters, "expression");
+    NVL_AI::DataGenerator::ParseRanges(ArgUtils::GetString(parameters, "ranges", "0:100"), _settings.Low, _settings.High);
+    _settings.VariableCount = ArgUtils::GetInteger(parameters, "variables", 0);
+    _settings.RowCount = (uint64_t) ArgUtils::GetDouble(parameters, "rows");
+    _settings.Seed = (uint64_t) ArgUtils::GetInteger(parameters, "seed", 1);
+    _settings.BlockRows = ArgUtils::GetInteger(parameters, "block_rows", 65536);
+    _settings.ThreadCount = ArgUtils::GetInteger(parameters, "threads", 0);
+    _settings.Name = ArgUtils::GetString(parameters, "name", "generated");
+
+    _generator = Ptr<NVL_AI::DataGenerator>(new NVL_AI::DataGenerator(_settings));
+    _outputPath = ArgUtils::GetString(parameters, "output");
+}
+
+/**
+ * Main Terminator 
+ */
+Engine::~Engine() 
+{
+    delete _parameters; 
+}
+
+//--------------------------------------------------
+// Execution Entry Point
+//--------------------------------------------------
+
+/**
+ * Entry point function
+ */
+void Engine::Run()
+{
+    _logger->Log(1, "Generating %.0f rows of %s over %i variables (seed %i)", (double) _settings.RowCount, _settings.Expression.c_str(), _generator->GetVariableCount(), (int) _settings.Seed);
+    auto stats = _generator->Run(_outputPath);
+
+    _logger->Log(1, "Generated %.0f rows in %f seconds (%f rows/sec)", (double) stats.Rows, stats.Seconds, stats.RowsPerSecond);
+    _logger->Log(1, "Dataset written to %s", _outputPath.c_str());
+}
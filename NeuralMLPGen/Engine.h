@@ -0,0 +1,36 @@
+//--------------------------------------------------
+// Defines the engine that generates synthetic datasets from an expression
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Logger.h>
+
+#include <NeuralMLPLib/ArgUtils.h>
+#include <NeuralMLPLib/DataGenerator.h>
+
+namespace NVL_App
+{
+	class Engine
+	{
+	private:
+		NVLib::Parameters * _parameters;
+		NVLib::Logger* _logger;
+
+		Ptr<NVL_AI::DataGenerator> _generator;
+		NVL_AI::GeneratorSettings _settings;
+		string _outputPath;
+	public:
+		Engine(NVLib::Logger* logger, NVLib::Parameters * parameters);
+		~Engine();
+
+		void Run();
+	};
+}
@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// Implementation of class AdamOptimizer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "AdamOptimizer.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Setup
+//--------------------------------------------------
+
+/**
+ * @brief Allocate the moment estimates for each layer
+ * @param layerSizes The sizes of the layers in the network
+ */
+void AdamOptimizer::Setup(const vector<int>& layerSizes)
+{
+	CreateState(layerSizes, _first);
+	CreateState(layerSizes, _second);
+	_step = 0;
+}
+
+/**
+ * @brief Forget the moment estimates
+ */
+void AdamOptimizer::Reset()
+{
+	ClearState(_first); ClearState(_second);
+	_step = 0;
+}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Move on to the next step, folding the bias corrections of both moments into the rate
+ */
+void AdamOptimizer::BeginStep()
+{
+	_step++;
+	_rate = (float) (_learnRate * sqrt(1.0 - pow(_beta2, _step)) / (1.0 - pow(_beta1, _step)));
+}
+
+/**
+ * @brief Update the weights of a layer
+ * @param layer The index of the layer
+ * @param weights The weights of the layer
+ * @param gradient The descent direction for the weights
+ */
+void AdamOptimizer::Update(int layer, Mat& weights, Mat& gradient)
+{
+	MathKernels::AdamUpdate((float *) weights.data, (float *) _first[layer].data, (float *) _second[layer].data, (float *) gradient.data, _rate, (float) _beta1, (float) _beta2, (float) _epsilon, (int) weights.total());
+}
@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// The Adam optimizer (adaptive moment estimation)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#include "Optimizer.h"
+
+namespace NVL_AI
+{
+	class AdamOptimizer : public Optimizer
+	{
+	private:
+		double _beta1;
+		double _beta2;
+		double _epsilon;
+		int _step;
+		float _rate;
+		vector<Mat> _first;
+		vector<Mat> _second;
+	public:
+		AdamOptimizer(double learnRate, double beta1 = 0.9, double beta2 = 0.999, double epsilon = 1e-8) :
+			Optimizer(learnRate), _beta1(beta1), _beta2(beta2), _epsilon(epsilon), _step(0), _rate(0) {}
+
+		void Setup(const vector<int>& layerSizes) override;
+		void Reset() override;
+		void BeginStep() override;
+		void Update(int layer, Mat& weights, Mat& gradient) override;
+		string GetName() override { return "adam"; }
+	};
+}
@@ -0,0 +1,148 @@
+//--------------------------------------------------
+// Implementation of class AllocationCounter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "AllocationCounter.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Counters
+//--------------------------------------------------
+
+#define COUNTER_SLOTS 256
+
+// The counts of one thread, on a cache line of their own so that threads counting at the same time never share it
+struct alignas(64) CounterSlot
+{
+	atomic<bool> Claimed;
+	atomic<long> Count;
+	atomic<long> Bytes;
+	atomic<long> BackgroundCount;
+	atomic<long> BackgroundBytes;
+};
+
+// Kept as plain globals (which are zeroed before any code runs) since allocations are made before main starts. The
+// shared slot takes the counts of any threads beyond the last free slot, and of threads that are shutting down.
+static CounterSlot slots[COUNTER_SLOTS];
+static CounterSlot sharedSlot;
+static thread_local CounterSlot * slot = nullptr;
+static thread_local bool background = false;
+
+/**
+ * @brief Hands the slot of a thread back when the thread exits, so that a later thread can count in it. The counts
+ * are left where they are, since they still belong in the totals.
+ */
+struct SlotRelease
+{
+	~SlotRelease()
+	{
+		if (slot != &sharedSlot) slot->Claimed.store(false, memory_order_release);
+		slot = &sharedSlot;
+	}
+};
+
+/**
+ * @brief Give the calling thread a slot of its own (or the shared slot, if every slot is taken)
+ */
+static void ClaimSlot()
+{
+	slot = &sharedSlot;
+
+	for (auto i = 0; i < COUNTER_SLOTS; i++)
+	{
+		auto expected = false;
+		if (!slots[i].Claimed.compare_exchange_strong(expected, true, memory_order_acquire)) continue;
+
+		// The slot is set first, since registering the release at thread exit may itself allocate
+		slot = &slots[i];
+		static thread_local SlotRelease release;
+		return;
+	}
+}
+
+/**
+ * @brief Add the counts of every slot together
+ * @param backgroundThreads Whether to add up the counts of the background threads rather than the others
+ * @return AllocationStats The resultant counts
+ */
+static AllocationStats GetTotals(bool backgroundThreads)
+{
+	auto result = AllocationStats();
+
+	for (auto i = 0; i <= COUNTER_SLOTS; i++)
+	{
+		auto& current = i < COUNTER_SLOTS ? slots[i] : sharedSlot;
+		result.Count += (backgroundThreads ? current.BackgroundCount : current.Count).load(memory_order_relaxed);
+		result.Bytes += (backgroundThreads ? current.BackgroundBytes : current.Bytes).load(memory_order_relaxed);
+	}
+
+	return result;
+}
+
+/**
+ * @brief Add an allocation to the counts of the calling thread's kind
+ * @param bytes The size of the allocation
+ */
+void AllocationCounter::Record(size_t bytes)
+{
+	if (slot == nullptr) ClaimSlot();
+
+	auto& count = background ? slot->BackgroundCount : slot->Count;
+	auto& total = background ? slot->BackgroundBytes : slot->Bytes;
+
+	if (slot == &sharedSlot)
+	{
+		count.fetch_add(1, memory_order_relaxed);
+		total.fetch_add((long) bytes, memory_order_relaxed);
+		return;
+	}
+
+	// Nothing else writes to the slot of this thread, so a plain load and store will do (rather than a locked add)
+	count.store(count.load(memory_order_relaxed) + 1, memory_order_relaxed);
+	total.store(total.load(memory_order_relaxed) + (long) bytes, memory_order_relaxed);
+}
+
+/**
+ * @brief Count the allocations of the calling thread apart from the rest. This is for the threads that work alongside
+ * the training loop (such as the checkpoint writer), so that what they allocate is not put down to the loop.
+ */
+void AllocationCounter::MarkBackground()
+{
+	background = true;
+}
+
+/**
+ * @brief Get the allocations that have been made since the process started, leaving out the background threads.
+ * The counts cover everything that goes through operator new, which includes the header that OpenCV allocates for
+ * each Mat buffer (so every Mat is counted, although the bytes of its buffer are not).
+ * @return AllocationStats The resultant counts
+ */
+AllocationStats AllocationCounter::GetStats()
+{
+	return GetTotals(false);
+}
+
+/**
+ * @brief Get the allocations that have been made by the background threads since the process started
+ * @return AllocationStats The resultant counts
+ */
+AllocationStats AllocationCounter::GetBackgroundStats()
+{
+	return GetTotals(true);
+}
+
+/**
+ * @brief Get the allocations that have been made since an earlier reading
+ * @param start The earlier reading
+ * @return AllocationStats The allocations made since then
+ */
+AllocationStats AllocationCounter::GetChange(const AllocationStats& start)
+{
+	auto result = GetStats();
+	result.Count -= start.Count; result.Bytes -= start.Bytes;
+	return result;
+}
@@ -0,0 +1,35 @@
+//--------------------------------------------------
+// Counts the heap allocations made by the process. The counts come from the replacements of the global operator new
+// in AllocationHooks.cpp, so they stay at zero in binaries that are not built with them.
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+using namespace std;
+
+namespace NVL_AI
+{
+	struct AllocationStats
+	{
+		long Count = 0;
+		long Bytes = 0;
+	};
+
+	class AllocationCounter
+	{
+	public:
+		static AllocationStats GetStats();
+		static AllocationStats GetBackgroundStats();
+		static AllocationStats GetChange(const AllocationStats& start);
+		static void MarkBackground();
+		static void Record(size_t bytes);
+	};
+}
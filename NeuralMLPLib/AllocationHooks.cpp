@@ -0,0 +1,65 @@
+//--------------------------------------------------
+// Replacements of the global operator new and delete, which feed AllocationCounter. These are kept out of
+// NeuralMLPLib and only built into the binaries that report allocations (see NeuralMLPLib/CMakeLists.txt).
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "AllocationCounter.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Replacements
+//--------------------------------------------------
+
+/**
+ * @brief Allocate a block and count it
+ * @param size The size of the block
+ * @param alignment The alignment of the block (0 for the default)
+ * @return void * The block (or null if there is no memory)
+ */
+static void * CountedAllocate(size_t size, size_t alignment)
+{
+	AllocationCounter::Record(size);
+	if (size == 0) size = 1;
+
+	if (alignment <= alignof(max_align_t)) return malloc(size);
+	return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+/**
+ * @brief Allocate a block and count it, throwing if there is no memory (as operator new must)
+ * @param size The size of the block
+ * @param alignment The alignment of the block (0 for the default)
+ * @return void * The block
+ */
+static void * CountedAllocateOrThrow(size_t size, size_t alignment)
+{
+	auto result = CountedAllocate(size, alignment);
+	if (result == nullptr) throw bad_alloc();
+	return result;
+}
+
+void * operator new(size_t size) { return CountedAllocateOrThrow(size, 0); }
+void * operator new[](size_t size) { return CountedAllocateOrThrow(size, 0); }
+void * operator new(size_t size, align_val_t alignment) { return CountedAllocateOrThrow(size, (size_t) alignment); }
+void * operator new[](size_t size, align_val_t alignment) { return CountedAllocateOrThrow(size, (size_t) alignment); }
+void * operator new(size_t size, const nothrow_t&) noexcept { return CountedAllocate(size, 0); }
+void * operator new[](size_t size, const nothrow_t&) noexcept { return CountedAllocate(size, 0); }
+void * operator new(size_t size, align_val_t alignment, const nothrow_t&) noexcept { return CountedAllocate(size, (size_t) alignment); }
+void * operator new[](size_t size, align_val_t alignment, const nothrow_t&) noexcept { return CountedAllocate(size, (size_t) alignment); }
+
+void operator delete(void * block) noexcept { free(block); }
+void operator delete[](void * block) noexcept { free(block); }
+void operator delete(void * block, size_t) noexcept { free(block); }
+void operator delete[](void * block, size_t) noexcept { free(block); }
+void operator delete(void * block, align_val_t) noexcept { free(block); }
+void operator delete[](void * block, align_val_t) noexcept { free(block); }
+void operator delete(void * block, size_t, align_val_t) noexcept { free(block); }
+void operator delete[](void * block, size_t, align_val_t) noexcept { free(block); }
+void operator delete(void * block, const nothrow_t&) noexcept { free(block); }
+void operator delete[](void * block, const nothrow_t&) noexcept { free(block); }
+void operator delete(void * block, align_val_t, const nothrow_t&) noexcept { free(block); }
+void operator delete[](void * block, align_val_t, const nothrow_t&) noexcept { free(block); }
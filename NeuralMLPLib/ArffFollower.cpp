@@ -0,0 +1,217 @@
+//--------------------------------------------------
+// Implementation of class ArffFollower
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ArffFollower.h"
+using namespace NVL_AI;
+
+#define READ_BYTES (1 << 20)
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the source that we are following (a file, a named pipe, or "-" for stdin)
+ * @param fieldCount The number of inputs in each record
+ * @param skipRows The number of records at the start of the source that have been read already (and are skipped)
+ */
+ArffFollower::ArffFollower(const string& path, int fieldCount, int skipRows) :
+	_path(path), _handle(-1), _stream(true), _fieldCount(fieldCount), _skipRows(skipRows), _inHeader(true), _attributeCount(0),
+	_closed(false), _line(0), _offset(0), _rowCount(0), _badCount(0), _bufferSize(0), _pendingStart(0)
+{
+	if (path == "-") _handle = STDIN_FILENO;
+	else _handle = open(path.c_str(), O_RDONLY);
+	if (_handle < 0) throw runtime_error("Unable to open the source to follow: " + path);
+
+	struct stat info;
+	if (fstat(_handle, &info) == 0) _stream = !S_ISREG(info.st_mode);
+
+	_buffer.resize(READ_BYTES);
+}
+
+/**
+ * @brief Main Terminator
+ */
+ArffFollower::~ArffFollower()
+{
+	if (_handle >= 0 && _handle != STDIN_FILENO) close(_handle);
+}
+
+//--------------------------------------------------
+// Poll
+//--------------------------------------------------
+
+/**
+ * @brief Read whatever has been written to the source since the last call, and parse the whole records in it. A
+ * record that is still being written is kept until its line is finished. The call waits for up to waitMs if
+ * nothing has arrived, so a caller can loop on it without spinning.
+ * @param waitMs The milliseconds to wait for new data (0 just checks)
+ * @return int The number of new records
+ */
+int ArffFollower::Poll(int waitMs)
+{
+	ReadAvailable(waitMs);
+	return ParseLines(_closed);
+}
+
+/**
+ * @brief Move the oldest waiting records into a batch
+ * @param inputs The buffer that the inputs are written to (its row count is the most records that are taken)
+ * @param outputs The buffer that the outputs are written to (one column, the same row count as the inputs)
+ * @return int The number of records that were taken
+ */
+int ArffFollower::Take(Mat& inputs, Mat& outputs)
+{
+	if (inputs.type() != CV_32F || outputs.type() != CV_32F || !inputs.isContinuous() || !outputs.isContinuous()) throw runtime_error("Batches must be read into continuous float buffers");
+	if (inputs.cols != _fieldCount || outputs.cols != 1 || outputs.rows != inputs.rows) throw runtime_error("The batch buffers do not match the followed source");
+
+	auto rows = min(inputs.rows, GetPendingRows());
+	auto source = _pending.data() + _pendingStart;
+
+	for (auto row = 0; row < rows; row++)
+	{
+		memcpy(inputs.ptr<float>(row), source, _fieldCount * sizeof(float));
+		outputs.at<float>(row) = source[_fieldCount];
+		source += _fieldCount + 1;
+	}
+
+	// The records that were taken are dropped once they are half of the queue, so it is not shifted on every batch
+	_pendingStart += (size_t) rows * (_fieldCount + 1);
+	if (_pendingStart == _pending.size()) { _pending.clear(); _pendingStart = 0; }
+	else if (_pendingStart > _pending.size() / 2) { _pending.erase(_pending.begin(), _pending.begin() + _pendingStart); _pendingStart = 0; }
+
+	return rows;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Read the next block of the source onto the end of the buffer. A pipe is polled so that the read never
+ * blocks for longer than the wait; a file just reads to its current end, and is read again after the wait if
+ * nothing was there.
+ * @param waitMs The milliseconds to wait for new data
+ * @return size_t The number of bytes that were read
+ */
+size_t ArffFollower::ReadAvailable(int waitMs)
+{
+	if (_closed) return 0;
+	if (_bufferSize == _buffer.size()) _buffer.resize(_buffer.size() * 2); // A line that is longer than the buffer
+
+	auto space = _buffer.size() - _bufferSize;
+	auto bytes = (ssize_t) 0;
+
+	if (_stream)
+	{
+		auto request = pollfd { _handle, POLLIN, 0 };
+		auto ready = poll(&request, 1, waitMs);
+		if (ready < 0 && errno != EINTR) throw runtime_error("Unable to poll the source: " + _path);
+		if (ready <= 0) return 0;
+
+		bytes = read(_handle, _buffer.data() + _bufferSize, space);
+		if (bytes < 0 && (errno == EINTR || errno == EAGAIN)) return 0;
+		if (bytes == 0) _closed = true;
+	}
+	else
+	{
+		struct stat info;
+		if (fstat(_handle, &info) == 0 && (size_t) info.st_size < _offset) throw runtime_error("The followed file was truncated: " + _path);
+
+		bytes = read(_handle, _buffer.data() + _bufferSize, space);
+		if (bytes == 0 && waitMs > 0)
+		{
+			this_thread::sleep_for(chrono::milliseconds(waitMs));
+			bytes = read(_handle, _buffer.data() + _bufferSize, space);
+		}
+	}
+	if (bytes < 0) throw runtime_error(NVLib::Formatter() << "Unable to read the source: " << _path << " (" << strerror(errno) << ")");
+
+	_bufferSize += bytes; _offset += bytes;
+	return (size_t) bytes;
+}
+
+/**
+ * @brief Parse the whole lines in the buffer, and keep the start of a line that has not been finished yet
+ * @param flush Parse the last line even if it has not been finished (once the source has closed)
+ * @return int The number of records that were added
+ */
+int ArffFollower::ParseLines(bool flush)
+{
+	auto data = _buffer.data(); auto end = data + _bufferSize;
+	auto position = (const char *) data; auto rows = 0;
+
+	while (position < end)
+	{
+		auto lineEnd = (const char *) memchr(position, '\n', end - position);
+		if (lineEnd == nullptr) { if (!flush) break; lineEnd = end; }
+
+		if (ParseLine(position, lineEnd)) rows++;
+		position = lineEnd < end ? lineEnd + 1 : end;
+	}
+
+	auto used = (size_t) (position - data);
+	memmove(data, position, _bufferSize - used); _bufferSize -= used;
+
+	return rows;
+}
+
+/**
+ * @brief Parse a line of the source. Header lines are checked against the inputs that we expect, and a source
+ * with no header starts straight in on its records. A record that cannot be parsed is counted and dropped rather
+ * than stopping the run, since a live feed is expected to keep going past one bad row.
+ * @param start The start of the line
+ * @param end The end of the line
+ * @return bool True if a record was added
+ */
+bool ArffFollower::ParseLine(const char * start, const char * end)
+{
+	_line++;
+
+	auto position = start;
+	while (position < end && (*position == ' ' || *position == '\t')) position++;
+	if (ArffReader::IsBlank(position, end) || *position == '%') return false;
+
+	if (_inHeader)
+	{
+		if (*position == '@')
+		{
+			auto line = string(position, end); if (line.back() == '\r') line.pop_back();
+
+			if (NVLib::StringUtils::StartsWith(line, "@DATA"))
+			{
+				_inHeader = false;
+				if (_attributeCount != _fieldCount) throw runtime_error(NVLib::Formatter() << "The followed source has " << _attributeCount << " inputs where " << _fieldCount << " were expected: " << _path);
+			}
+			else if (NVLib::StringUtils::StartsWith(line, "@ATTRIBUTE"))
+			{
+				auto parts = vector<string>(); NVLib::StringUtils::Split(line, ' ', parts);
+				if (parts.size() == 3 && parts[1] != "class") _attributeCount++;
+			}
+			return false;
+		}
+		_inHeader = false;
+	}
+
+	if (_skipRows > 0) { _skipRows--; return false; }
+
+	auto size = _pending.size(); _pending.resize(size + _fieldCount + 1);
+	try
+	{
+		ArffReader::ParseRecord(position, end, _line, _fieldCount, false, &_pending[size], _pending[size + _fieldCount]);
+	}
+	catch (runtime_error&)
+	{
+		_pending.resize(size); _badCount++;
+		return false;
+	}
+
+	_rowCount++;
+	return true;
+}
@@ -0,0 +1,73 @@
+//--------------------------------------------------
+// Follows an ARFF source that is still being written (a file that is appended to, a pipe or stdin), turning the
+// records that arrive into rows that are ready to train on
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+#include <NVLib/StringUtils.h>
+
+#include "ArffReader.h"
+
+namespace NVL_AI
+{
+	class ArffFollower
+	{
+	private:
+		string _path;
+		int _handle;
+		bool _stream;
+		int _fieldCount;
+		int _skipRows;
+		bool _inHeader;
+		int _attributeCount;
+		bool _closed;
+		int _line;
+		size_t _offset;
+		int _rowCount;
+		int _badCount;
+		vector<char> _buffer;
+		size_t _bufferSize;
+		vector<float> _pending;
+		size_t _pendingStart;
+	public:
+		ArffFollower(const string& path, int fieldCount, int skipRows = 0);
+		~ArffFollower();
+
+		ArffFollower(const ArffFollower&) = delete;
+		ArffFollower& operator=(const ArffFollower&) = delete;
+
+		int Poll(int waitMs);
+		int Take(Mat& inputs, Mat& outputs);
+
+		inline int GetPendingRows() { return (int) ((_pending.size() - _pendingStart) / (_fieldCount + 1)); }
+		inline int GetRowCount() { return _rowCount; }
+		inline int GetBadCount() { return _badCount; }
+		inline bool IsStream() { return _stream; }
+		inline bool IsClosed() { return _closed; }
+	private:
+		size_t ReadAvailable(int waitMs);
+		int ParseLines(bool flush);
+		bool ParseLine(const char * start, const char * end);
+	};
+}
@@ -0,0 +1,353 @@
+//--------------------------------------------------
+// Implementation of class ArffReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ArffReader.h"
+using namespace NVL_AI;
+
+// The smallest block of data records that is worth handing to its own thread
+#define MIN_CHUNK_SIZE (64 * 1024)
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the ARFF file that we are reading
+ * @param threadCount The number of threads to parse with (0 uses every core)
+ */
+ArffReader::ArffReader(const string& path, int threadCount) : _path(path), _dataLine(1), _rowCount(0), _seconds(0), _offset(0), _finished(true), _missingClass(false)
+{
+	_threadCount = ParallelUtils::GetThreadCount(threadCount);
+}
+
+//--------------------------------------------------
+// Read
+//--------------------------------------------------
+
+/**
+ * @brief Read the file into a set of training data.
+ * The file is mapped into memory and the data section is split into line aligned chunks. Each chunk is
+ * scanned on its own thread to count its records, the counts give every chunk a fixed slice of the
+ * matrices (so row order is kept), and then the chunks are parsed in parallel straight into those slices.
+ * @return TrainData * The training data that was read from the file
+ */
+TrainData * ArffReader::Read()
+{
+	auto start = chrono::steady_clock::now();
+
+	auto file = MappedFile(_path);
+	auto data = file.GetData(); auto size = file.GetSize();
+
+	_fieldNames.clear(); _missingClass = false;
+	auto dataStart = ReadHeader(data, size);
+
+	auto chunks = vector<ArffChunk>(); SplitChunks(data + dataStart, data + size, chunks);
+	ParallelUtils::Run((int)chunks.size(), [&](int index) { CountRows(chunks[index]); });
+
+	auto chunkCount = AssignRows(chunks, _rowCount);
+
+	Mat inputs = Mat_<float>(_rowCount, (int)_fieldNames.size());
+	Mat outputs = Mat_<float>(_rowCount, 1);
+	auto inputData = (float *) inputs.data; auto outputData = (float *) outputs.data;
+	ParallelUtils::Run(chunkCount, [&](int index) { ParseRows(chunks[index], inputData, outputData); });
+
+	_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	return new TrainData(inputs, outputs);
+}
+
+//--------------------------------------------------
+// Streaming
+//--------------------------------------------------
+
+/**
+ * @brief Open the file for reading in batches. The file is mapped and its header is read, after which
+ * ReadBatch() works through the records. A class of "?" is allowed by default (it is read as NaN), since data
+ * that is streamed in for prediction does not have to be labelled.
+ * @param missingClass Whether a class of "?" is allowed (training data should turn it off)
+ */
+void ArffReader::Open(bool missingClass)
+{
+	_file = Ptr<MappedFile>(new MappedFile(_path));
+
+	_fieldNames.clear(); _rowCount = 0; _seconds = 0; _missingClass = missingClass;
+	_offset = ReadHeader(_file->GetData(), _file->GetSize());
+	_finished = _offset >= _file->GetSize();
+}
+
+/**
+ * @brief Count the records that are left to read, without parsing them or moving on. The lines are counted in
+ * parallel in the same way as Read(), and the pages that were scanned are dropped afterwards.
+ * @return int The number of records that ReadBatch() will return from here on
+ */
+int ArffReader::CountRecords()
+{
+	if (_file == nullptr) throw runtime_error("The reader has not been opened: " + _path);
+	if (_finished) return 0;
+
+	auto data = _file->GetData(); auto end = data + _file->GetSize();
+
+	auto chunks = vector<ArffChunk>(); SplitChunks(data + _offset, end, chunks);
+	ParallelUtils::Run((int)chunks.size(), [&](int index) { CountRows(chunks[index]); });
+
+	auto result = 0; AssignRows(chunks, result);
+	_file->Discard(_offset, end - (data + _offset));
+
+	return result;
+}
+
+/**
+ * @brief Read the next batch of records into preallocated buffers. The batch is parsed in parallel in the
+ * same way as Read(), and the pages of the file that it came from are dropped afterwards, so memory use
+ * is bounded by the batch size rather than the size of the file.
+ * @param inputs The buffer that the inputs are written to (its row count is the batch size)
+ * @param outputs The buffer that the outputs are written to (one column, the same row count as the inputs)
+ * @return int The number of records that were read (0 once the data is finished)
+ */
+int ArffReader::ReadBatch(Mat& inputs, Mat& outputs)
+{
+	if (_file == nullptr) throw runtime_error("The reader has not been opened: " + _path);
+	if (inputs.type() != CV_32F || outputs.type() != CV_32F || !inputs.isContinuous() || !outputs.isContinuous()) throw runtime_error("Batches must be read into continuous float buffers");
+	if (inputs.cols != (int)_fieldNames.size() || outputs.cols != 1 || outputs.rows != inputs.rows) throw runtime_error("The batch buffers do not match the file");
+	if (_finished) return 0;
+
+	auto start = chrono::steady_clock::now();
+
+	auto data = _file->GetData(); auto end = data + _file->GetSize();
+	const char * batchStart = data + _offset; auto position = batchStart;
+
+	for (auto row = 0; row < inputs.rows && position < end; row++)
+	{
+		auto lineEnd = GetLineEnd(position, end);
+		if (IsBlank(position, lineEnd)) { _finished = true; break; }
+		position = lineEnd < end ? lineEnd + 1 : end;
+	}
+	if (position >= end) _finished = true;
+
+	auto chunks = vector<ArffChunk>(); SplitChunks(batchStart, position, chunks);
+	ParallelUtils::Run((int)chunks.size(), [&](int index) { CountRows(chunks[index]); });
+
+	auto rows = 0; auto chunkCount = AssignRows(chunks, rows);
+	ParallelUtils::Run(chunkCount, [&](int index) { ParseRows(chunks[index], (float *) inputs.data, (float *) outputs.data); });
+
+	_file->Discard(_offset, position - batchStart);
+	_offset = position - data; _dataLine += rows; _rowCount += rows;
+	_seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	return rows;
+}
+
+//--------------------------------------------------
+// Header
+//--------------------------------------------------
+
+/**
+ * @brief Read the attributes from the header of the file
+ * @param data The contents of the file
+ * @param size The size of the file
+ * @return size_t The offset of the first data record within the file
+ */
+size_t ArffReader::ReadHeader(const char * data, size_t size)
+{
+	auto position = data; auto end = data + size; _dataLine = 1;
+
+	while (position < end)
+	{
+		auto lineEnd = GetLineEnd(position, end);
+		auto line = string(position, lineEnd);
+		position = lineEnd < end ? lineEnd + 1 : end; _dataLine++;
+
+		if (NVLib::StringUtils::StartsWith(line, "@DATA")) break;
+
+		if (NVLib::StringUtils::StartsWith(line, "@ATTRIBUTE"))
+		{
+			auto parts = vector<string>(); NVLib::StringUtils::Split(line, ' ', parts);
+			if (parts.size() == 3 && parts[1] != "class")
+			{
+				_fieldNames.push_back(parts[1]);
+			}
+		}
+	}
+
+	return position - data;
+}
+
+//--------------------------------------------------
+// Data
+//--------------------------------------------------
+
+/**
+ * @brief Split the data section into one chunk per thread, with each boundary moved to the start of a line
+ * @param start The start of the data section
+ * @param end The end of the file
+ * @param chunks The chunks that were created
+ */
+void ArffReader::SplitChunks(const char * start, const char * end, vector<ArffChunk>& chunks)
+{
+	auto size = (size_t)(end - start);
+	auto count = (int) max<size_t>(1, min<size_t>(_threadCount, size / MIN_CHUNK_SIZE));
+
+	auto chunkStart = start;
+	for (auto i = 1; i <= count; i++)
+	{
+		auto boundary = i == count ? end : start + size * i / count;
+		if (boundary < chunkStart) boundary = chunkStart;
+		if (boundary < end) { boundary = GetLineEnd(boundary, end); if (boundary < end) boundary++; }
+
+		chunks.push_back(ArffChunk { chunkStart, boundary, 0, 0, false });
+		chunkStart = boundary;
+	}
+}
+
+/**
+ * @brief Count the data records within a chunk, stopping at a blank line (which ends the data section)
+ * @param chunk The chunk that we are counting
+ */
+void ArffReader::CountRows(ArffChunk& chunk)
+{
+	auto position = chunk.Start;
+
+	while (position < chunk.End)
+	{
+		auto lineEnd = GetLineEnd(position, chunk.End);
+		if (IsBlank(position, lineEnd)) { chunk.Terminated = true; break; }
+		chunk.RowCount++; position = lineEnd + 1;
+	}
+}
+
+/**
+ * @brief Give each chunk its slice of the rows. The records stop at the first blank line, so later chunks are dropped.
+ * @param chunks The chunks (with their rows counted)
+ * @param rowCount The total number of rows that were found
+ * @return int The number of chunks that hold records
+ */
+int ArffReader::AssignRows(vector<ArffChunk>& chunks, int& rowCount)
+{
+	rowCount = 0; auto chunkCount = 0;
+
+	for (auto& chunk : chunks)
+	{
+		chunk.RowOffset = rowCount; rowCount += chunk.RowCount; chunkCount++;
+		if (chunk.Terminated) break;
+	}
+
+	return chunkCount;
+}
+
+/**
+ * @brief Parse the records of a chunk into its slice of the input and output buffers
+ * @param chunk The chunk that we are parsing
+ * @param inputs The buffer that the inputs are written to
+ * @param outputs The buffer that the outputs are written to
+ */
+void ArffReader::ParseRows(ArffChunk& chunk, float * inputs, float * outputs)
+{
+	auto fieldCount = (int)_fieldNames.size();
+	auto position = chunk.Start;
+
+	for (auto row = chunk.RowOffset; row < chunk.RowOffset + chunk.RowCount; row++)
+	{
+		auto lineEnd = GetLineEnd(position, chunk.End);
+		ParseRecord(position, lineEnd, _dataLine + row, fieldCount, _missingClass, inputs + row * fieldCount, outputs[row]);
+		position = lineEnd + 1;
+	}
+}
+
+/**
+ * @brief Parse a single record: the input values and then the class, separated by commas
+ * @param position The start of the record
+ * @param lineEnd The end of the record
+ * @param line The line number of the record (for error reporting)
+ * @param fieldCount The number of input values in the record
+ * @param missingClass Whether a class of "?" is allowed (it is read as NaN)
+ * @param inputs The buffer that the input values are written to
+ * @param output The class value that was parsed
+ */
+void ArffReader::ParseRecord(const char * position, const char * lineEnd, int line, int fieldCount, bool missingClass, float * inputs, float& output)
+{
+	auto cursor = position;
+
+	for (auto column = 0; column < fieldCount; column++)
+	{
+		cursor = ParseValue(cursor, lineEnd, line, inputs[column]);
+		if (cursor == lineEnd || *cursor != ',') throw runtime_error(NVLib::Formatter() << "The file has bad data records (line " << line << ")");
+		cursor++;
+	}
+
+	if (missingClass && IsMissing(cursor, lineEnd)) { output = numeric_limits<float>::quiet_NaN(); cursor = lineEnd; }
+	else cursor = ParseValue(cursor, lineEnd, line, output);
+	if (!IsBlank(cursor, lineEnd)) throw runtime_error(NVLib::Formatter() << "The file has bad data records (line " << line << ")");
+}
+
+/**
+ * @brief Parse a single value from a record
+ * @param position The position of the value within the record
+ * @param end The end of the record
+ * @param line The line number of the record (for error reporting)
+ * @param value The value that was parsed
+ * @return const char * The position just after the value
+ */
+const char * ArffReader::ParseValue(const char * position, const char * end, int line, float& value)
+{
+	while (position < end && (*position == ' ' || *position == '\t')) position++;
+	if (position < end && *position == '+') position++;
+
+	auto number = 0.0; auto result = from_chars(position, end, number);
+	if (result.ec != errc()) throw runtime_error(NVLib::Formatter() << "The file has bad data records (line " << line << ")");
+	value = (float) number;
+
+	position = result.ptr;
+	while (position < end && (*position == ' ' || *position == '\t')) position++;
+
+	return position;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the end of the current line
+ * @param position The position within the line
+ * @param end The end of the file
+ * @return const char * The position of the line feed (or the end of the file)
+ */
+const char * ArffReader::GetLineEnd(const char * position, const char * end)
+{
+	auto lineEnd = (const char *) memchr(position, '\n', end - position);
+	return lineEnd == nullptr ? end : lineEnd;
+}
+
+/**
+ * @brief Determine whether a value is the ARFF missing value marker ("?")
+ * @param position The position of the value within the record
+ * @param lineEnd The end of the record
+ * @return true If the value is missing
+ * @return false If the value is present
+ */
+bool ArffReader::IsMissing(const char * position, const char * lineEnd)
+{
+	while (position < lineEnd && (*position == ' ' || *position == '\t')) position++;
+	if (position == lineEnd || *position != '?') return false;
+	position++;
+	while (position < lineEnd && (*position == ' ' || *position == '\t')) position++;
+	return IsBlank(position, lineEnd);
+}
+
+/**
+ * @brief Determine whether the rest of a line is empty (allowing for a trailing carriage return)
+ * @param position The position within the line
+ * @param lineEnd The end of the line
+ * @return true If there is nothing left on the line
+ * @return false If there is content left on the line
+ */
+bool ArffReader::IsBlank(const char * position, const char * lineEnd)
+{
+	return position == lineEnd || (position + 1 == lineEnd && *position == '\r');
+}
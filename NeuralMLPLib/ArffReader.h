@@ -0,0 +1,79 @@
+//--------------------------------------------------
+// A reader that parses ARFF files straight into training data
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <limits>
+#include <cstring>
+#include <charconv>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+#include <NVLib/StringUtils.h>
+
+#include "MappedFile.h"
+#include "ParallelUtils.h"
+#include "TrainData.h"
+
+namespace NVL_AI
+{
+	struct ArffChunk
+	{
+		const char * Start;
+		const char * End;
+		int RowCount;
+		int RowOffset;
+		bool Terminated;
+	};
+
+	class ArffReader
+	{
+	private:
+		string _path;
+		int _threadCount;
+		vector<string> _fieldNames;
+		int _dataLine;
+		int _rowCount;
+		double _seconds;
+		Ptr<MappedFile> _file;
+		size_t _offset;
+		bool _finished;
+		bool _missingClass;
+	public:
+		ArffReader(const string& path, int threadCount = 1);
+
+		TrainData * Read();
+
+		void Open(bool missingClass = true);
+		int CountRecords();
+		int ReadBatch(Mat& inputs, Mat& outputs);
+
+		inline vector<string>& GetFieldNames() { return _fieldNames; }
+		inline int GetRowCount() { return _rowCount; }
+		inline double GetSeconds() { return _seconds; }
+		inline double GetRowsPerSecond() { return _seconds > 0 ? _rowCount / _seconds : 0; }
+		inline bool IsFinished() { return _finished; }
+
+		static void ParseRecord(const char * position, const char * lineEnd, int line, int fieldCount, bool missingClass, float * inputs, float& output);
+		static bool IsBlank(const char * position, const char * lineEnd);
+	private:
+		size_t ReadHeader(const char * data, size_t size);
+		void SplitChunks(const char * start, const char * end, vector<ArffChunk>& chunks);
+		void CountRows(ArffChunk& chunk);
+		int AssignRows(vector<ArffChunk>& chunks, int& rowCount);
+		void ParseRows(ArffChunk& chunk, float * inputs, float * outputs);
+		static const char * ParseValue(const char * position, const char * end, int line, float& value);
+		static const char * GetLineEnd(const char * position, const char * end);
+		static bool IsMissing(const char * position, const char * lineEnd);
+	};
+}
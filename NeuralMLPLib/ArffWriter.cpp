@@ -0,0 +1,193 @@
+//--------------------------------------------------
+// Implementation of class ArffWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ArffWriter.h"
+using namespace NVL_AI;
+
+// The number of records that are formatted together as a single block
+#define BLOCK_ROWS 4096
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path that we are writing to
+ * @param threadCount The number of threads used to format records (0 uses every core)
+ */
+ArffWriter::ArffWriter(const string& path, int threadCount) : _path(path)
+{
+	_threadCount = ParallelUtils::GetThreadCount(threadCount);
+	_blocks.resize(_threadCount);
+
+	_writer.open(path, ios::binary);
+	if (!_writer.is_open()) throw runtime_error("Unable to create file: " + path);
+}
+
+/**
+ * @brief Main Terminator
+ */
+ArffWriter::~ArffWriter()
+{
+	if (_writer.is_open()) _writer.close();
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write the header of the file
+ * @param name The name of the relation that we are saving
+ * @param description The description of the relation
+ * @param paramCount The number of input parameters
+ */
+void ArffWriter::WriteHeader(const string& name, const string& description, int paramCount)
+{
+	RenderHeader(_writer, name, description, paramCount);
+}
+
+/**
+ * @brief Write a set of records, where the last column of each row is the class
+ * @param data The records that we are writing
+ */
+void ArffWriter::WriteRows(Mat& data)
+{
+	Mat outputs; WriteRows(data, outputs);
+}
+
+/**
+ * @brief Write a set of records made up of the input columns followed by the output columns.
+ * The records are cut into blocks, a wave of blocks is formatted in parallel (one block per thread),
+ * and the formatted blocks are then written out in order.
+ * @param inputs The input part of each record
+ * @param outputs The output part of each record (may be empty)
+ */
+void ArffWriter::WriteRows(Mat& inputs, Mat& outputs)
+{
+	if (!outputs.empty() && outputs.rows != inputs.rows) throw runtime_error("The inputs and outputs have different row counts");
+
+	auto blockCount = (inputs.rows + BLOCK_ROWS - 1) / BLOCK_ROWS;
+
+	for (auto first = 0; first < blockCount; first += _threadCount)
+	{
+		auto count = min(_threadCount, blockCount - first);
+
+		ParallelUtils::Run(count, [&](int index)
+		{
+			auto start = (first + index) * BLOCK_ROWS;
+			RenderRows(inputs, outputs, start, min(start + BLOCK_ROWS, inputs.rows), _blocks[index]);
+		});
+
+		for (auto i = 0; i < count; i++) _writer.write(_blocks[i].data(), _blocks[i].size());
+	}
+}
+
+/**
+ * @brief Flush and close the file
+ */
+void ArffWriter::Close()
+{
+	_writer.close();
+	if (_writer.fail()) throw runtime_error("Unable to write file: " + _path);
+}
+
+//--------------------------------------------------
+// Rendering
+//--------------------------------------------------
+
+/**
+ * @brief The header of the ARFF file
+ * @param writer The writer that we are dealing with
+ * @param name The name of the relation that we are saving
+ * @param description The description of the project
+ * @param paramCount The number of inputs parameters
+ */
+void ArffWriter::RenderHeader(ostream& writer, const string &name, const string& description, int paramCount)
+{
+	writer << "%----------------------------------------------" << "\n";
+	writer << "% " << description << "\n";
+	writer << "%" << "\n";
+	writer << "% @author: NeuralMLP " << "\n";
+	writer << "%----------------------------------------------" << "\n";
+	writer << "\n";
+	writer << "@RELATION " << name << "\n";
+	writer << "\n";
+
+	for (auto i = 0; i < paramCount; i++) writer << "@ATTRIBUTE p[" << i << "] REAL" << "\n";
+	writer << "@ATTRIBUTE class REAL" << "\n" << "\n";
+
+	writer << "@DATA" << "\n";
+}
+
+/**
+ * @brief Format a range of records as text
+ * @param inputs The input part of each record
+ * @param outputs The output part of each record (may be empty)
+ * @param start The first record that we are formatting
+ * @param end The record after the last one that we are formatting
+ * @param text The text that the records are written to
+ */
+void ArffWriter::RenderRows(Mat& inputs, Mat& outputs, int start, int end, string& text)
+{
+	text.clear();
+
+	for (auto row = start; row < end; row++)
+	{
+		for (auto column = 0; column < inputs.cols; column++)
+		{
+			if (column != 0) text.push_back(',');
+			RenderValue(inputs, row, column, text);
+		}
+
+		for (auto column = 0; column < outputs.cols; column++)
+		{
+			text.push_back(',');
+			RenderValue(outputs, row, column, text);
+		}
+
+		text.push_back('\n');
+	}
+}
+
+/**
+ * @brief Format a single value with the shortest text that reads back to the same value
+ * @param data The matrix that holds the value
+ * @param row The row of the value
+ * @param column The column of the value
+ * @param text The text that the value is appended to
+ */
+void ArffWriter::RenderValue(const Mat& data, int row, int column, string& text)
+{
+	char number[32]; auto end = number;
+
+	switch (data.depth())
+	{
+		case CV_64F:
+			end = to_chars(number, number + sizeof(number), data.ptr<double>(row)[column]).ptr;
+			break;
+		case CV_32F:
+		{
+			// Values are read back as doubles and then narrowed, and in rare cases the shortest float text sits
+			// close enough to a rounding boundary that this lands on a neighbouring float, so those are written in full
+			auto value = data.ptr<float>(row)[column]; auto check = 0.0;
+			end = to_chars(number, number + sizeof(number), value).ptr;
+			from_chars(number, end, check);
+			if ((float) check != value) end = to_chars(number, number + sizeof(number), (double) value).ptr;
+			break;
+		}
+		case CV_32S:
+			end = to_chars(number, number + sizeof(number), data.ptr<int>(row)[column]).ptr;
+			break;
+		default:
+			throw runtime_error("Only int, float and double data can be written to an ARFF file");
+	}
+
+	text.append(number, end);
+}
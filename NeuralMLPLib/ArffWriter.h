@@ -0,0 +1,44 @@
+//--------------------------------------------------
+// A buffered writer for ARFF files that formats blocks of records in parallel
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <fstream>
+#include <charconv>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ParallelUtils.h"
+
+namespace NVL_AI
+{
+	class ArffWriter
+	{
+	private:
+		ofstream _writer;
+		string _path;
+		int _threadCount;
+		vector<string> _blocks;
+	public:
+		ArffWriter(const string& path, int threadCount = 1);
+		~ArffWriter();
+
+		void WriteHeader(const string& name, const string& description, int paramCount);
+		void WriteRows(Mat& data);
+		void WriteRows(Mat& inputs, Mat& outputs);
+		void Close();
+
+		static void RenderHeader(ostream& writer, const string& name, const string& description, int paramCount);
+	private:
+		static void RenderRows(Mat& inputs, Mat& outputs, int start, int end, string& text);
+		static void RenderValue(const Mat& data, int row, int column, string& text);
+	};
+}
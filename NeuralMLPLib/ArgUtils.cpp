@@ -18,12 +18,13 @@ using namespace NVL_App;
  * @param appName The name of the application
  * @param argc The number of incomming parameter arguments
  * @param argv The incomming variables
+ * @param defaultPath The configuration file that is used when none is given
  * @return NVLib::Parameters * Returns a NVLib::Parameters *
  */
-NVLib::Parameters * ArgUtils::Load(const string& appName, int argc, char ** argv)
+NVLib::Parameters * ArgUtils::Load(const string& appName, int argc, char ** argv, const string& defaultPath)
 {
-	if (argc > 2) throw runtime_error(NVLib::Formatter() << "Usage: " << appName << " <config.xml>");
-	auto configPath = argc == 1 ? string("config.xml") : string(argv[1]);
+	if (argc > 2) throw runtime_error(NVLib::Formatter() << "Usage: " << appName << " <" << defaultPath << ">");
+	auto configPath = argc == 1 ? defaultPath : string(argv[1]);
 	return NVLib::ParameterLoader::Load(configPath);
 }
 
@@ -83,3 +84,60 @@ bool ArgUtils::GetBoolean(NVLib::Parameters * parameters, const string& key)
 	auto value = parameters->Get(key);
 	return NVLib::StringUtils::String2Bool(value);
 }
+
+//--------------------------------------------------
+// Extract Optional Parameter Values
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the given string value, falling back to a default if it is missing
+ * @param parameters The parameters that we are extracting from
+ * @param key The key value that we are extracting
+ * @param defaultValue The value returned when the key is missing
+ * @return string The string value
+ */
+string ArgUtils::GetString(NVLib::Parameters * parameters, const string& key, const string& defaultValue) 
+{
+	if (!parameters->Contains(key)) return defaultValue;
+	return GetString(parameters, key);
+}
+
+/**
+ * @brief Retrieve the given integer value, falling back to a default if it is missing
+ * @param parameters The parameters that we are extracting from
+ * @param key The key value that we are extracting 
+ * @param defaultValue The value returned when the key is missing
+ * @return int The integer value that we are extracting
+ */
+int ArgUtils::GetInteger(NVLib::Parameters * parameters, const string& key, int defaultValue) 
+{
+	if (!parameters->Contains(key)) return defaultValue;
+	return GetInteger(parameters, key);
+}
+
+/**
+ * @brief Retrieve the given double value, falling back to a default if it is missing
+ * @param parameters The parameters that we are extracting from
+ * @param key The key value that we are extracting 
+ * @param defaultValue The value returned when the key is missing
+ * @return double The double value that is being extracted
+ */
+double ArgUtils::GetDouble(NVLib::Parameters * parameters, const string& key, double defaultValue) 
+{
+	if (!parameters->Contains(key)) return defaultValue;
+	return GetDouble(parameters, key);
+}
+
+/**
+ * @brief Retrieve the given boolean value, falling back to a default if it is missing
+ * @param parameters The parameters that we are extracting from
+ * @param key The given key value
+ * @param defaultValue The value returned when the key is missing
+ * @return true If the value is true
+ * @return false If the value is false
+ */
+bool ArgUtils::GetBoolean(NVLib::Parameters * parameters, const string& key, bool defaultValue) 
+{
+	if (!parameters->Contains(key)) return defaultValue;
+	return GetBoolean(parameters, key);
+}
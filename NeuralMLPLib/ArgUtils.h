@@ -20,11 +20,16 @@ namespace NVL_App
 	class ArgUtils
 	{
 	public:
-		static NVLib::Parameters * Load(const string& appName, int argc, char ** argv);
+		static NVLib::Parameters * Load(const string& appName, int argc, char ** argv, const string& defaultPath = "config.xml");
 
 		static string GetString(NVLib::Parameters * parameters, const string& key);
 		static int GetInteger(NVLib::Parameters * parameters, const string& key);
 		static double GetDouble(NVLib::Parameters * parameters, const string& key);
 		static bool GetBoolean(NVLib::Parameters * parameters, const string& key);
+
+		static string GetString(NVLib::Parameters * parameters, const string& key, const string& defaultValue);
+		static int GetInteger(NVLib::Parameters * parameters, const string& key, int defaultValue);
+		static double GetDouble(NVLib::Parameters * parameters, const string& key, double defaultValue);
+		static bool GetBoolean(NVLib::Parameters * parameters, const string& key, bool defaultValue);
 	};
 }
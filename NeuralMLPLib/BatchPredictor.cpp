@@ -0,0 +1,101 @@
+//--------------------------------------------------
+// Implementation of class BatchPredictor
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "BatchPredictor.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param network The network that predictions are made with
+ * @param batchSize The number of rows that are read, predicted and written together
+ * @param threadCount The number of threads that batches are parsed and formatted with (0 uses every core)
+ */
+BatchPredictor::BatchPredictor(Ptr<Network> network, int batchSize, int threadCount) : _network(network), _batchSize(batchSize)
+{
+	if (batchSize < 1) throw runtime_error("The batch size must be at least 1");
+	_threadCount = ParallelUtils::GetThreadCount(threadCount);
+}
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Predict every record of an ARFF file, writing the inputs and the predicted class to a new ARFF file.
+ * Each batch is parsed into the same buffers, predicted by the network (which splits the rows across its own
+ * prediction threads) and then formatted out, so memory use depends on the batch size and not the file size.
+ * @param inputPath The path to the ARFF file with the records
+ * @param outputPath The path that the predictions are written to
+ * @return PredictStats The throughput and the per-batch prediction latencies (in milliseconds)
+ */
+PredictStats BatchPredictor::Run(const string& inputPath, const string& outputPath)
+{
+	auto start = chrono::steady_clock::now();
+
+	auto reader = ArffReader(inputPath, _threadCount); reader.Open();
+	auto inputCount = (int) reader.GetFieldNames().size();
+
+	_inputs.create(_batchSize, inputCount, CV_32F); _labels.create(_batchSize, 1, CV_32F);
+	_latencies.clear();
+
+	auto writer = ArffWriter(outputPath, _threadCount);
+	writer.WriteHeader("predictions", "Predictions for " + inputPath, inputCount);
+
+	auto result = PredictStats();
+
+	while (true)
+	{
+		auto rows = reader.ReadBatch(_inputs, _labels);
+		if (rows == 0) break;
+
+		Mat inputs = _inputs.rowRange(0, rows);
+
+		auto predictStart = chrono::steady_clock::now();
+		_network->Predict(inputs, _predictions);
+		_latencies.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - predictStart).count());
+
+		writer.WriteRows(inputs, _predictions);
+		result.Rows += rows; result.Batches++;
+	}
+
+	writer.Close();
+
+	result.Seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	result.RowsPerSecond = result.Seconds > 0 ? result.Rows / result.Seconds : 0;
+	result.LatencyP50 = GetPercentile(_latencies, 0.5);
+	result.LatencyP90 = GetPercentile(_latencies, 0.9);
+	result.LatencyP99 = GetPercentile(_latencies, 0.99);
+	result.LatencyMax = GetPercentile(_latencies, 1.0);
+
+	return result;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find a percentile of a set of values (nearest rank). The values are reordered.
+ * @param values The values
+ * @param percentile The percentile as a fraction (0.5 is the median)
+ * @return double The resultant value (0 if there are no values)
+ */
+double BatchPredictor::GetPercentile(vector<double>& values, double percentile)
+{
+	if (values.empty()) return 0;
+
+	auto rank = (size_t) ceil(percentile * values.size());
+	auto index = rank == 0 ? 0 : min(values.size(), rank) - 1;
+
+	nth_element(values.begin(), values.begin() + index, values.end());
+	return values[index];
+}
@@ -0,0 +1,56 @@
+//--------------------------------------------------
+// Streams an ARFF file through a network in fixed-size batches, writing the predictions as it goes
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Network.h"
+#include "ArffReader.h"
+#include "ArffWriter.h"
+
+namespace NVL_AI
+{
+	struct PredictStats
+	{
+		int Rows = 0;
+		int Batches = 0;
+		double Seconds = 0;
+		double RowsPerSecond = 0;
+		double LatencyP50 = 0;
+		double LatencyP90 = 0;
+		double LatencyP99 = 0;
+		double LatencyMax = 0;
+	};
+
+	class BatchPredictor
+	{
+	private:
+		Ptr<Network> _network;
+		int _batchSize;
+		int _threadCount;
+		Mat _inputs;
+		Mat _labels;
+		Mat _predictions;
+		vector<double> _latencies;
+	public:
+		BatchPredictor(Ptr<Network> network, int batchSize, int threadCount = 0);
+
+		PredictStats Run(const string& inputPath, const string& outputPath);
+
+		inline int GetBatchSize() { return _batchSize; }
+
+		static double GetPercentile(vector<double>& values, double percentile);
+	};
+}
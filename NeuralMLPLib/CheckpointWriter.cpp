@@ -0,0 +1,243 @@
+//--------------------------------------------------
+// Implementation of class CheckpointWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "CheckpointWriter.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, starts the writer thread
+ * @param path The path that checkpoints are saved to
+ */
+CheckpointWriter::CheckpointWriter(const string& path) : _path(path), _stateChanged(false), _submitted(false), _writing(false), _stopping(false), _writeCount(0), _skipCount(0), _lastWriteSeconds(0), _writeSeconds(0)
+{
+	_worker = thread(&CheckpointWriter::Run, this);
+}
+
+/**
+ * @brief Main Terminator, writes the last snapshot (if there is one waiting) and stops the writer thread
+ */
+CheckpointWriter::~CheckpointWriter()
+{
+	{
+		lock_guard<mutex> guard(_lock);
+		_stopping = true;
+	}
+
+	_changed.notify_all();
+	_worker.join();
+}
+
+//--------------------------------------------------
+// Submit
+//--------------------------------------------------
+
+/**
+ * @brief Set the details of the run that go into every saved state (they are kept here, so that the calls made on
+ * each iteration only pass numbers and never copy strings on the training thread). Set them before submitting the
+ * snapshots that they describe.
+ * @param metric The metric that the score is measured in
+ * @param data The path of the data that is being trained on
+ * @param rows The number of rows that are being trained on
+ */
+void CheckpointWriter::SetRun(const string& metric, const string& data, int rows)
+{
+	lock_guard<mutex> guard(_lock);
+	_pendingState.Metric = metric; _pendingState.Data = data; _pendingState.Rows = rows;
+}
+
+/**
+ * @brief Hand a snapshot over to the writer thread. This never waits on the disk: if the previous snapshot
+ * has not been picked up yet then it is replaced (and counted as skipped), since only the newest one matters.
+ * The training state (the details given to SetRun and the numbers given here) is saved beside it so that the run
+ * can be resumed; nothing is saved for a snapshot without an iteration.
+ * @param snapshot The snapshot of the model that is being saved
+ * @param iteration The last completed iteration
+ * @param bestIteration The iteration that the snapshot was taken at
+ * @param score The best score, which the snapshot holds
+ */
+void CheckpointWriter::Submit(Ptr<ModelData> snapshot, int iteration, int bestIteration, double score)
+{
+	{
+		lock_guard<mutex> guard(_lock);
+		if (_pending != nullptr) _skipCount++;
+		_pending = snapshot; _stateChanged = true; _submitted = true;
+		_pendingState.Iteration = iteration; _pendingState.BestIteration = bestIteration; _pendingState.Score = score;
+	}
+
+	_changed.notify_all();
+}
+
+/**
+ * @brief Hand over a newer training state for the last snapshot, so that the iterations that ran since it was
+ * submitted are saved too (and a resumed run does not repeat them). The state is written by itself, without the
+ * model, and only once this writer has been given a snapshot (so it never describes a model that was not saved).
+ * This is called on every iteration, so it makes no heap allocations.
+ * @param iteration The last completed iteration
+ * @param bestIteration The iteration of the best score (which the snapshot holds)
+ * @param score The best score
+ */
+void CheckpointWriter::Update(int iteration, int bestIteration, double score)
+{
+	{
+		lock_guard<mutex> guard(_lock);
+		if (!_submitted) return;
+		_pendingState.Iteration = iteration; _pendingState.BestIteration = bestIteration; _pendingState.Score = score; _stateChanged = true;
+	}
+
+	_changed.notify_all();
+}
+
+/**
+ * @brief Wait until every submitted snapshot has been dealt with, re-throwing the first write failure
+ */
+void CheckpointWriter::Flush()
+{
+	unique_lock<mutex> guard(_lock);
+	_changed.wait(guard, [this]() { return _pending == nullptr && !_stateChanged && !_writing; });
+
+	if (_error != nullptr)
+	{
+		auto error = _error; _error = nullptr;
+		rethrow_exception(error);
+	}
+}
+
+//--------------------------------------------------
+// Writer Thread
+//--------------------------------------------------
+
+/**
+ * @brief The writer thread loop, which takes the newest snapshot (or state) and saves it
+ */
+void CheckpointWriter::Run()
+{
+	AllocationCounter::MarkBackground();
+
+	while (true)
+	{
+		Ptr<ModelData> snapshot; CheckpointState state;
+
+		{
+			unique_lock<mutex> guard(_lock);
+			_changed.wait(guard, [this]() { return _pending != nullptr || _stateChanged || _stopping; });
+			if (_pending == nullptr && !_stateChanged) return;
+
+			snapshot = _pending; state = _pendingState; _pending.reset(); _stateChanged = false; _writing = true;
+		}
+
+		exception_ptr error;
+		try { Write(snapshot, state); } catch (...) { error = current_exception(); }
+
+		{
+			lock_guard<mutex> guard(_lock);
+			_writing = false;
+			if (error != nullptr && _error == nullptr) _error = error;
+		}
+
+		_changed.notify_all();
+	}
+}
+
+/**
+ * @brief Save a snapshot to a temporary file and then rename it over the checkpoint, so that the checkpoint
+ * on disk is always a complete model. Paths with the binary model extension get the binary format. The state
+ * goes in after the model, so a crash between the two leaves a state that is older than the model (and a resumed
+ * run repeats a few iterations) rather than one that is newer.
+ * @param snapshot The snapshot that is being saved (nullptr when only the state has changed)
+ * @param state The training state that goes with it
+ */
+void CheckpointWriter::Write(Ptr<ModelData>& snapshot, CheckpointState& state)
+{
+	if (snapshot == nullptr) { if (state.Iteration >= 0) WriteState(GetStatePath(_path), state); return; }
+
+	auto start = chrono::steady_clock::now();
+	auto tempPath = _path + ".tmp";
+
+	NeuralUtils::SaveModel(tempPath, *snapshot, ModelFile::IsBinaryPath(_path));
+
+	if (rename(tempPath.c_str(), _path.c_str()) != 0) throw runtime_error(NVLib::Formatter() << "Unable to move checkpoint into place: " << _path);
+	if (state.Iteration >= 0) WriteState(GetStatePath(_path), state);
+	_writeCount++;
+
+	auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	_lastWriteSeconds = seconds; _writeSeconds = _writeSeconds + seconds;
+}
+
+//--------------------------------------------------
+// State
+//--------------------------------------------------
+
+/**
+ * @brief Find the path of the state file that sits beside a checkpoint
+ * @param path The path of the checkpoint
+ * @return string The path of its state file
+ */
+string CheckpointWriter::GetStatePath(const string& path)
+{
+	return path + ".state";
+}
+
+/**
+ * @brief Save a training state as "key value" lines, through a temporary file so that it is never half written
+ * @param path The path that we are saving to
+ * @param state The state that is being saved
+ */
+void CheckpointWriter::WriteState(const string& path, const CheckpointState& state)
+{
+	auto tempPath = path + ".tmp";
+
+	{
+		auto writer = ofstream(tempPath);
+		if (!writer.is_open()) throw runtime_error("Unable to write the training state: " + path);
+
+		writer.precision(17);
+		writer << "iteration " << state.Iteration << endl << "best_iteration " << state.BestIteration << endl << "score " << state.Score << endl;
+		writer << "metric " << state.Metric << endl << "data " << state.Data << endl << "rows " << state.Rows << endl;
+		if (!writer.good()) throw runtime_error("Unable to write the training state: " + path);
+	}
+
+	if (rename(tempPath.c_str(), path.c_str()) != 0) throw runtime_error(NVLib::Formatter() << "Unable to move the training state into place: " << path);
+}
+
+/**
+ * @brief Load a training state, if there is one
+ * @param path The path of the state file
+ * @param state The state that was loaded
+ * @return bool True if a complete state was found (a damaged file counts as no state)
+ */
+bool CheckpointWriter::ReadState(const string& path, CheckpointState& state)
+{
+	auto reader = ifstream(path);
+	if (!reader.is_open()) return false;
+
+	auto result = CheckpointState(); auto line = string(); auto found = 0;
+	while (getline(reader, line))
+	{
+		auto split = line.find(' '); if (split == string::npos) continue;
+		auto key = line.substr(0, split); auto value = line.substr(split + 1);
+
+		try
+		{
+			if (key == "iteration") { result.Iteration = stoi(value); found++; }
+			else if (key == "best_iteration") { result.BestIteration = stoi(value); found++; }
+			else if (key == "score") { result.Score = stod(value); found++; }
+			else if (key == "metric") { result.Metric = value; found++; }
+			else if (key == "data") { result.Data = value; found++; }
+			else if (key == "rows") { result.Rows = stoi(value); found++; }
+		}
+		catch (logic_error&) { return false; }
+	}
+
+	if (found < 6 || result.Iteration < 0 || result.BestIteration < 0) return false;
+
+	state = result; return true;
+}
@@ -0,0 +1,83 @@
+//--------------------------------------------------
+// Saves model snapshots on a background thread, so that training never waits on the disk
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <iostream>
+#include <exception>
+#include <condition_variable>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "ModelData.h"
+#include "AllocationCounter.h"
+#include "NeuralUtils.h"
+
+namespace NVL_AI
+{
+	struct CheckpointState
+	{
+		int Iteration = -1;
+		int BestIteration = -1;
+		double Score = 0;
+		string Metric;
+		string Data;
+		int Rows = 0;
+	};
+
+	class CheckpointWriter
+	{
+	private:
+		string _path;
+		mutex _lock;
+		condition_variable _changed;
+		Ptr<ModelData> _pending;
+		CheckpointState _pendingState;
+		bool _stateChanged;
+		bool _submitted;
+		bool _writing;
+		bool _stopping;
+		atomic<int> _writeCount;
+		atomic<int> _skipCount;
+		atomic<double> _lastWriteSeconds;
+		atomic<double> _writeSeconds;
+		exception_ptr _error;
+		thread _worker;
+	public:
+		CheckpointWriter(const string& path);
+		~CheckpointWriter();
+
+		void SetRun(const string& metric, const string& data, int rows);
+		void Submit(Ptr<ModelData> snapshot, int iteration = -1, int bestIteration = -1, double score = 0);
+		void Update(int iteration, int bestIteration, double score);
+		void Flush();
+
+		inline string& GetPath() { return _path; }
+		inline int GetWriteCount() { return _writeCount; }
+		inline int GetSkipCount() { return _skipCount; }
+		inline double GetLastWriteSeconds() { return _lastWriteSeconds; }
+		inline double GetWriteSeconds() { return _writeSeconds; }
+
+		static string GetStatePath(const string& path);
+		static void WriteState(const string& path, const CheckpointState& state);
+		static bool ReadState(const string& path, CheckpointState& state);
+	private:
+		void Run();
+		void Write(Ptr<ModelData>& snapshot, CheckpointState& state);
+	};
+}
@@ -0,0 +1,190 @@
+//--------------------------------------------------
+// Implementation of class CodeGenerator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "CodeGenerator.h"
+using namespace NVL_AI;
+
+// The number of values that are written on each line of a weight array
+#define VALUES_PER_LINE 8
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param model The model that we are generating a predictor for
+ * @param className The name of the generated class
+ * @param nameSpace The namespace that the generated class lives in
+ */
+CodeGenerator::CodeGenerator(Ptr<ModelData> model, const string& className, const string& nameSpace) : _model(model), _className(className), _namespace(nameSpace)
+{
+	if (!IsIdentifier(className)) throw runtime_error("Not a valid class name: " + className);
+	if (!IsIdentifier(nameSpace)) throw runtime_error("Not a valid namespace: " + nameSpace);
+	if (model->GetLayerSizes().size() < 2) throw runtime_error("A model needs at least an input and an output layer");
+}
+
+//--------------------------------------------------
+// Generate
+//--------------------------------------------------
+
+/**
+ * @brief Generate the predictor. Every layer size is a constexpr, the weights are std::array constants and the
+ * activations live in two stack buffers, so a prediction never touches the heap and the compiler sees the trip count
+ * of every loop (which lets it unroll the input loop and vectorize the output loop of each layer).
+ * @param sourceName The name of the model file (for the header comment)
+ * @return string The text of the header
+ */
+string CodeGenerator::Generate(const string& sourceName)
+{
+	auto& sizes = _model->GetLayerSizes(); auto layerCount = (int) sizes.size();
+	auto width = *max_element(sizes.begin(), sizes.end());
+
+	auto writer = stringstream();
+	writer << "//--------------------------------------------------" << endl;
+	writer << "// A fixed-topology predictor generated by NeuralMLPCodeGen" << (sourceName.empty() ? string() : " from " + sourceName) << endl;
+	writer << "//" << endl;
+	writer << "// Do not edit: generate it again when the model changes" << endl;
+	writer << "//--------------------------------------------------" << endl << endl;
+	writer << "#pragma once" << endl << endl;
+	writer << "#include <array>" << endl << "#include <cmath>" << endl << "#include <cstddef>" << endl << "#include <cstdint>" << endl << "#include <cstring>" << endl << endl;
+
+	writer << "namespace " << _namespace << endl << "{" << endl;
+	writer << "\tclass " << _className << endl << "\t{" << endl << "\tpublic:" << endl;
+	writer << "\t\tstatic constexpr std::size_t InputCount = " << sizes.front() << ";" << endl;
+	writer << "\t\tstatic constexpr std::size_t OutputCount = " << sizes.back() << ";" << endl;
+	writer << "\t\tstatic constexpr std::size_t LayerCount = " << layerCount << ";" << endl;
+	writer << "\t\tstatic constexpr std::array<std::size_t, LayerCount> LayerSizes = {{ ";
+	for (auto i = 0; i < layerCount; i++) writer << (i > 0 ? ", " : "") << sizes[i];
+	writer << " }};" << endl;
+	writer << "\t\tstatic constexpr float Alpha = " << GetLiteral(_model->GetAlpha()) << ";" << endl;
+	writer << "\t\tstatic constexpr float Beta = " << GetLiteral(_model->GetBeta()) << ";" << endl << endl;
+
+	writer << "\t\t/**" << endl << "\t\t * @brief Run the network over a single row" << endl;
+	writer << "\t\t * @param inputs The inputs (InputCount values)" << endl << "\t\t * @param outputs The resultant outputs (OutputCount values)" << endl << "\t\t */" << endl;
+	writer << "\t\tstatic inline void Predict(const float * inputs, float * outputs)" << endl << "\t\t{" << endl;
+	writer << "\t\t\talignas(64) std::array<float, " << width << "> first; alignas(64) std::array<float, " << width << "> second;" << endl << endl;
+	writer << "\t\t\tfor (std::size_t j = 0; j < InputCount; j++) first[j] = inputs[j] * InputScale[2 * j] + InputScale[2 * j + 1];" << endl;
+	for (auto i = 1; i < layerCount; i++)
+	{
+		auto input = i % 2 == 1 ? "first" : "second"; auto output = i % 2 == 1 ? "second" : "first";
+		writer << "\t\t\tLayer<" << sizes[i - 1] << ", " << sizes[i] << ">(Weights" << i << ", " << input << ".data(), " << output << ".data());" << endl;
+	}
+	writer << "\t\t\tfor (std::size_t j = 0; j < OutputCount; j++) outputs[j] = " << (layerCount % 2 == 0 ? "second" : "first") << "[j] * OutputScale[2 * j] + OutputScale[2 * j + 1];" << endl;
+	writer << "\t\t}" << endl << endl;
+
+	writer << "\t\t/**" << endl << "\t\t * @brief Run the network over a block of rows" << endl;
+	writer << "\t\t * @param inputs The inputs (rows x InputCount values)" << endl << "\t\t * @param outputs The resultant outputs (rows x OutputCount values)" << endl;
+	writer << "\t\t * @param rows The number of rows" << endl << "\t\t */" << endl;
+	writer << "\t\tstatic inline void Predict(const float * inputs, float * outputs, std::size_t rows)" << endl << "\t\t{" << endl;
+	writer << "\t\t\tfor (std::size_t row = 0; row < rows; row++) Predict(inputs + row * InputCount, outputs + row * OutputCount);" << endl;
+	writer << "\t\t}" << endl << "\tprivate:" << endl;
+
+	writer << "\t\t/**" << endl << "\t\t * @brief Run one layer: the bias row, the weighted inputs and then ANN_MLP's symmetric sigmoid" << endl;
+	writer << "\t\t * @param weights The weights of the layer ((N1 + 1) x N2, with the bias in the last row)" << endl;
+	writer << "\t\t * @param input The outputs of the layer before (N1 values)" << endl << "\t\t * @param output The outputs of this layer (N2 values)" << endl << "\t\t */" << endl;
+	writer << "\t\ttemplate <std::size_t N1, std::size_t N2>" << endl;
+	writer << "\t\tstatic inline void Layer(const std::array<float, (N1 + 1) * N2>& weights, const float * input, float * output)" << endl << "\t\t{" << endl;
+	writer << "\t\t\tfor (std::size_t j = 0; j < N2; j++) output[j] = weights[N1 * N2 + j];" << endl << endl;
+	writer << "#pragma GCC unroll 1024" << endl;
+	writer << "\t\t\tfor (std::size_t k = 0; k < N1; k++)" << endl << "\t\t\t{" << endl;
+	writer << "\t\t\t\tconst float x = input[k];" << endl;
+	writer << "\t\t\t\tfor (std::size_t j = 0; j < N2; j++) output[j] += x * weights[k * N2 + j];" << endl;
+	writer << "\t\t\t}" << endl << endl;
+	writer << "\t\t\tfor (std::size_t j = 0; j < N2; j++) { const float e = Exp(-Alpha * output[j]); output[j] = Beta * (1.0f - e) / (1.0f + e); }" << endl;
+	writer << "\t\t}" << endl << endl;
+
+	writer << "\t\t/**" << endl << "\t\t * @brief The exponential used by the native backend (Cephes range reduction and polynomial), written without" << endl;
+	writer << "\t\t * branches or library calls so that the activation loop vectorizes" << endl;
+	writer << "\t\t * @param x The value" << endl << "\t\t * @return float The exponential of the value" << endl << "\t\t */" << endl;
+	writer << "\t\tstatic inline float Exp(float x)" << endl << "\t\t{" << endl;
+	writer << "\t\t\tx = x < -87.3f ? -87.3f : (x > 88.3f ? 88.3f : x);" << endl;
+	writer << "\t\t\tconst float n = std::floor(x * 1.44269504088896341f + 0.5f);" << endl;
+	writer << "\t\t\tx = x - n * 0.693359375f; x = x - n * -2.12194440e-4f;" << endl << endl;
+	writer << "\t\t\tfloat y = 1.9875691500e-4f;" << endl;
+	writer << "\t\t\ty = y * x + 1.3981999507e-3f; y = y * x + 8.3334519073e-3f; y = y * x + 4.1665795894e-2f;" << endl;
+	writer << "\t\t\ty = y * x + 1.6666665459e-1f; y = y * x + 5.0000001201e-1f; y = y * (x * x) + (x + 1.0f);" << endl << endl;
+	writer << "\t\t\tconst std::int32_t bits = (static_cast<std::int32_t>(n) + 127) << 23;" << endl;
+	writer << "\t\t\tfloat scale; std::memcpy(&scale, &bits, sizeof(float));" << endl;
+	writer << "\t\t\treturn y * scale;" << endl;
+	writer << "\t\t}" << endl << endl;
+
+	WriteArray(writer, "InputScale", _model->GetInputScale());
+	WriteArray(writer, "OutputScale", _model->GetOutputScale());
+	for (auto i = 1; i < layerCount; i++) WriteArray(writer, NVLib::Formatter() << "Weights" << i, _model->GetWeights(i));
+
+	writer << "\t};" << endl << "}" << endl;
+	return writer.str();
+}
+
+/**
+ * @brief Generate the predictor and write it to disk (through a temporary file, so a build never sees half a header)
+ * @param path The path to the header
+ * @param sourceName The name of the model file (for the header comment)
+ */
+void CodeGenerator::Write(const string& path, const string& sourceName)
+{
+	auto text = Generate(sourceName);
+
+	auto tempPath = path + ".tmp";
+	auto writer = ofstream(tempPath);
+	if (!writer.is_open()) throw runtime_error("Unable to create file: " + tempPath);
+	writer << text;
+
+	writer.close();
+	if (writer.fail()) { remove(tempPath.c_str()); throw runtime_error("Unable to write file: " + tempPath); }
+	if (rename(tempPath.c_str(), path.c_str()) != 0) { remove(tempPath.c_str()); throw runtime_error("Unable to create file: " + path); }
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Check that a name can be used as a C++ identifier
+ * @param name The name that we are checking
+ * @return bool True if the name is a valid identifier
+ */
+bool CodeGenerator::IsIdentifier(const string& name)
+{
+	if (name.empty() || isdigit((unsigned char) name[0])) return false;
+	for (auto c : name) if (!isalnum((unsigned char) c) && c != '_') return false;
+	return true;
+}
+
+/**
+ * @brief Write a block of weights as a constexpr float array
+ * @param writer The writer that we are writing to
+ * @param name The name of the array
+ * @param values The values (double, in row-major order)
+ */
+void CodeGenerator::WriteArray(ostream& writer, const string& name, const Mat& values)
+{
+	Mat data; values.convertTo(data, CV_64F);
+	auto count = (int) data.total();
+
+	writer << "\t\tstatic constexpr std::array<float, " << count << "> " << name << " = {{";
+	for (auto i = 0; i < count; i++)
+	{
+		if (i % VALUES_PER_LINE == 0) writer << endl << "\t\t\t";
+		writer << GetLiteral(data.at<double>(i / data.cols, i % data.cols)) << (i + 1 < count ? ", " : "");
+	}
+	writer << endl << "\t\t}};" << endl << endl;
+}
+
+/**
+ * @brief Write a value as a float literal that reads back to the same float
+ * @param value The value
+ * @return string The literal
+ */
+string CodeGenerator::GetLiteral(double value)
+{
+	auto writer = stringstream();
+	writer << scientific << setprecision(9) << (float) value << "f";
+	return writer.str();
+}
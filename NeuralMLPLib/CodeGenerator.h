@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Writes a saved model out as a header-only C++ predictor that is specialized for its fixed topology
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "ModelData.h"
+
+namespace NVL_AI
+{
+	class CodeGenerator
+	{
+	private:
+		Ptr<ModelData> _model;
+		string _className;
+		string _namespace;
+	public:
+		CodeGenerator(Ptr<ModelData> model, const string& className, const string& nameSpace = "NVL_Generated");
+
+		string Generate(const string& sourceName = "");
+		void Write(const string& path, const string& sourceName = "");
+
+		inline string& GetClassName() { return _className; }
+		inline string& GetNamespace() { return _namespace; }
+
+		static bool IsIdentifier(const string& name);
+	private:
+		static void WriteArray(ostream& writer, const string& name, const Mat& values);
+		static string GetLiteral(double value);
+	};
+}
@@ -0,0 +1,145 @@
+//--------------------------------------------------
+// Implementation of class CrossValidator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "CrossValidator.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, deals the rows out to the folds at random. Each fold is a pair of views over the
+ * dataset (the rows that it holds out and the rest), so that no rows are copied.
+ * @param data The dataset that is being split
+ * @param settings The settings of the network that every fold trains
+ * @param foldCount The number of folds
+ * @param iterations The number of training iterations for each fold
+ * @param threadCount The number of folds trained at once (0 uses every core)
+ * @param seed The seed of the split
+ */
+CrossValidator::CrossValidator(TrainData * data, const NetworkSettings& settings, int foldCount, int iterations, int threadCount, unsigned int seed) : _data(data), _settings(settings), _iterations(iterations), _threadCount(threadCount)
+{
+	auto rowCount = data->GetRowCount();
+	if (foldCount < 2 || foldCount > rowCount) throw runtime_error(NVLib::Formatter() << "Cross validation needs between 2 and " << rowCount << " folds");
+
+	_settings.ThreadCount = 1;
+
+	auto order = vector<int>(rowCount);
+	for (auto i = 0; i < rowCount; i++) order[i] = data->IsView() ? data->GetRows()[i] : i;
+	shuffle(order.begin(), order.end(), mt19937(seed));
+
+	auto folds = vector<int>(data->GetInputs().rows, -1);
+	for (auto i = 0; i < rowCount; i++) folds[order[i]] = i % foldCount;
+
+	// The row lists are built in row order, so that each view walks through memory forwards
+	for (auto fold = 0; fold < foldCount; fold++)
+	{
+		auto trainRows = vector<int>(); auto testRows = vector<int>();
+		for (auto row = 0; row < (int) folds.size(); row++)
+		{
+			if (folds[row] == fold) testRows.push_back(row);
+			else if (folds[row] >= 0) trainRows.push_back(row);
+		}
+
+		_trainViews.push_back(Ptr<TrainData>(new TrainData(data, trainRows)));
+		_testViews.push_back(Ptr<TrainData>(new TrainData(data, testRows)));
+	}
+}
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Train and score every fold. The folds are trained on the work pool, each with a single-threaded network,
+ * so that the wall time on as many cores as folds is close to that of one fold.
+ * @return vector<FoldResult> The results of each fold
+ */
+vector<FoldResult> CrossValidator::Run()
+{
+	auto result = vector<FoldResult>(GetFoldCount());
+	auto pool = WorkPool(min(ParallelUtils::GetThreadCount(_threadCount), GetFoldCount()));
+
+	for (auto fold = 0; fold < GetFoldCount(); fold++)
+	{
+		auto& foldResult = result[fold];
+		pool.Submit([this, fold, &foldResult]() { RunFold(fold, foldResult); });
+	}
+	pool.Wait();
+
+	return result;
+}
+
+/**
+ * @brief Train a network on the rows outside a fold and score it against the rows inside it
+ * @param fold The index of the fold
+ * @param result The result that is written to
+ */
+void CrossValidator::RunFold(int fold, FoldResult& result)
+{
+	auto start = chrono::steady_clock::now();
+	auto trainData = GetTrainView(fold); auto testData = GetTestView(fold);
+
+	auto network = NetworkFactory::Create(_settings, _data->GetInputs().cols, _data->GetOutputs().cols);
+	network->Train(trainData, false);
+	for (auto i = 0; i < _iterations; i++) network->Train(trainData, true);
+
+	result.Fold = fold;
+	result.TrainRows = trainData->GetRowCount(); result.TestRows = testData->GetRowCount();
+	result.TrainScore = Scorer(trainData, 1).Evaluate(network);
+	result.TestScore = Scorer(testData, 1).Evaluate(network);
+	result.Seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+//--------------------------------------------------
+// Aggregate
+//--------------------------------------------------
+
+/**
+ * @brief Find the mean of the held out scores across the folds
+ * @param results The results of the folds
+ * @return Score The resultant mean of each metric
+ */
+Score CrossValidator::GetMean(const vector<FoldResult>& results)
+{
+	auto result = Score(); auto count = max(1.0, (double) results.size());
+
+	for (auto& fold : results)
+	{
+		result.Total += fold.TestScore.Total / count; result.MAE += fold.TestScore.MAE / count;
+		result.RMSE += fold.TestScore.RMSE / count; result.MaxError += fold.TestScore.MaxError / count;
+		result.R2 += fold.TestScore.R2 / count;
+	}
+
+	return result;
+}
+
+/**
+ * @brief Find the (sample) standard deviation of the held out scores across the folds
+ * @param results The results of the folds
+ * @return Score The resultant deviation of each metric
+ */
+Score CrossValidator::GetDeviation(const vector<FoldResult>& results)
+{
+	auto mean = GetMean(results); auto result = Score();
+	if (results.size() < 2) return result;
+
+	for (auto& fold : results)
+	{
+		result.Total += pow(fold.TestScore.Total - mean.Total, 2); result.MAE += pow(fold.TestScore.MAE - mean.MAE, 2);
+		result.RMSE += pow(fold.TestScore.RMSE - mean.RMSE, 2); result.MaxError += pow(fold.TestScore.MaxError - mean.MaxError, 2);
+		result.R2 += pow(fold.TestScore.R2 - mean.R2, 2);
+	}
+
+	auto count = results.size() - 1.0;
+	result.Total = sqrt(result.Total / count); result.MAE = sqrt(result.MAE / count);
+	result.RMSE = sqrt(result.RMSE / count); result.MaxError = sqrt(result.MaxError / count);
+	result.R2 = sqrt(result.R2 / count);
+	return result;
+}
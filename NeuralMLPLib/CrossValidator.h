@@ -0,0 +1,63 @@
+//--------------------------------------------------
+// Runs k-fold cross validation, training the folds side by side on views of the one dataset
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "Scorer.h"
+#include "WorkPool.h"
+#include "TrainData.h"
+#include "NetworkFactory.h"
+
+namespace NVL_AI
+{
+	struct FoldResult
+	{
+		int Fold = 0;
+		int TrainRows = 0;
+		int TestRows = 0;
+		Score TrainScore;
+		Score TestScore;
+		double Seconds = 0;
+	};
+
+	class CrossValidator
+	{
+	private:
+		TrainData * _data;
+		NetworkSettings _settings;
+		int _iterations;
+		int _threadCount;
+		vector<Ptr<TrainData>> _trainViews;
+		vector<Ptr<TrainData>> _testViews;
+	public:
+		CrossValidator(TrainData * data, const NetworkSettings& settings, int foldCount, int iterations, int threadCount = 0, unsigned int seed = 0x5eed);
+
+		vector<FoldResult> Run();
+
+		inline int GetFoldCount() { return (int) _testViews.size(); }
+		inline TrainData * GetTrainView(int fold) { return _trainViews[fold].get(); }
+		inline TrainData * GetTestView(int fold) { return _testViews[fold].get(); }
+
+		static Score GetMean(const vector<FoldResult>& results);
+		static Score GetDeviation(const vector<FoldResult>& results);
+	private:
+		void RunFold(int fold, FoldResult& result);
+	};
+}
@@ -0,0 +1,361 @@
+//--------------------------------------------------
+// Implementation of class DataCache
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "DataCache.h"
+#include "DatasetWriter.h"
+using namespace NVL_AI;
+
+// The identifiers of the cache file format
+#define CACHE_MAGIC "NMLPDATA"
+#define CACHE_VERSION 2
+
+// The extension of a stand-alone binary dataset (a cache file that has no ARFF source)
+#define BINARY_EXTENSION ".nmld"
+
+// The number of statistics that are stored for each column (mean, deviation, minimum and maximum)
+#define STATS_ROWS 4
+
+// The alignment of the data blocks within the cache file
+#define CACHE_ALIGNMENT 64
+
+// The number of blocks that are sampled from the source file to build its hash
+#define HASH_SAMPLES 64
+#define HASH_BLOCK_SIZE 4096
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param sourcePath The path to the ARFF file that is being cached
+ * @param threadCount The number of threads used to parse the ARFF file when the cache is stale
+ */
+DataCache::DataCache(const string& sourcePath, int threadCount) : _sourcePath(sourcePath), _threadCount(threadCount), _hit(false), _seconds(0)
+{
+	_cachePath = sourcePath + ".cache";
+}
+
+//--------------------------------------------------
+// Load
+//--------------------------------------------------
+
+/**
+ * @brief Load the dataset, mapping the cache file if it still matches the source and rebuilding it if it does not
+ * @return TrainData * The training data that was loaded
+ */
+TrainData * DataCache::Load()
+{
+	auto start = chrono::steady_clock::now();
+	_fieldNames.clear(); _hit = false;
+
+	auto source = GetSourceInfo(_sourcePath);
+
+	TrainData * result = nullptr;
+	try { result = Map(_cachePath, &source, _fieldNames); } catch (runtime_error&) { result = nullptr; }
+
+	if (result != nullptr) _hit = true;
+	else
+	{
+		auto reader = ArffReader(_sourcePath, _threadCount);
+		result = reader.Read(); _fieldNames = reader.GetFieldNames();
+
+		// The cache is only an optimization, so a folder that cannot be written to should not stop the load
+		try { Write(_cachePath, source, _fieldNames, result, _threadCount); } catch (runtime_error&) {}
+	}
+
+	_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	return result;
+}
+
+/**
+ * @brief Bring the cache file up to date without loading the dataset, for a caller that reads the cache itself
+ * (such as the shard reader). A stale cache is rebuilt by streaming the ARFF file through it a batch at a time:
+ * the records are counted first (so that the blocks can be laid out), then parsed and written batch by batch,
+ * so memory is set by the batch size rather than by the size of the dataset.
+ * @param batchRows The number of rows that are parsed at a time
+ */
+void DataCache::Stream(int batchRows)
+{
+	auto start = chrono::steady_clock::now();
+	_fieldNames.clear(); _hit = false;
+
+	auto source = GetSourceInfo(_sourcePath);
+
+	TrainData * cached = nullptr;
+	try { cached = Map(_cachePath, &source, _fieldNames); } catch (runtime_error&) { cached = nullptr; }
+
+	if (cached != nullptr) { _hit = true; delete cached; }
+	else
+	{
+		auto reader = ArffReader(_sourcePath, _threadCount);
+		reader.Open(false); _fieldNames = reader.GetFieldNames();
+		auto writer = DatasetWriter(_cachePath, source, _fieldNames, reader.CountRecords());
+
+		Mat inputs = Mat_<float>(max(1, batchRows), (int) _fieldNames.size()); Mat outputs = Mat_<float>(inputs.rows, 1);
+		for (auto rows = reader.ReadBatch(inputs, outputs); rows > 0; rows = reader.ReadBatch(inputs, outputs))
+		{
+			Mat batchInputs = inputs.rowRange(0, rows); Mat batchOutputs = outputs.rowRange(0, rows);
+			writer.WriteRows(batchInputs, batchOutputs);
+		}
+
+		writer.Close();
+	}
+
+	_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Map a cache file into memory and wrap its data blocks in training data (without copying)
+ * @param path The path to the cache file
+ * @param source The details of the source file that the cache must match (nullptr for a stand-alone dataset)
+ * @param fieldNames The names of the fields that were found
+ * @return TrainData * The training data, or nullptr if the file is missing parts or is out of date
+ */
+TrainData * DataCache::Map(const string& path, DataCacheHeader * source, vector<string>& fieldNames)
+{
+	auto file = Ptr<MappedFile>(new MappedFile(path, true));
+	if (file->GetSize() < sizeof(DataCacheHeader)) return nullptr;
+
+	auto header = (DataCacheHeader *) file->GetData();
+	if (!IsValid(*header, file->GetSize())) return nullptr;
+	if (source != nullptr && (header->SourceSize != source->SourceSize || header->SourceTime != source->SourceTime || header->SourceHash != source->SourceHash)) return nullptr;
+
+	auto names = file->GetData() + header->NamesOffset;
+	for (auto position = (uint64_t)0; position < header->NamesSize; )
+	{
+		auto name = string(names + position);
+		position += name.size() + 1; fieldNames.push_back(name);
+	}
+
+	Mat inputs = Mat((int)header->RowCount, (int)header->InputCount, CV_32F, file->GetData() + header->InputOffset);
+	Mat outputs = Mat((int)header->RowCount, (int)header->OutputCount, CV_32F, file->GetData() + header->OutputOffset);
+
+	auto stats = (double *) (file->GetData() + header->StatsOffset);
+	Mat inputStats = Mat(STATS_ROWS, (int)header->InputCount, CV_64F, stats);
+	Mat outputStats = Mat(STATS_ROWS, (int)header->OutputCount, CV_64F, stats + STATS_ROWS * header->InputCount);
+
+	auto result = new TrainData(inputs, outputs, file);
+	result->SetStats(inputStats, outputStats);
+	return result;
+}
+
+/**
+ * @brief Check that a header belongs to a cache file of this version and that its blocks fit inside the file
+ * @param header The header that we are checking
+ * @param fileSize The size of the file that it came from
+ * @return bool True if the header can be used
+ */
+bool DataCache::IsValid(const DataCacheHeader& header, uint64_t fileSize)
+{
+	if (memcmp(header.Magic, CACHE_MAGIC, sizeof(header.Magic)) != 0) return false;
+	if (header.Version != CACHE_VERSION || header.DataType != CV_32F) return false;
+
+	auto inputEnd = header.InputOffset + header.RowCount * header.InputCount * sizeof(float);
+	auto outputEnd = header.OutputOffset + header.RowCount * header.OutputCount * sizeof(float);
+	auto statsEnd = header.StatsOffset + GetStatsSize(header);
+	return header.NamesOffset + header.NamesSize <= fileSize && inputEnd <= fileSize && outputEnd <= fileSize && statsEnd <= fileSize;
+}
+
+/**
+ * @brief Find the size of the statistics block of a cache file
+ * @param header The header of the file
+ * @return uint64_t The number of bytes in the block
+ */
+uint64_t DataCache::GetStatsSize(const DataCacheHeader& header)
+{
+	return STATS_ROWS * (header.InputCount + header.OutputCount) * sizeof(double);
+}
+
+/**
+ * @brief Map a stand-alone binary dataset (as written by the dataset generator)
+ * @param path The path to the dataset
+ * @return TrainData * The training data
+ */
+TrainData * DataCache::LoadBinary(const string& path)
+{
+	auto fieldNames = vector<string>();
+	auto result = Map(path, nullptr, fieldNames);
+	if (result == nullptr) throw runtime_error("Not a valid binary dataset: " + path);
+	return result;
+}
+
+/**
+ * @brief Check whether a path names a stand-alone binary dataset
+ * @param path The path that we are checking
+ * @return bool True if the path has the binary dataset extension
+ */
+bool DataCache::IsBinaryPath(const string& path)
+{
+	auto extension = string(BINARY_EXTENSION);
+	return path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write the given training data to a cache file, along with the statistics of each column (so that
+ * normalization never has to pass over the data again). The file is written to a temporary path and then
+ * renamed, so a reader never sees a half written cache.
+ * @param path The path to the cache file
+ * @param source The details of the source file that the cache is built from
+ * @param fieldNames The names of the input fields
+ * @param data The training data that we are writing
+ * @param threadCount The number of threads used to gather the statistics (0 uses every core)
+ */
+void DataCache::Write(const string& path, DataCacheHeader& source, vector<string>& fieldNames, TrainData * data, int threadCount)
+{
+	auto& inputs = data->GetInputs(); auto& outputs = data->GetOutputs();
+	if (inputs.type() != CV_32F || outputs.type() != CV_32F) throw runtime_error("Only float datasets can be cached");
+
+	auto header = CreateHeader(source, inputs.rows, inputs.cols, outputs.cols, fieldNames);
+
+	auto tempPath = path + ".tmp";
+	auto writer = ofstream(tempPath, ios::binary);
+	if (!writer.is_open()) throw runtime_error("Unable to create file: " + tempPath);
+
+	WriteHeader(writer, header, fieldNames);
+	for (auto row = 0; row < inputs.rows; row++) writer.write((char *) inputs.ptr(row), inputs.cols * sizeof(float));
+
+	WritePadding(writer, header.OutputOffset);
+	for (auto row = 0; row < outputs.rows; row++) writer.write((char *) outputs.ptr(row), outputs.cols * sizeof(float));
+
+	WriteStats(writer, header, Normalizer::GetStats(inputs, vector<int>(), threadCount), Normalizer::GetStats(outputs, vector<int>(), threadCount));
+
+	writer.close();
+	if (writer.fail()) { remove(tempPath.c_str()); throw runtime_error("Unable to write file: " + tempPath); }
+	if (rename(tempPath.c_str(), path.c_str()) != 0) { remove(tempPath.c_str()); throw runtime_error("Unable to create file: " + path); }
+}
+
+/**
+ * @brief Build the header of a cache file, laying out the names and the (aligned) input, output and statistics blocks
+ * @param source The details of the source file (zeros for a stand-alone dataset)
+ * @param rowCount The number of rows
+ * @param inputCount The number of input columns
+ * @param outputCount The number of output columns
+ * @param fieldNames The names of the fields
+ * @return DataCacheHeader The resultant header
+ */
+DataCacheHeader DataCache::CreateHeader(const DataCacheHeader& source, uint64_t rowCount, int inputCount, int outputCount, vector<string>& fieldNames)
+{
+	auto namesSize = (uint64_t) 0; for (auto& name : fieldNames) namesSize += name.size() + 1;
+
+	auto header = source;
+	memcpy(header.Magic, CACHE_MAGIC, sizeof(header.Magic));
+	header.Version = CACHE_VERSION; header.DataType = CV_32F;
+	header.RowCount = rowCount; header.InputCount = inputCount; header.OutputCount = outputCount;
+	header.NamesOffset = sizeof(DataCacheHeader); header.NamesSize = namesSize;
+	header.InputOffset = Align(header.NamesOffset + header.NamesSize);
+	header.OutputOffset = Align(header.InputOffset + header.RowCount * header.InputCount * sizeof(float));
+	header.StatsOffset = Align(header.OutputOffset + header.RowCount * header.OutputCount * sizeof(float));
+	return header;
+}
+
+/**
+ * @brief Write the header and the field names, padding up to the start of the input block
+ * @param writer The writer that we are writing to (at the start of the file)
+ * @param header The header of the file
+ * @param fieldNames The names of the fields
+ */
+void DataCache::WriteHeader(ostream& writer, DataCacheHeader& header, vector<string>& fieldNames)
+{
+	writer.write((char *) &header, sizeof(DataCacheHeader));
+	for (auto& name : fieldNames) writer.write(name.c_str(), name.size() + 1);
+	WritePadding(writer, header.InputOffset);
+}
+
+/**
+ * @brief Write the column statistics into their block (after the outputs)
+ * @param writer The writer that we are writing to
+ * @param header The header of the file
+ * @param inputStats The statistics of the input columns (4 x columns, double)
+ * @param outputStats The statistics of the output columns (4 x columns, double)
+ */
+void DataCache::WriteStats(ostream& writer, DataCacheHeader& header, const Mat& inputStats, const Mat& outputStats)
+{
+	if (inputStats.cols != (int) header.InputCount || outputStats.cols != (int) header.OutputCount) throw runtime_error("The statistics do not match the columns of the dataset");
+
+	writer.seekp(header.StatsOffset);
+	for (auto row = 0; row < STATS_ROWS; row++) writer.write((char *) inputStats.ptr(row), inputStats.cols * sizeof(double));
+	for (auto row = 0; row < STATS_ROWS; row++) writer.write((char *) outputStats.ptr(row), outputStats.cols * sizeof(double));
+}
+
+//--------------------------------------------------
+// Source Details
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the size, modification time and hash of the source file.
+ * The hash covers the first and last blocks of the file and a set of evenly spaced blocks in between,
+ * so it catches edits that keep the size and time while staying cheap enough for very large files.
+ * @param sourcePath The path to the source file
+ * @return DataCacheHeader A header with the source fields filled in
+ */
+DataCacheHeader DataCache::GetSourceInfo(const string& sourcePath)
+{
+	auto result = DataCacheHeader(); memset(&result, 0, sizeof(DataCacheHeader));
+
+	struct stat info;
+	if (stat(sourcePath.c_str(), &info) != 0) throw runtime_error("Unable to open file: " + sourcePath);
+	result.SourceSize = (uint64_t) info.st_size;
+	result.SourceTime = (int64_t) info.st_mtim.tv_sec * 1000000000 + info.st_mtim.tv_nsec;
+
+	auto file = MappedFile(sourcePath);
+	auto hash = Hash(14695981039346656037ULL, (const char *) &result.SourceSize, sizeof(uint64_t));
+
+	if (file.GetSize() <= HASH_SAMPLES * HASH_BLOCK_SIZE) hash = Hash(hash, file.GetData(), file.GetSize());
+	else
+	{
+		auto stride = (file.GetSize() - HASH_BLOCK_SIZE) / (HASH_SAMPLES - 1);
+		for (auto i = 0; i < HASH_SAMPLES; i++) hash = Hash(hash, file.GetData() + i * stride, HASH_BLOCK_SIZE);
+	}
+
+	result.SourceHash = hash;
+	return result;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Pad the file with zeros up to the given offset
+ * @param writer The writer that we are padding
+ * @param offset The offset that we are padding up to
+ */
+void DataCache::WritePadding(ostream& writer, uint64_t offset)
+{
+	auto position = (uint64_t) writer.tellp();
+	while (position < offset) { writer.put(0); position++; }
+}
+
+/**
+ * @brief Round an offset up to the block alignment
+ * @param offset The offset that we are aligning
+ * @return uint64_t The aligned offset
+ */
+uint64_t DataCache::Align(uint64_t offset)
+{
+	return (offset + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT;
+}
+
+/**
+ * @brief Fold a block of bytes into a FNV-1a hash
+ * @param hash The current value of the hash
+ * @param data The bytes that are being added
+ * @param size The number of bytes
+ * @return uint64_t The updated hash
+ */
+uint64_t DataCache::Hash(uint64_t hash, const char * data, size_t size)
+{
+	for (auto i = (size_t)0; i < size; i++) { hash ^= (unsigned char) data[i]; hash *= 1099511628211ULL; }
+	return hash;
+}
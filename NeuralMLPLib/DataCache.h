@@ -0,0 +1,82 @@
+//--------------------------------------------------
+// A binary copy of an ARFF dataset that can be mapped straight into training data
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "MappedFile.h"
+#include "ArffReader.h"
+#include "TrainData.h"
+#include "Normalizer.h"
+
+namespace NVL_AI
+{
+	struct DataCacheHeader
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t DataType;
+		uint64_t RowCount;
+		uint32_t InputCount;
+		uint32_t OutputCount;
+		uint64_t SourceSize;
+		int64_t SourceTime;
+		uint64_t SourceHash;
+		uint64_t NamesOffset;
+		uint64_t NamesSize;
+		uint64_t InputOffset;
+		uint64_t OutputOffset;
+		uint64_t StatsOffset;
+	};
+
+	class DataCache
+	{
+	private:
+		string _sourcePath;
+		string _cachePath;
+		int _threadCount;
+		vector<string> _fieldNames;
+		bool _hit;
+		double _seconds;
+	public:
+		DataCache(const string& sourcePath, int threadCount = 1);
+
+		TrainData * Load();
+		void Stream(int batchRows = 65536);
+
+		inline string& GetCachePath() { return _cachePath; }
+		inline vector<string>& GetFieldNames() { return _fieldNames; }
+		inline bool IsHit() { return _hit; }
+		inline double GetSeconds() { return _seconds; }
+
+		static void Write(const string& path, DataCacheHeader& source, vector<string>& fieldNames, TrainData * data, int threadCount = 1);
+		static DataCacheHeader GetSourceInfo(const string& sourcePath);
+
+		static DataCacheHeader CreateHeader(const DataCacheHeader& source, uint64_t rowCount, int inputCount, int outputCount, vector<string>& fieldNames);
+		static void WriteHeader(ostream& writer, DataCacheHeader& header, vector<string>& fieldNames);
+		static void WritePadding(ostream& writer, uint64_t offset);
+		static void WriteStats(ostream& writer, DataCacheHeader& header, const Mat& inputStats, const Mat& outputStats);
+		static TrainData * LoadBinary(const string& path);
+		static bool IsBinaryPath(const string& path);
+		static bool IsValid(const DataCacheHeader& header, uint64_t fileSize);
+		static uint64_t GetStatsSize(const DataCacheHeader& header);
+	private:
+		static TrainData * Map(const string& path, DataCacheHeader * source, vector<string>& fieldNames);
+		static uint64_t Align(uint64_t offset);
+		static uint64_t Hash(uint64_t hash, const char * data, size_t size);
+	};
+}
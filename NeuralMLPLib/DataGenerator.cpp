@@ -0,0 +1,138 @@
+//--------------------------------------------------
+// Implementation of class DataGenerator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "DataGenerator.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param settings The settings of the generator (a single range applies to every variable)
+ */
+DataGenerator::DataGenerator(const GeneratorSettings& settings) : _settings(settings), _expression(settings.Expression)
+{
+	_variableCount = max(settings.VariableCount, _expression.GetVariableCount());
+	if (_variableCount < 1) throw runtime_error("The generator needs at least one variable");
+	if (settings.BlockRows < 1) throw runtime_error("The generator needs at least one row per block");
+	if (settings.Low.size() != settings.High.size() || (settings.Low.size() != 1 && (int) settings.Low.size() != _variableCount))
+		throw runtime_error(NVLib::Formatter() << "Expected 1 or " << _variableCount << " variable ranges, but found " << settings.Low.size());
+
+	if (settings.Low.size() == 1)
+	{
+		_settings.Low = vector<double>(_variableCount, settings.Low[0]);
+		_settings.High = vector<double>(_variableCount, settings.High[0]);
+	}
+
+	_threadCount = ParallelUtils::GetThreadCount(settings.ThreadCount);
+}
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Generate the dataset and stream it to a file, one block of rows at a time, so that memory stays bounded
+ * by the block size whatever the row count. The path picks the format (ARFF, or the binary dataset extension).
+ * @param path The path that the dataset is written to
+ * @return GeneratorStats The statistics of the run
+ */
+GeneratorStats DataGenerator::Run(const string& path)
+{
+	auto start = chrono::steady_clock::now();
+
+	auto description = string(NVLib::Formatter() << "Equation: " << _settings.Expression);
+	auto writer = DatasetWriter(path, _settings.Name, description, _settings.RowCount, _variableCount, 1, _threadCount);
+
+	Mat inputs = Mat_<float>(_settings.BlockRows, _variableCount); Mat outputs = Mat_<float>(_settings.BlockRows, 1);
+
+	for (auto first = (uint64_t) 0; first < _settings.RowCount; first += _settings.BlockRows)
+	{
+		auto rows = (int) min((uint64_t) _settings.BlockRows, _settings.RowCount - first);
+		Mat blockInputs = inputs.rowRange(0, rows); Mat blockOutputs = outputs.rowRange(0, rows);
+
+		Generate(first, blockInputs, blockOutputs);
+		writer.WriteRows(blockInputs, blockOutputs);
+	}
+
+	writer.Close();
+
+	auto result = GeneratorStats();
+	result.Rows = _settings.RowCount;
+	result.Seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	result.RowsPerSecond = result.Seconds > 0 ? result.Rows / result.Seconds : 0;
+	return result;
+}
+
+/**
+ * @brief Fill a block of rows, splitting them across the threads. Every value comes from a counter-based random
+ * number keyed on its row and column, so a dataset is the same whatever the thread count or block size.
+ * @param firstRow The index (within the dataset) of the first row in the block
+ * @param inputs The inputs of the block (float, one column per variable)
+ * @param outputs The outputs of the block (float, one column)
+ */
+void DataGenerator::Generate(uint64_t firstRow, Mat& inputs, Mat& outputs)
+{
+	auto rows = inputs.rows; auto share = (rows + _threadCount - 1) / _threadCount;
+	auto low = _settings.Low.data(); auto high = _settings.High.data(); auto seed = _settings.Seed;
+
+	ParallelUtils::Run(_threadCount, [&](int index)
+	{
+		auto end = min(rows, (index + 1) * share);
+
+		for (auto row = index * share; row < end; row++)
+		{
+			auto values = inputs.ptr<float>(row); auto counter = (firstRow + row) * _variableCount;
+			for (auto j = 0; j < _variableCount; j++) values[j] = (float) (low[j] + (high[j] - low[j]) * GetUniform(seed, counter + j));
+			outputs.ptr<float>(row)[0] = (float) _expression.Evaluate(values);
+		}
+	});
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Parse the variable ranges, given either as a single "low:high" for every variable or as "low:high;low:high;..."
+ * @param text The text that we are parsing
+ * @param low The lower bound of each range
+ * @param high The upper bound of each range
+ */
+void DataGenerator::ParseRanges(const string& text, vector<double>& low, vector<double>& high)
+{
+	low.clear(); high.clear();
+
+	auto ranges = vector<string>(); NVLib::StringUtils::Split(text, ';', ranges);
+	for (auto& range : ranges)
+	{
+		auto parts = vector<string>(); NVLib::StringUtils::Split(range, ':', parts);
+		if (parts.size() != 2) throw runtime_error("Expected a range of the form low:high, but found: " + range);
+
+		low.push_back(NVLib::StringUtils::String2Double(parts[0])); high.push_back(NVLib::StringUtils::String2Double(parts[1]));
+	}
+
+	if (low.empty()) throw runtime_error("No variable ranges were given");
+}
+
+/**
+ * @brief A uniform random number in [0, 1) from a seed and a counter (the SplitMix64 finalizer)
+ * @param seed The seed of the dataset
+ * @param counter The position of the value within the dataset
+ * @return double The resultant number
+ */
+double DataGenerator::GetUniform(uint64_t seed, uint64_t counter)
+{
+	auto value = seed * 0x9e3779b97f4a7c15ULL + counter * 0xbf58476d1ce4e5b9ULL + 0x94d049bb133111ebULL;
+	value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+	value ^= value >> 31;
+	return (value >> 11) * (1.0 / 9007199254740992.0);
+}
@@ -0,0 +1,66 @@
+//--------------------------------------------------
+// Generates synthetic datasets from an expression over p[i], streaming them out a block at a time
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+#include <NVLib/StringUtils.h>
+
+#include "Expression.h"
+#include "ParallelUtils.h"
+#include "DatasetWriter.h"
+
+namespace NVL_AI
+{
+	struct GeneratorSettings
+	{
+		string Expression;
+		vector<double> Low;
+		vector<double> High;
+		int VariableCount = 0;
+		uint64_t RowCount = 0;
+		uint64_t Seed = 1;
+		int BlockRows = 65536;
+		int ThreadCount = 0;
+		string Name = "generated";
+	};
+
+	struct GeneratorStats
+	{
+		uint64_t Rows = 0;
+		double Seconds = 0;
+		double RowsPerSecond = 0;
+	};
+
+	class DataGenerator
+	{
+	private:
+		GeneratorSettings _settings;
+		NVL_AI::Expression _expression;
+		int _variableCount;
+		int _threadCount;
+	public:
+		DataGenerator(const GeneratorSettings& settings);
+
+		GeneratorStats Run(const string& path);
+		void Generate(uint64_t firstRow, Mat& inputs, Mat& outputs);
+
+		inline int GetVariableCount() { return _variableCount; }
+
+		static void ParseRanges(const string& text, vector<double>& low, vector<double>& high);
+		static double GetUniform(uint64_t seed, uint64_t counter);
+	};
+}
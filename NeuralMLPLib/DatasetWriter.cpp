@@ -0,0 +1,135 @@
+//--------------------------------------------------
+// Implementation of class DatasetWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "DatasetWriter.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, writes the header. A path with the binary dataset extension gets the binary layout
+ * (which needs the row count up front, so that the output block can be placed after the input block).
+ * @param path The path that we are writing to
+ * @param name The name of the relation
+ * @param description The description of the relation
+ * @param rowCount The number of rows that will be written
+ * @param inputCount The number of input columns
+ * @param outputCount The number of output columns
+ * @param threadCount The number of threads used to format ARFF records (0 uses every core)
+ */
+DatasetWriter::DatasetWriter(const string& path, const string& name, const string& description, uint64_t rowCount, int inputCount, int outputCount, int threadCount) :
+	_path(path), _binary(DataCache::IsBinaryPath(path)), _rowCount(rowCount), _written(0)
+{
+	if (!_binary)
+	{
+		if (outputCount != 1) throw runtime_error("ARFF datasets have a single class column");
+		_arffWriter = Ptr<ArffWriter>(new ArffWriter(path, threadCount));
+		_arffWriter->WriteHeader(name, description, inputCount);
+		return;
+	}
+
+	auto fieldNames = vector<string>();
+	for (auto i = 0; i < inputCount; i++) fieldNames.push_back(NVLib::Formatter() << "p[" << i << "]");
+	for (auto i = 0; i < outputCount; i++) fieldNames.push_back(outputCount == 1 ? string("class") : string(NVLib::Formatter() << "class" << i));
+
+	auto source = DataCacheHeader(); memset(&source, 0, sizeof(DataCacheHeader));
+	OpenBinary(source, fieldNames, inputCount, outputCount);
+}
+
+/**
+ * @brief Constructor for the cache file of an ARFF dataset, which has the binary layout along with the details
+ * of its source file, so that the rows can be streamed into it rather than loaded first
+ * @param path The path to the cache file
+ * @param source The details of the source file that the cache is built from
+ * @param fieldNames The names of the input fields
+ * @param rowCount The number of rows that will be written
+ * @param outputCount The number of output columns
+ */
+DatasetWriter::DatasetWriter(const string& path, const DataCacheHeader& source, vector<string>& fieldNames, uint64_t rowCount, int outputCount) :
+	_path(path), _binary(true), _rowCount(rowCount), _written(0)
+{
+	OpenBinary(source, fieldNames, (int) fieldNames.size(), outputCount);
+}
+
+/**
+ * @brief Lay out a binary file and write its header to the temporary path
+ * @param source The details of the source file (zeros for a stand-alone dataset)
+ * @param fieldNames The names of the fields
+ * @param inputCount The number of input columns
+ * @param outputCount The number of output columns
+ */
+void DatasetWriter::OpenBinary(const DataCacheHeader& source, vector<string>& fieldNames, int inputCount, int outputCount)
+{
+	_header = DataCache::CreateHeader(source, _rowCount, inputCount, outputCount, fieldNames);
+
+	_writer.open(_path + ".tmp", ios::binary);
+	if (!_writer.is_open()) throw runtime_error("Unable to create file: " + _path + ".tmp");
+	DataCache::WriteHeader(_writer, _header, fieldNames);
+
+	_inputSums = Normalizer::CreateSums(inputCount); _outputSums = Normalizer::CreateSums(outputCount);
+}
+
+/**
+ * @brief Main Terminator, drops a binary dataset that was never finished
+ */
+DatasetWriter::~DatasetWriter()
+{
+	if (_writer.is_open()) { _writer.close(); remove((_path + ".tmp").c_str()); }
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write the next block of rows. Binary rows go straight to their place in the input and output blocks,
+ * and are added to the running sums that become the column statistics of the dataset.
+ * @param inputs The input part of each row (float)
+ * @param outputs The output part of each row (float)
+ */
+void DatasetWriter::WriteRows(Mat& inputs, Mat& outputs)
+{
+	if (inputs.rows != outputs.rows) throw runtime_error("The inputs and outputs have different row counts");
+	if (_written + inputs.rows > _rowCount) throw runtime_error(NVLib::Formatter() << "More rows were written than the " << _rowCount << " that were declared");
+
+	if (!_binary) _arffWriter->WriteRows(inputs, outputs);
+	else
+	{
+		if (inputs.type() != CV_32F || outputs.type() != CV_32F) throw runtime_error("Binary datasets only hold float data");
+		if (inputs.cols != (int) _header.InputCount || outputs.cols != (int) _header.OutputCount) throw runtime_error("The rows do not match the columns of the dataset");
+
+		_writer.seekp(_header.InputOffset + _written * _header.InputCount * sizeof(float));
+		for (auto row = 0; row < inputs.rows; row++) _writer.write((char *) inputs.ptr(row), inputs.cols * sizeof(float));
+
+		_writer.seekp(_header.OutputOffset + _written * _header.OutputCount * sizeof(float));
+		for (auto row = 0; row < outputs.rows; row++) _writer.write((char *) outputs.ptr(row), outputs.cols * sizeof(float));
+
+		Normalizer::Accumulate(inputs, vector<int>(), _inputSums); Normalizer::Accumulate(outputs, vector<int>(), _outputSums);
+	}
+
+	_written += inputs.rows;
+}
+
+/**
+ * @brief Finish the file. A binary dataset gets its column statistics and is written to a temporary path and renamed into place here.
+ */
+void DatasetWriter::Close()
+{
+	if (_written != _rowCount) throw runtime_error(NVLib::Formatter() << "Only " << _written << " of " << _rowCount << " rows were written to " << _path);
+
+	if (!_binary) { _arffWriter->Close(); return; }
+
+	DataCache::WriteStats(_writer, _header, Normalizer::GetStats(_inputSums), Normalizer::GetStats(_outputSums));
+
+	auto tempPath = _path + ".tmp";
+	_writer.close();
+	if (_writer.fail()) { remove(tempPath.c_str()); throw runtime_error("Unable to write file: " + tempPath); }
+	if (rename(tempPath.c_str(), _path.c_str()) != 0) { remove(tempPath.c_str()); throw runtime_error("Unable to create file: " + _path); }
+}
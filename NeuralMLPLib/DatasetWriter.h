@@ -0,0 +1,52 @@
+//--------------------------------------------------
+// Streams blocks of rows out to a dataset file, either as ARFF or as a stand-alone binary dataset
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "DataCache.h"
+#include "ArffWriter.h"
+
+namespace NVL_AI
+{
+	class DatasetWriter
+	{
+	private:
+		string _path;
+		bool _binary;
+		uint64_t _rowCount;
+		uint64_t _written;
+		Ptr<ArffWriter> _arffWriter;
+		ofstream _writer;
+		DataCacheHeader _header;
+		Mat _inputSums;
+		Mat _outputSums;
+	public:
+		DatasetWriter(const string& path, const string& name, const string& description, uint64_t rowCount, int inputCount, int outputCount = 1, int threadCount = 0);
+		DatasetWriter(const string& path, const DataCacheHeader& source, vector<string>& fieldNames, uint64_t rowCount, int outputCount = 1);
+		~DatasetWriter();
+
+		void WriteRows(Mat& inputs, Mat& outputs);
+		void Close();
+
+		inline bool IsBinary() { return _binary; }
+		inline uint64_t GetWritten() { return _written; }
+	private:
+		void OpenBinary(const DataCacheHeader& source, vector<string>& fieldNames, int inputCount, int outputCount);
+	};
+}
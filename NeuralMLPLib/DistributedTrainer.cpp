@@ -0,0 +1,140 @@
+//--------------------------------------------------
+// Implementation of class DistributedTrainer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "DistributedTrainer.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param transport The link to the other workers in the job
+ */
+DistributedTrainer::DistributedTrainer(Ptr<Transport> transport) : _transport(transport), _syncCount(0), _syncSeconds(0) {}
+
+//--------------------------------------------------
+// Partition
+//--------------------------------------------------
+
+/**
+ * @brief Take this worker's block of rows from a dataset. The block shares the dataset's memory (so a mapped dataset
+ * only ever pages in this worker's rows) and carries the column statistics of the whole dataset, summed across the
+ * workers, so that every worker's network scales its data the same way.
+ * @param data The whole dataset
+ * @return TrainData * The rows that belong to this worker
+ */
+TrainData * DistributedTrainer::GetPartition(TrainData * data)
+{
+	if (data->IsView()) throw runtime_error("A distributed job partitions a whole dataset, not a view");
+
+	auto start = 0, end = 0; GetRange(data->GetRowCount(), _transport->GetRank(), _transport->GetSize(), start, end);
+	if (start == end) throw runtime_error(NVLib::Formatter() << "There are too few rows to give worker " << _transport->GetRank() << " any");
+
+	Mat inputs = data->GetInputs().rowRange(start, end); Mat outputs = data->GetOutputs().rowRange(start, end);
+	auto result = new TrainData(inputs, outputs, data->GetSource());
+	result->SetStats(ShareStats(inputs), ShareStats(outputs));
+
+	return result;
+}
+
+/**
+ * @brief Load only this worker's block of rows from a binary dataset. The file is mapped without being read, and the
+ * partition keeps the mapping alive on its own, so a worker only pages in its own rows (and their statistics) however
+ * large the dataset is, and nothing else of the dataset is kept.
+ * @param path The path to the binary dataset (or the cache file of an ARFF dataset)
+ * @return TrainData * The rows that belong to this worker
+ */
+TrainData * DistributedTrainer::LoadPartition(const string& path)
+{
+	auto data = Ptr<TrainData>(DataCache::LoadBinary(path));
+	return GetPartition(data.get());
+}
+
+/**
+ * @brief Find the block of rows that belongs to a worker (the blocks are contiguous and differ in size by at most one row)
+ * @param rows The number of rows in the dataset
+ * @param rank The index of the worker
+ * @param size The number of workers
+ * @param start The first row of the block
+ * @param end One past the last row of the block
+ */
+void DistributedTrainer::GetRange(int rows, int rank, int size, int& start, int& end)
+{
+	start = (int) ((int64_t) rank * rows / size); end = (int) ((int64_t) (rank + 1) * rows / size);
+}
+
+//--------------------------------------------------
+// Synchronize
+//--------------------------------------------------
+
+/**
+ * @brief Replace the weights of every worker's network with the mean of their weights. The optimizer state of each
+ * worker is left as it is, so each carries on with its own momentum.
+ * @param network The network of this worker
+ */
+void DistributedTrainer::Average(NativeNetwork& network)
+{
+	auto start = chrono::steady_clock::now();
+	auto& weights = network.GetWeights();
+
+	auto count = 0; for (auto i = 1; i < (int) weights.size(); i++) count += (int) weights[i].total();
+	_buffer.resize(count);
+
+	auto position = 0;
+	for (auto i = 1; i < (int) weights.size(); i++)
+	{
+		auto w = (float *) weights[i].data;
+		for (auto j = 0; j < (int) weights[i].total(); j++) _buffer[position++] = w[j];
+	}
+
+	_transport->AllReduce(_buffer.data(), count, ReduceOp::Sum);
+
+	auto scale = 1.0 / _transport->GetSize(); position = 0;
+	for (auto i = 1; i < (int) weights.size(); i++)
+	{
+		auto w = (float *) weights[i].data;
+		for (auto j = 0; j < (int) weights[i].total(); j++) w[j] = (float) (_buffer[position++] * scale);
+	}
+
+	_syncCount++;
+	_syncSeconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Decide together whether to stop, so that every worker leaves the training loop after the same sync
+ * @param stop Whether this worker wants to stop
+ * @return bool True if any worker wants to stop
+ */
+bool DistributedTrainer::Agree(bool stop)
+{
+	auto value = stop ? 1.0 : 0.0;
+	_transport->AllReduce(&value, 1, ReduceOp::Max);
+	return value > 0;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the column statistics of the whole dataset from this worker's rows, by combining every worker's running sums
+ * @param data The rows of this worker
+ * @return Mat The statistics (4 x columns): the mean, deviation, minimum and maximum of each column
+ */
+Mat DistributedTrainer::ShareStats(const Mat& data)
+{
+	auto sums = Normalizer::CreateSums(data.cols);
+	Normalizer::Accumulate(data, vector<int>(), sums);
+
+	const ReduceOp ops[] = { ReduceOp::Sum, ReduceOp::Sum, ReduceOp::Min, ReduceOp::Max, ReduceOp::Sum };
+	for (auto row = 0; row < sums.rows; row++) _transport->AllReduce(sums.ptr<double>(row), sums.cols, ops[row]);
+
+	return Normalizer::GetStats(sums);
+}
@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Keeps the copies of a native network in a distributed job in step by averaging their weights through a transport
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "DataCache.h"
+#include "TrainData.h"
+#include "Transport.h"
+#include "Normalizer.h"
+#include "NativeNetwork.h"
+
+namespace NVL_AI
+{
+	class DistributedTrainer
+	{
+	private:
+		Ptr<Transport> _transport;
+		vector<double> _buffer;
+		int _syncCount;
+		double _syncSeconds;
+	public:
+		DistributedTrainer(Ptr<Transport> transport);
+
+		TrainData * GetPartition(TrainData * data);
+		TrainData * LoadPartition(const string& path);
+		void Average(NativeNetwork& network);
+		bool Agree(bool stop);
+
+		inline Ptr<Transport>& GetTransport() { return _transport; }
+		inline int GetSyncCount() { return _syncCount; }
+		inline double GetSyncSeconds() { return _syncSeconds; }
+
+		static void GetRange(int rows, int rank, int size, int& start, int& end);
+	private:
+		Mat ShareStats(const Mat& data);
+	};
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------
+// Implementation of class EarlyStopping
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "EarlyStopping.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param patience The number of iterations without a real improvement before stopping (0 never runs out of patience)
+ * @param minImprovement The drop in score that counts as a real improvement
+ * @param targetScore The score at (or below) which training is finished
+ */
+EarlyStopping::EarlyStopping(int patience, double minImprovement, double targetScore) :
+	_patience(patience), _minImprovement(minImprovement), _targetScore(targetScore), _bestScore(DBL_MAX), _bestIteration(-1), _progressScore(DBL_MAX), _waited(0) {}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Add the score of an iteration. Any drop in score is a new best (worth keeping), but only a drop of more
+ * than the minimum improvement resets the patience.
+ * @param iteration The iteration that was scored
+ * @param score The score (lower is better)
+ * @return bool True if this is the best score so far
+ */
+bool EarlyStopping::Update(int iteration, double score)
+{
+	auto improved = score < _bestScore;
+	if (improved) { _bestScore = score; _bestIteration = iteration; }
+
+	if (score < _progressScore - _minImprovement) { _progressScore = score; _waited = 0; }
+	else _waited++;
+
+	if (score <= _targetScore) _reason = "target score reached";
+	else if (_patience > 0 && _waited >= _patience) _reason = "no improvement for " + to_string(_waited) + " iterations";
+
+	return improved;
+}
@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// Decides when training should stop, from the run of validation scores
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cfloat>
+#include <iostream>
+using namespace std;
+
+namespace NVL_AI
+{
+	class EarlyStopping
+	{
+	private:
+		int _patience;
+		double _minImprovement;
+		double _targetScore;
+		double _bestScore;
+		int _bestIteration;
+		double _progressScore;
+		int _waited;
+		string _reason;
+	public:
+		EarlyStopping(int patience, double minImprovement, double targetScore);
+
+		bool Update(int iteration, double score);
+
+		inline bool IsStopped() { return !_reason.empty(); }
+		inline string& GetReason() { return _reason; }
+		inline double GetBestScore() { return _bestScore; }
+		inline int GetBestIteration() { return _bestIteration; }
+		inline int GetWaited() { return _waited; }
+	};
+}
@@ -0,0 +1,231 @@
+//--------------------------------------------------
+// Implementation of class Expression
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Expression.h"
+using namespace NVL_AI;
+
+// The deepest that the evaluation stack can go
+#define MAX_STACK 64
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, compiles the expression into a list of stack steps. The grammar is the usual one:
+ * +, -, *, / and ^ (right associative) with brackets, numbers, the variables p[i] and the functions sin, cos,
+ * tan, exp, log, sqrt, abs and tanh.
+ * @param text The text of the expression, for example "(p[0] * p[1]) - p[2]"
+ */
+Expression::Expression(const string& text) : _text(text), _variableCount(0), _position(0)
+{
+	ParseSum();
+	SkipSpace();
+	if (_position != _text.size()) throw Error("Unexpected text");
+
+	// Check that the steps fit on the evaluation stack
+	auto depth = 0; auto maxDepth = 0;
+	for (auto& step : _steps)
+	{
+		if (step.Op == ExpressionOp::Number || step.Op == ExpressionOp::Variable) depth++;
+		else if (step.Op != ExpressionOp::Negate && step.Op != ExpressionOp::Function) depth--;
+		maxDepth = max(maxDepth, depth);
+	}
+	if (maxDepth > MAX_STACK) throw Error("The expression is nested too deeply");
+}
+
+//--------------------------------------------------
+// Evaluate
+//--------------------------------------------------
+
+/**
+ * @brief Evaluate the expression (this does not allocate, and is safe to call from many threads at once)
+ * @param variables The values of p[0], p[1], ...
+ * @return double The resultant value
+ */
+double Expression::Evaluate(const float * variables) const
+{
+	double stack[MAX_STACK]; auto top = -1;
+
+	for (auto& step : _steps)
+	{
+		switch (step.Op)
+		{
+			case ExpressionOp::Number: stack[++top] = step.Value; break;
+			case ExpressionOp::Variable: stack[++top] = variables[step.Index]; break;
+			case ExpressionOp::Add: top--; stack[top] += stack[top + 1]; break;
+			case ExpressionOp::Subtract: top--; stack[top] -= stack[top + 1]; break;
+			case ExpressionOp::Multiply: top--; stack[top] *= stack[top + 1]; break;
+			case ExpressionOp::Divide: top--; stack[top] /= stack[top + 1]; break;
+			case ExpressionOp::Power: top--; stack[top] = pow(stack[top], stack[top + 1]); break;
+			case ExpressionOp::Negate: stack[top] = -stack[top]; break;
+			case ExpressionOp::Function: stack[top] = step.Function(stack[top]); break;
+		}
+	}
+
+	return stack[0];
+}
+
+//--------------------------------------------------
+// Parsing
+//--------------------------------------------------
+
+/**
+ * @brief sum := product (('+' | '-') product)*
+ */
+void Expression::ParseSum()
+{
+	ParseProduct();
+
+	while (true)
+	{
+		if (Accept('+')) { ParseProduct(); Add(ExpressionOp::Add); }
+		else if (Accept('-')) { ParseProduct(); Add(ExpressionOp::Subtract); }
+		else return;
+	}
+}
+
+/**
+ * @brief product := unary (('*' | '/') unary)*
+ */
+void Expression::ParseProduct()
+{
+	ParseUnary();
+
+	while (true)
+	{
+		if (Accept('*')) { ParseUnary(); Add(ExpressionOp::Multiply); }
+		else if (Accept('/')) { ParseUnary(); Add(ExpressionOp::Divide); }
+		else return;
+	}
+}
+
+/**
+ * @brief unary := ('-' | '+') unary | power
+ */
+void Expression::ParseUnary()
+{
+	if (Accept('-')) { ParseUnary(); Add(ExpressionOp::Negate); }
+	else if (Accept('+')) ParseUnary();
+	else ParsePower();
+}
+
+/**
+ * @brief power := primary ('^' unary)?
+ */
+void Expression::ParsePower()
+{
+	ParsePrimary();
+	if (Accept('^')) { ParseUnary(); Add(ExpressionOp::Power); }
+}
+
+/**
+ * @brief primary := number | 'p' '[' index ']' | function '(' sum ')' | '(' sum ')'
+ */
+void Expression::ParsePrimary()
+{
+	SkipSpace();
+	if (_position >= _text.size()) throw Error("Unexpected end of expression");
+
+	if (Accept('(')) { ParseSum(); Expect(')'); return; }
+
+	auto letter = _text[_position];
+	if (isdigit(letter) || letter == '.')
+	{
+		auto end = (size_t) 0; auto value = stod(_text.substr(_position), &end);
+		_position += end; Add(ExpressionOp::Number, value);
+		return;
+	}
+
+	auto start = _position;
+	while (_position < _text.size() && isalpha(_text[_position])) _position++;
+	auto name = _text.substr(start, _position - start);
+	if (name.empty()) throw Error("Expected a number, variable or function");
+
+	if (name == "p")
+	{
+		Expect('['); SkipSpace();
+		auto end = _position; while (end < _text.size() && isdigit(_text[end])) end++;
+		if (end == _position) throw Error("Expected a variable index");
+		auto index = stoi(_text.substr(_position, end - _position)); _position = end;
+		Expect(']');
+
+		Add(ExpressionOp::Variable, 0, index); _variableCount = max(_variableCount, index + 1);
+		return;
+	}
+
+	double (*function)(double) = nullptr;
+	if (name == "sin") function = [](double x) { return sin(x); };
+	else if (name == "cos") function = [](double x) { return cos(x); };
+	else if (name == "tan") function = [](double x) { return tan(x); };
+	else if (name == "exp") function = [](double x) { return exp(x); };
+	else if (name == "log") function = [](double x) { return log(x); };
+	else if (name == "sqrt") function = [](double x) { return sqrt(x); };
+	else if (name == "abs") function = [](double x) { return fabs(x); };
+	else if (name == "tanh") function = [](double x) { return tanh(x); };
+	else throw Error("Unknown function " + name);
+
+	Expect('('); ParseSum(); Expect(')');
+	Add(ExpressionOp::Function, 0, 0, function);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Add a step to the compiled expression
+ * @param op The operation of the step
+ * @param value The value of a number
+ * @param index The index of a variable
+ * @param function The function that is applied
+ */
+void Expression::Add(ExpressionOp op, double value, int index, double (*function)(double))
+{
+	auto step = ExpressionStep(); step.Op = op; step.Value = value; step.Index = index; step.Function = function;
+	_steps.push_back(step);
+}
+
+/**
+ * @brief Move past any white space
+ */
+void Expression::SkipSpace()
+{
+	while (_position < _text.size() && isspace(_text[_position])) _position++;
+}
+
+/**
+ * @brief Move past the given token if it is next
+ * @param token The token that we are looking for
+ * @return bool True if the token was found
+ */
+bool Expression::Accept(char token)
+{
+	SkipSpace();
+	if (_position < _text.size() && _text[_position] == token) { _position++; return true; }
+	return false;
+}
+
+/**
+ * @brief Move past the given token, failing if it is not next
+ * @param token The token that must come next
+ */
+void Expression::Expect(char token)
+{
+	if (!Accept(token)) throw Error(string("Expected '") + token + "'");
+}
+
+/**
+ * @brief Build an error that points at the current position
+ * @param message The message of the error
+ * @return runtime_error The resultant error
+ */
+runtime_error Expression::Error(const string& message)
+{
+	return runtime_error(NVLib::Formatter() << message << " at position " << _position << " of expression: " << _text);
+}
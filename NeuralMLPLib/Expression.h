@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// An arithmetic expression over the variables p[i], compiled once and then evaluated per row
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cctype>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Formatter.h>
+
+namespace NVL_AI
+{
+	enum class ExpressionOp { Number, Variable, Add, Subtract, Multiply, Divide, Power, Negate, Function };
+
+	struct ExpressionStep
+	{
+		ExpressionOp Op;
+		double Value;
+		int Index;
+		double (*Function)(double);
+	};
+
+	class Expression
+	{
+	private:
+		string _text;
+		vector<ExpressionStep> _steps;
+		int _variableCount;
+		size_t _position;
+	public:
+		Expression(const string& text);
+
+		double Evaluate(const float * variables) const;
+
+		inline string& GetText() { return _text; }
+		inline int GetVariableCount() { return _variableCount; }
+	private:
+		void ParseSum();
+		void ParseProduct();
+		void ParseUnary();
+		void ParsePower();
+		void ParsePrimary();
+
+		void Add(ExpressionOp op, double value = 0, int index = 0, double (*function)(double) = nullptr);
+		void SkipSpace();
+		bool Accept(char token);
+		void Expect(char token);
+		runtime_error Error(const string& message);
+	};
+}
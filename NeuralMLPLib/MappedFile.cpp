@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// Implementation of class MappedFile
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "MappedFile.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the file that we are mapping
+ * @param writable Map the pages as copy-on-write so they can be changed (without touching the file)
+ */
+MappedFile::MappedFile(const string& path, bool writable) : _handle(-1), _data(nullptr), _size(0)
+{
+	_handle = open(path.c_str(), O_RDONLY);
+	if (_handle < 0) throw runtime_error("Unable to open file: " + path);
+
+	struct stat info;
+	if (fstat(_handle, &info) != 0) { close(_handle); throw runtime_error("Unable to read the size of file: " + path); }
+	_size = (size_t) info.st_size;
+
+	if (_size == 0) return;
+
+	auto protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+	auto data = mmap(nullptr, _size, protection, MAP_PRIVATE, _handle, 0);
+	if (data == MAP_FAILED) { close(_handle); throw runtime_error("Unable to map file: " + path); }
+	_data = (char *) data;
+
+	madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+/**
+ * @brief Main Terminator
+ */
+MappedFile::~MappedFile()
+{
+	if (_data != nullptr) munmap(_data, _size);
+	if (_handle >= 0) close(_handle);
+}
+
+//--------------------------------------------------
+// Discard
+//--------------------------------------------------
+
+/**
+ * @brief Drop the pages of a region that has been dealt with, so that streaming through a large file does not
+ * keep it all resident. Only the whole pages inside the region are dropped: they are read back from the file if they
+ * are touched again, so any copy-on-write changes to them are lost.
+ * @param offset The offset of the region
+ * @param size The size of the region
+ */
+void MappedFile::Discard(size_t offset, size_t size)
+{
+	auto pageSize = (size_t) sysconf(_SC_PAGESIZE);
+	auto start = (offset + pageSize - 1) / pageSize * pageSize;
+	auto end = min(offset + size, _size) / pageSize * pageSize;
+
+	if (_data != nullptr && end > start) madvise(_data + start, end - start, MADV_DONTNEED);
+}
@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// A view of a file that has been mapped into memory
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace NVL_AI
+{
+	class MappedFile
+	{
+	private:
+		int _handle;
+		char * _data;
+		size_t _size;
+	public:
+		MappedFile(const string& path, bool writable = false);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		void Discard(size_t offset, size_t size);
+
+		inline char * GetData() { return _data; }
+		inline size_t GetSize() { return _size; }
+	};
+}
@@ -0,0 +1,601 @@
+//--------------------------------------------------
+// The kernels behind MathKernels, written once against a set of vector primitives. Each MathKernels*.cpp file
+// includes this with its own compiler flags and names the function that hands out its table (KERNEL_TABLE), and
+// MathKernels picks one of the tables at run time from the instruction sets that the CPU supports.
+//
+// Everything here has internal linkage, and nothing from the standard library is instantiated (std::min, std::fill
+// and so on): an inline function emitted by an AVX-512 file could otherwise be the copy that the linker keeps for
+// the whole program, which would fault on a CPU without AVX-512.
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(MATH_KERNELS_SCALAR) && (defined(__AVX2__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+#include "MathKernelTable.h"
+
+//--------------------------------------------------
+// Vector Primitives
+//--------------------------------------------------
+
+// The kernels are written once against these primitives, which map onto AVX-512, AVX2 or plain floats
+// depending on the instruction set that the including file is compiled for (MATH_KERNELS_SCALAR forces plain
+// floats). VLoadN and VStoreN touch only the first n lanes, so the ragged end of a row is handled with one
+// masked operation instead of a scalar loop.
+
+#if !defined(MATH_KERNELS_SCALAR) && defined(__AVX512F__)
+
+#define VEC_WIDTH 16
+#define VEC_NAME "AVX-512"
+typedef __m512 vfloat;
+
+static inline vfloat VLoad(const float * p) { return _mm512_loadu_ps(p); }
+static inline void VStore(float * p, vfloat v) { _mm512_storeu_ps(p, v); }
+static inline vfloat VLoadN(const float * p, int n) { return _mm512_maskz_loadu_ps((__mmask16) ((1u << n) - 1), p); }
+static inline void VStoreN(float * p, vfloat v, int n) { _mm512_mask_storeu_ps(p, (__mmask16) ((1u << n) - 1), v); }
+static inline vfloat VSet(float v) { return _mm512_set1_ps(v); }
+static inline vfloat VFma(vfloat a, vfloat b, vfloat c) { return _mm512_fmadd_ps(a, b, c); }
+static inline vfloat VAdd(vfloat a, vfloat b) { return _mm512_add_ps(a, b); }
+static inline vfloat VSub(vfloat a, vfloat b) { return _mm512_sub_ps(a, b); }
+static inline vfloat VMul(vfloat a, vfloat b) { return _mm512_mul_ps(a, b); }
+static inline vfloat VDiv(vfloat a, vfloat b) { return _mm512_div_ps(a, b); }
+static inline vfloat VMin(vfloat a, vfloat b) { return _mm512_min_ps(a, b); }
+static inline vfloat VMax(vfloat a, vfloat b) { return _mm512_max_ps(a, b); }
+static inline vfloat VSqrt(vfloat v) { return _mm512_sqrt_ps(v); }
+static inline float VSum(vfloat v) { return _mm512_reduce_add_ps(v); }
+static inline vfloat VFloor(vfloat v) { return _mm512_roundscale_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+static inline vfloat VPow2(vfloat n) { return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvttps_epi32(n), _mm512_set1_epi32(127)), 23)); }
+static inline vfloat VGather(const float * table, vfloat index) { return _mm512_i32gather_ps(_mm512_cvttps_epi32(index), table, 4); }
+
+#elif !defined(MATH_KERNELS_SCALAR) && defined(__AVX2__) && defined(__FMA__)
+
+#define VEC_WIDTH 8
+#define VEC_NAME "AVX2"
+typedef __m256 vfloat;
+
+static inline __m256i VMask(int n) { return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)); }
+static inline vfloat VLoad(const float * p) { return _mm256_loadu_ps(p); }
+static inline void VStore(float * p, vfloat v) { _mm256_storeu_ps(p, v); }
+static inline vfloat VLoadN(const float * p, int n) { return _mm256_maskload_ps(p, VMask(n)); }
+static inline void VStoreN(float * p, vfloat v, int n) { _mm256_maskstore_ps(p, VMask(n), v); }
+static inline vfloat VSet(float v) { return _mm256_set1_ps(v); }
+static inline vfloat VFma(vfloat a, vfloat b, vfloat c) { return _mm256_fmadd_ps(a, b, c); }
+static inline vfloat VAdd(vfloat a, vfloat b) { return _mm256_add_ps(a, b); }
+static inline vfloat VSub(vfloat a, vfloat b) { return _mm256_sub_ps(a, b); }
+static inline vfloat VMul(vfloat a, vfloat b) { return _mm256_mul_ps(a, b); }
+static inline vfloat VDiv(vfloat a, vfloat b) { return _mm256_div_ps(a, b); }
+static inline vfloat VMin(vfloat a, vfloat b) { return _mm256_min_ps(a, b); }
+static inline vfloat VMax(vfloat a, vfloat b) { return _mm256_max_ps(a, b); }
+static inline vfloat VSqrt(vfloat v) { return _mm256_sqrt_ps(v); }
+static inline vfloat VFloor(vfloat v) { return _mm256_floor_ps(v); }
+static inline vfloat VPow2(vfloat n) { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127)), 23)); }
+static inline vfloat VGather(const float * table, vfloat index) { return _mm256_i32gather_ps(table, _mm256_cvttps_epi32(index), 4); }
+static inline float VSum(vfloat v)
+{
+	auto low = _mm256_castps256_ps128(v); auto high = _mm256_extractf128_ps(v, 1);
+	low = _mm_add_ps(low, high); low = _mm_hadd_ps(low, low); low = _mm_hadd_ps(low, low);
+	return _mm_cvtss_f32(low);
+}
+
+#else
+
+#define VEC_WIDTH 1
+#define VEC_NAME "Scalar"
+typedef float vfloat;
+
+static inline vfloat VLoad(const float * p) { return *p; }
+static inline void VStore(float * p, vfloat v) { *p = v; }
+static inline vfloat VLoadN(const float * p, int n) { return n > 0 ? *p : 0.0f; }
+static inline void VStoreN(float * p, vfloat v, int n) { if (n > 0) *p = v; }
+static inline vfloat VSet(float v) { return v; }
+static inline vfloat VFma(vfloat a, vfloat b, vfloat c) { return a * b + c; }
+static inline vfloat VAdd(vfloat a, vfloat b) { return a + b; }
+static inline vfloat VSub(vfloat a, vfloat b) { return a - b; }
+static inline vfloat VMul(vfloat a, vfloat b) { return a * b; }
+static inline vfloat VDiv(vfloat a, vfloat b) { return a / b; }
+static inline vfloat VMin(vfloat a, vfloat b) { return a < b ? a : b; }
+static inline vfloat VMax(vfloat a, vfloat b) { return a > b ? a : b; }
+static inline vfloat VSqrt(vfloat v) { return sqrtf(v); }
+static inline float VSum(vfloat v) { return v; }
+static inline vfloat VFloor(vfloat v) { return floorf(v); }
+static inline vfloat VGather(const float * table, vfloat index) { return table[(int) index]; }
+
+#endif
+
+// The cache blocks that the matrix product is split into
+#define BLOCK_K 128
+#define BLOCK_N 256
+
+//--------------------------------------------------
+// Integer Primitives
+//--------------------------------------------------
+
+// The INT8 product packs the weights into blocks of INT8_BLOCK columns, each holding groups of INT8_GROUP
+// consecutive inputs per column: one 4-byte group of activations is broadcast and multiplied against the
+// group of every column in the block at once, so the block's sums are found without any horizontal adds.
+// (INT8_BLOCK and INT8_GROUP are shared with the packing in MathKernels.)
+// Each pass over a block of weights serves INT8_ROWS rows, so that the weights are loaded once for all of them.
+// The activations are unsigned (offset by 128) and the weights signed, which is the operand order of VNNI.
+
+#if !defined(MATH_KERNELS_SCALAR) && defined(__AVX512VNNI__) && defined(__AVX512F__)
+
+#define INT8_NAME "AVX-512 VNNI"
+#define INT8_ROWS 4
+
+template <int Rows>
+static inline void DotBlockInt8(const uint8_t * a, int lda, const int8_t * packed, int groups, int32_t * result)
+{
+	__m512i sums[Rows];
+	for (auto r = 0; r < Rows; r++) sums[r] = _mm512_setzero_si512();
+
+	for (auto group = 0; group < groups; group++)
+	{
+		auto weights = _mm512_loadu_si512(packed + group * INT8_BLOCK * INT8_GROUP);
+
+		for (auto r = 0; r < Rows; r++)
+		{
+			int32_t values; memcpy(&values, a + r * lda + group * INT8_GROUP, sizeof(int32_t));
+			sums[r] = _mm512_dpbusd_epi32(sums[r], _mm512_set1_epi32(values), weights);
+		}
+	}
+
+	for (auto r = 0; r < Rows; r++) _mm512_storeu_si512(result + r * INT8_BLOCK, sums[r]);
+}
+
+#elif !defined(MATH_KERNELS_SCALAR) && defined(__AVX2__)
+
+#define INT8_NAME "AVX2"
+#define INT8_ROWS 2
+
+template <int Rows>
+static inline void DotBlockInt8(const uint8_t * a, int lda, const int8_t * packed, int groups, int32_t * result)
+{
+	// Each product pair is summed into an int32 by madd, leaving two partial sums per column that are folded at the end
+	__m256i sums[Rows][4];
+	for (auto r = 0; r < Rows; r++) for (auto part = 0; part < 4; part++) sums[r][part] = _mm256_setzero_si256();
+
+	for (auto group = 0; group < groups; group++)
+	{
+		__m256i weights[4]; auto source = packed + group * INT8_BLOCK * INT8_GROUP;
+		for (auto part = 0; part < 4; part++) weights[part] = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *) (source + part * 16)));
+
+		for (auto r = 0; r < Rows; r++)
+		{
+			int64_t values; auto bytes = a + r * lda + group * INT8_GROUP;
+			int16_t words[4] = { bytes[0], bytes[1], bytes[2], bytes[3] }; memcpy(&values, words, sizeof(int64_t));
+			auto x = _mm256_set1_epi64x(values);
+			for (auto part = 0; part < 4; part++) sums[r][part] = _mm256_add_epi32(sums[r][part], _mm256_madd_epi16(x, weights[part]));
+		}
+	}
+
+	for (auto r = 0; r < Rows; r++) for (auto half = 0; half < 2; half++)
+	{
+		auto folded = _mm256_permute4x64_epi64(_mm256_hadd_epi32(sums[r][2 * half], sums[r][2 * half + 1]), 0xD8);
+		_mm256_storeu_si256((__m256i *) (result + r * INT8_BLOCK + 8 * half), folded);
+	}
+}
+
+#else
+
+#define INT8_NAME "Scalar"
+#define INT8_ROWS 1
+
+template <int Rows>
+static inline void DotBlockInt8(const uint8_t * a, int lda, const int8_t * packed, int groups, int32_t * result)
+{
+	for (auto column = 0; column < Rows * INT8_BLOCK; column++) result[column] = 0;
+
+	for (auto group = 0; group < groups; group++)
+	{
+		auto weights = packed + group * INT8_BLOCK * INT8_GROUP;
+
+		for (auto r = 0; r < Rows; r++)
+		{
+			auto x = a + r * lda + group * INT8_GROUP;
+			for (auto column = 0; column < INT8_BLOCK; column++)
+			{
+				auto w = weights + column * INT8_GROUP;
+				result[r * INT8_BLOCK + column] += x[0] * w[0] + x[1] * w[1] + x[2] * w[2] + x[3] * w[3];
+			}
+		}
+	}
+}
+
+#endif
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+static void Axpy(float alpha, const float * x, float * y, int n);
+static float Dot(const float * a, const float * b, int n);
+
+/**
+ * @brief The smaller of two counts (std::min is not used here, for the reason given at the top of the file)
+ */
+static inline int Least(int a, int b)
+{
+	return a < b ? a : b;
+}
+
+/**
+ * @brief Set a run of values to zero
+ */
+static inline void Clear(float * data, int n)
+{
+	for (auto i = 0; i < n; i++) data[i] = 0.0f;
+}
+
+/**
+ * @brief Exponential of each lane (Cephes style range reduction and polynomial, accurate to about 1e-7).
+ * The input is clamped so that the result always stays finite.
+ * @param x The values that we are finding the exponential of
+ * @return vfloat The exponentials
+ */
+static inline vfloat VExp(vfloat x)
+{
+	x = VMin(VMax(x, VSet(-87.3f)), VSet(88.3f));
+
+#if VEC_WIDTH == 1
+	return expf(x);
+#else
+	auto n = VFloor(VFma(x, VSet(1.44269504088896341f), VSet(0.5f)));
+	x = VSub(x, VMul(n, VSet(0.693359375f)));
+	x = VSub(x, VMul(n, VSet(-2.12194440e-4f)));
+
+	auto y = VSet(1.9875691500e-4f);
+	y = VFma(y, x, VSet(1.3981999507e-3f));
+	y = VFma(y, x, VSet(8.3334519073e-3f));
+	y = VFma(y, x, VSet(4.1665795894e-2f));
+	y = VFma(y, x, VSet(1.6666665459e-1f));
+	y = VFma(y, x, VSet(5.0000001201e-1f));
+	y = VFma(y, VMul(x, x), VAdd(x, VSet(1.0f)));
+
+	return VMul(y, VPow2(n));
+#endif
+}
+
+/**
+ * @brief Retrieve an element of the left-hand matrix, which may be stored transposed
+ */
+template <bool TransA>
+static inline float GetA(const float * a, int lda, int i, int p)
+{
+	return TransA ? a[p * lda + i] : a[i * lda + p];
+}
+
+/**
+ * @brief Compute a 4 row by 2 vector tile of the product, keeping the tile in registers across the k block
+ */
+template <bool TransA>
+static inline void MultiplyTile(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int i, int j, int k0, int k1, bool add)
+{
+	auto c0 = c + i * ldc + j; auto c1 = c0 + ldc; auto c2 = c1 + ldc; auto c3 = c2 + ldc;
+
+	auto zero = VSet(0.0f);
+	vfloat t00 = add ? VLoad(c0) : zero, t01 = add ? VLoad(c0 + VEC_WIDTH) : zero;
+	vfloat t10 = add ? VLoad(c1) : zero, t11 = add ? VLoad(c1 + VEC_WIDTH) : zero;
+	vfloat t20 = add ? VLoad(c2) : zero, t21 = add ? VLoad(c2 + VEC_WIDTH) : zero;
+	vfloat t30 = add ? VLoad(c3) : zero, t31 = add ? VLoad(c3 + VEC_WIDTH) : zero;
+
+	for (auto p = k0; p < k1; p++)
+	{
+		auto row = b + p * ldb + j;
+		auto b0 = VLoad(row); auto b1 = VLoad(row + VEC_WIDTH);
+
+		auto a0 = VSet(GetA<TransA>(a, lda, i, p)); t00 = VFma(a0, b0, t00); t01 = VFma(a0, b1, t01);
+		auto a1 = VSet(GetA<TransA>(a, lda, i + 1, p)); t10 = VFma(a1, b0, t10); t11 = VFma(a1, b1, t11);
+		auto a2 = VSet(GetA<TransA>(a, lda, i + 2, p)); t20 = VFma(a2, b0, t20); t21 = VFma(a2, b1, t21);
+		auto a3 = VSet(GetA<TransA>(a, lda, i + 3, p)); t30 = VFma(a3, b0, t30); t31 = VFma(a3, b1, t31);
+	}
+
+	VStore(c0, t00); VStore(c0 + VEC_WIDTH, t01);
+	VStore(c1, t10); VStore(c1 + VEC_WIDTH, t11);
+	VStore(c2, t20); VStore(c2 + VEC_WIDTH, t21);
+	VStore(c3, t30); VStore(c3 + VEC_WIDTH, t31);
+}
+
+/**
+ * @brief Compute a 4 row tile that is at most one vector wide, which covers the ragged right-hand edge of the product
+ */
+template <bool TransA>
+static inline void MultiplyEdge(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int i, int j, int width, int k0, int k1, bool add)
+{
+	auto c0 = c + i * ldc + j; auto c1 = c0 + ldc; auto c2 = c1 + ldc; auto c3 = c2 + ldc;
+
+	auto zero = VSet(0.0f);
+	vfloat t0 = add ? VLoadN(c0, width) : zero, t1 = add ? VLoadN(c1, width) : zero;
+	vfloat t2 = add ? VLoadN(c2, width) : zero, t3 = add ? VLoadN(c3, width) : zero;
+
+	for (auto p = k0; p < k1; p++)
+	{
+		auto row = VLoadN(b + p * ldb + j, width);
+		t0 = VFma(VSet(GetA<TransA>(a, lda, i, p)), row, t0);
+		t1 = VFma(VSet(GetA<TransA>(a, lda, i + 1, p)), row, t1);
+		t2 = VFma(VSet(GetA<TransA>(a, lda, i + 2, p)), row, t2);
+		t3 = VFma(VSet(GetA<TransA>(a, lda, i + 3, p)), row, t3);
+	}
+
+	VStoreN(c0, t0, width); VStoreN(c1, t1, width); VStoreN(c2, t2, width); VStoreN(c3, t3, width);
+}
+
+/**
+ * @brief The cache blocked matrix product C (+)= op(A) * B, where op(A) is m x k and B is k x n
+ */
+template <bool TransA>
+static void MultiplyBlocked(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate)
+{
+	const int tileWidth = 2 * VEC_WIDTH;
+
+	if (k == 0 && !accumulate) { for (auto i = 0; i < m; i++) Clear(c + i * ldc, n); return; }
+
+	for (auto k0 = 0; k0 < k; k0 += BLOCK_K)
+	{
+		auto k1 = Least(k, k0 + BLOCK_K); auto add = accumulate || k0 > 0;
+
+		for (auto j0 = 0; j0 < n; j0 += BLOCK_N)
+		{
+			auto j1 = Least(n, j0 + BLOCK_N); auto i = 0;
+
+			for (; i + 4 <= m; i += 4)
+			{
+				auto j = j0;
+				for (; j + tileWidth <= j1; j += tileWidth) MultiplyTile<TransA>(a, lda, b, ldb, c, ldc, i, j, k0, k1, add);
+				for (; j < j1; j += VEC_WIDTH) MultiplyEdge<TransA>(a, lda, b, ldb, c, ldc, i, j, Least(VEC_WIDTH, j1 - j), k0, k1, add);
+			}
+
+			for (; i < m; i++)
+			{
+				auto row = c + i * ldc;
+				if (!add) Clear(row + j0, j1 - j0);
+				for (auto p = k0; p < k1; p++) Axpy(GetA<TransA>(a, lda, i, p), b + p * ldb + j0, row + j0, j1 - j0);
+			}
+		}
+	}
+}
+
+//--------------------------------------------------
+// Matrix Products
+//--------------------------------------------------
+
+/**
+ * @brief Compute C = A * B (or C += A * B)
+ */
+static void Multiply(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate)
+{
+	MultiplyBlocked<false>(a, lda, b, ldb, c, ldc, m, n, k, accumulate);
+}
+
+/**
+ * @brief Compute C = A^T * B (or C += A^T * B)
+ */
+static void MultiplyTransA(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate)
+{
+	MultiplyBlocked<true>(a, lda, b, ldb, c, ldc, m, n, k, accumulate);
+}
+
+/**
+ * @brief Compute C = A * B^T, where each element is a dot product of two contiguous rows
+ */
+static void MultiplyTransB(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k)
+{
+	for (auto i = 0; i < m; i++)
+	{
+		for (auto j = 0; j < n; j++) c[i * ldc + j] = Dot(a + i * lda, b + j * ldb, k);
+	}
+}
+
+//--------------------------------------------------
+// Vector Operations
+//--------------------------------------------------
+
+/**
+ * @brief The dot product of two vectors
+ */
+static float Dot(const float * a, const float * b, int n)
+{
+	auto sum0 = VSet(0.0f); auto sum1 = VSet(0.0f); auto i = 0;
+
+	for (; i + 2 * VEC_WIDTH <= n; i += 2 * VEC_WIDTH)
+	{
+		sum0 = VFma(VLoad(a + i), VLoad(b + i), sum0);
+		sum1 = VFma(VLoad(a + i + VEC_WIDTH), VLoad(b + i + VEC_WIDTH), sum1);
+	}
+
+	for (; i < n; i += VEC_WIDTH)
+	{
+		auto width = Least(VEC_WIDTH, n - i);
+		sum0 = VFma(VLoadN(a + i, width), VLoadN(b + i, width), sum0);
+	}
+
+	return VSum(VAdd(sum0, sum1));
+}
+
+/**
+ * @brief Compute y += alpha * x
+ */
+static void Axpy(float alpha, const float * x, float * y, int n)
+{
+	auto scale = VSet(alpha); auto i = 0;
+
+	for (; i + VEC_WIDTH <= n; i += VEC_WIDTH) VStore(y + i, VFma(scale, VLoad(x + i), VLoad(y + i)));
+	if (i < n) VStoreN(y + i, VFma(scale, VLoadN(x + i, n - i), VLoadN(y + i, n - i)), n - i);
+}
+
+/**
+ * @brief Apply a momentum step to a block of weights, deltas = momentum * deltas + rate * gradient, weights += deltas
+ */
+static void MomentumUpdate(float * weights, float * deltas, const float * gradient, float rate, float momentum, int n)
+{
+	auto scale = VSet(rate); auto carry = VSet(momentum);
+
+	for (auto i = 0; i < n; i += VEC_WIDTH)
+	{
+		auto width = Least(VEC_WIDTH, n - i);
+		auto step = VFma(scale, VLoadN(gradient + i, width), VMul(carry, VLoadN(deltas + i, width)));
+		VStoreN(deltas + i, step, width); VStoreN(weights + i, VAdd(VLoadN(weights + i, width), step), width);
+	}
+}
+
+/**
+ * @brief Apply an Adam step to a block of weights. The bias corrections are folded into the rate by the caller.
+ */
+static void AdamUpdate(float * weights, float * first, float * second, const float * gradient, float rate, float beta1, float beta2, float epsilon, int n)
+{
+	auto b1 = VSet(beta1), c1 = VSet(1.0f - beta1), b2 = VSet(beta2), c2 = VSet(1.0f - beta2), scale = VSet(rate), floor = VSet(epsilon);
+
+	for (auto i = 0; i < n; i += VEC_WIDTH)
+	{
+		auto width = Least(VEC_WIDTH, n - i); auto g = VLoadN(gradient + i, width);
+		auto m = VFma(b1, VLoadN(first + i, width), VMul(c1, g));
+		auto v = VFma(b2, VLoadN(second + i, width), VMul(c2, VMul(g, g)));
+		VStoreN(first + i, m, width); VStoreN(second + i, v, width);
+		VStoreN(weights + i, VFma(scale, VDiv(m, VAdd(VSqrt(v), floor)), VLoadN(weights + i, width)), width);
+	}
+}
+
+/**
+ * @brief Apply an RMSProp step to a block of weights
+ */
+static void RMSPropUpdate(float * weights, float * average, const float * gradient, float rate, float decay, float epsilon, int n)
+{
+	auto keep = VSet(decay), add = VSet(1.0f - decay), scale = VSet(rate), floor = VSet(epsilon);
+
+	for (auto i = 0; i < n; i += VEC_WIDTH)
+	{
+		auto width = Least(VEC_WIDTH, n - i); auto g = VLoadN(gradient + i, width);
+		auto v = VFma(keep, VLoadN(average + i, width), VMul(add, VMul(g, g)));
+		VStoreN(average + i, v, width);
+		VStoreN(weights + i, VFma(scale, VDiv(g, VAdd(VSqrt(v), floor)), VLoadN(weights + i, width)), width);
+	}
+}
+
+//--------------------------------------------------
+// Integer Products
+//--------------------------------------------------
+
+/**
+ * @brief Find C = A * B over 8-bit values with 32-bit sums, where A holds unsigned activations and B holds packed
+ * signed weights. Each row of A must have k rounded up to a multiple of 4 readable bytes (the padding is multiplied
+ * by zero weights, so its value does not matter).
+ */
+static void MultiplyInt8(const uint8_t * a, int lda, const int8_t * packed, int32_t * c, int ldc, int m, int n, int k)
+{
+	auto blocks = (n + INT8_BLOCK - 1) / INT8_BLOCK; auto groups = (k + INT8_GROUP - 1) / INT8_GROUP;
+	alignas(64) int32_t sums[INT8_ROWS * INT8_BLOCK];
+
+	for (auto block = 0; block < blocks; block++)
+	{
+		auto weights = packed + block * groups * INT8_BLOCK * INT8_GROUP;
+		auto width = Least(INT8_BLOCK, n - block * INT8_BLOCK);
+
+		for (auto row = 0; row < m; row += INT8_ROWS)
+		{
+			auto rows = Least(INT8_ROWS, m - row);
+			if (rows == INT8_ROWS) DotBlockInt8<INT8_ROWS>(a + row * lda, lda, weights, groups, sums);
+			else for (auto r = 0; r < rows; r++) DotBlockInt8<1>(a + (row + r) * lda, lda, weights, groups, sums + r * INT8_BLOCK);
+
+			for (auto r = 0; r < rows; r++)
+			{
+				auto result = c + (row + r) * ldc + block * INT8_BLOCK;
+				for (auto column = 0; column < width; column++) result[column] = sums[r * INT8_BLOCK + column];
+			}
+		}
+	}
+}
+
+//--------------------------------------------------
+// Activation
+//--------------------------------------------------
+
+/**
+ * @brief Add the bias and apply the symmetric sigmoid in a single pass, y = beta * (1 - e^(-alpha * x)) / (1 + e^(-alpha * x))
+ */
+static void SigmoidSym(float * data, int ld, const float * bias, int rows, int cols, float alpha, float beta)
+{
+	auto scale = VSet(-alpha); auto range = VSet(beta); auto one = VSet(1.0f);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto values = data + row * ld;
+
+		for (auto column = 0; column < cols; column += VEC_WIDTH)
+		{
+			auto width = Least(VEC_WIDTH, cols - column);
+			auto e = VExp(VMul(VAdd(VLoadN(values + column, width), VLoadN(bias + column, width)), scale));
+			VStoreN(values + column, VMul(range, VDiv(VSub(one, e), VAdd(one, e))), width);
+		}
+	}
+}
+
+/**
+ * @brief Scale a gradient by the derivative of the symmetric sigmoid, which is found from the activations as alpha / (2 * beta) * (beta^2 - y^2)
+ */
+static void SigmoidSymGradient(const float * outputs, int ldo, float * gradient, int ldg, int rows, int cols, float alpha, float beta)
+{
+	auto scale = VSet(alpha / (2.0f * beta)); auto range = VSet(beta * beta);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto y = outputs + row * ldo; auto g = gradient + row * ldg;
+
+		for (auto column = 0; column < cols; column += VEC_WIDTH)
+		{
+			auto width = Least(VEC_WIDTH, cols - column);
+			auto value = VLoadN(y + column, width);
+			auto derivative = VMul(scale, VSub(range, VMul(value, value)));
+			VStoreN(g + column, VMul(VLoadN(g + column, width), derivative), width);
+		}
+	}
+}
+
+/**
+ * @brief Replace each value with a piecewise-linear lookup into a table of samples, which is how the INT8 network
+ * evaluates its activation. Values beyond the ends of the table are clamped to the first and last samples.
+ */
+static void LookupTable(float * data, int count, const float * table, int size, float start, float step)
+{
+	auto offset = VSet(start); auto scale = VSet(1.0f / step); auto low = VSet(0.0f); auto high = VSet(size - 1e-3f);
+
+	for (auto i = 0; i < count; i += VEC_WIDTH)
+	{
+		auto width = Least(VEC_WIDTH, count - i);
+		auto position = VMin(VMax(VMul(VSub(VLoadN(data + i, width), offset), scale), low), high);
+		auto index = VFloor(position); auto fraction = VSub(position, index);
+
+		auto left = VGather(table, index); auto right = VGather(table + 1, index);
+		VStoreN(data + i, VFma(fraction, VSub(right, left), left), width);
+	}
+}
+
+//--------------------------------------------------
+// Table
+//--------------------------------------------------
+
+/**
+ * @brief Hand out the kernels of this instruction set
+ * @return MathKernelTable The kernels
+ */
+NVL_AI::MathKernelTable NVL_AI::KERNEL_TABLE()
+{
+	auto result = MathKernelTable();
+
+	result.Name = VEC_NAME; result.Int8Name = INT8_NAME;
+	result.Multiply = Multiply; result.MultiplyTransA = MultiplyTransA; result.MultiplyTransB = MultiplyTransB;
+	result.Dot = Dot; result.Axpy = Axpy;
+	result.MomentumUpdate = MomentumUpdate; result.AdamUpdate = AdamUpdate; result.RMSPropUpdate = RMSPropUpdate;
+	result.SigmoidSym = SigmoidSym; result.SigmoidSymGradient = SigmoidSymGradient; result.LookupTable = LookupTable;
+	result.MultiplyInt8 = MultiplyInt8;
+
+	return result;
+}
@@ -0,0 +1,47 @@
+//--------------------------------------------------
+// The set of kernels that is built once for each instruction set, and picked at run time by MathKernels
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+// The layout of the packed INT8 weights, which every instruction set reads in the same way (see MathKernelBody.h)
+#define INT8_BLOCK 16
+#define INT8_GROUP 4
+
+namespace NVL_AI
+{
+	struct MathKernelTable
+	{
+		const char * Name;
+		const char * Int8Name;
+
+		void (*Multiply)(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate);
+		void (*MultiplyTransA)(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate);
+		void (*MultiplyTransB)(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k);
+
+		float (*Dot)(const float * a, const float * b, int n);
+		void (*Axpy)(float alpha, const float * x, float * y, int n);
+
+		void (*MomentumUpdate)(float * weights, float * deltas, const float * gradient, float rate, float momentum, int n);
+		void (*AdamUpdate)(float * weights, float * first, float * second, const float * gradient, float rate, float beta1, float beta2, float epsilon, int n);
+		void (*RMSPropUpdate)(float * weights, float * average, const float * gradient, float rate, float decay, float epsilon, int n);
+
+		void (*SigmoidSym)(float * data, int ld, const float * bias, int rows, int cols, float alpha, float beta);
+		void (*SigmoidSymGradient)(const float * outputs, int ldo, float * gradient, int ldg, int rows, int cols, float alpha, float beta);
+		void (*LookupTable)(float * data, int count, const float * table, int size, float start, float step);
+
+		void (*MultiplyInt8)(const uint8_t * a, int lda, const int8_t * packed, int32_t * c, int ldc, int m, int n, int k);
+	};
+
+	// Each of these is defined by its own translation unit, compiled for that instruction set (see MathKernelBody.h)
+	MathKernelTable GetScalarKernels();
+	MathKernelTable GetAVX2Kernels();
+	MathKernelTable GetAVX512Kernels();
+	MathKernelTable GetVNNIKernels();
+}
@@ -0,0 +1,304 @@
+//--------------------------------------------------
+// Implementation of class MathKernels
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "MathKernels.h"
+#include "MathKernelTable.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Dispatch
+//--------------------------------------------------
+
+/**
+ * @brief Pick the kernels for the widest instruction set that this CPU supports. Each set is built into the library
+ * with its own compiler flags, so that a default build runs anywhere and still uses AVX2 or AVX-512 where they exist.
+ * @return MathKernelTable The kernels
+ */
+static MathKernelTable SelectKernels()
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("fma")) return GetVNNIKernels();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma")) return GetAVX512Kernels();
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return GetAVX2Kernels();
+
+	return GetScalarKernels();
+}
+
+/**
+ * @brief Retrieve the kernels for this CPU, which are picked on first use
+ * @return const MathKernelTable& The kernels
+ */
+static const MathKernelTable& Kernels()
+{
+	static const MathKernelTable kernels = SelectKernels();
+	return kernels;
+}
+
+//--------------------------------------------------
+// Matrix Products
+//--------------------------------------------------
+
+/**
+ * @brief Compute C = A * B (or C += A * B)
+ * @param a The m x k left-hand matrix
+ * @param lda The row stride of A (in elements)
+ * @param b The k x n right-hand matrix
+ * @param ldb The row stride of B (in elements)
+ * @param c The m x n result
+ * @param ldc The row stride of C (in elements)
+ * @param m The number of rows in the result
+ * @param n The number of columns in the result
+ * @param k The shared dimension
+ * @param accumulate Add the product to C rather than overwriting it
+ */
+void MathKernels::Multiply(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate)
+{
+	Kernels().Multiply(a, lda, b, ldb, c, ldc, m, n, k, accumulate);
+}
+
+/**
+ * @brief Compute C = A^T * B (or C += A^T * B)
+ * @param a The k x m left-hand matrix (used transposed)
+ * @param lda The row stride of A (in elements)
+ * @param b The k x n right-hand matrix
+ * @param ldb The row stride of B (in elements)
+ * @param c The m x n result
+ * @param ldc The row stride of C (in elements)
+ * @param m The number of rows in the result
+ * @param n The number of columns in the result
+ * @param k The shared dimension
+ * @param accumulate Add the product to C rather than overwriting it
+ */
+void MathKernels::MultiplyTransA(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate)
+{
+	Kernels().MultiplyTransA(a, lda, b, ldb, c, ldc, m, n, k, accumulate);
+}
+
+/**
+ * @brief Compute C = A * B^T, where each element is a dot product of two contiguous rows
+ * @param a The m x k left-hand matrix
+ * @param lda The row stride of A (in elements)
+ * @param b The n x k right-hand matrix (used transposed)
+ * @param ldb The row stride of B (in elements)
+ * @param c The m x n result
+ * @param ldc The row stride of C (in elements)
+ * @param m The number of rows in the result
+ * @param n The number of columns in the result
+ * @param k The shared dimension
+ */
+void MathKernels::MultiplyTransB(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k)
+{
+	Kernels().MultiplyTransB(a, lda, b, ldb, c, ldc, m, n, k);
+}
+
+//--------------------------------------------------
+// Vector Operations
+//--------------------------------------------------
+
+/**
+ * @brief The dot product of two vectors
+ * @param a The first vector
+ * @param b The second vector
+ * @param n The length of the vectors
+ * @return float The dot product
+ */
+float MathKernels::Dot(const float * a, const float * b, int n)
+{
+	return Kernels().Dot(a, b, n);
+}
+
+/**
+ * @brief Compute y += alpha * x
+ * @param alpha The scale applied to x
+ * @param x The vector being added
+ * @param y The vector being updated
+ * @param n The length of the vectors
+ */
+void MathKernels::Axpy(float alpha, const float * x, float * y, int n)
+{
+	Kernels().Axpy(alpha, x, y, n);
+}
+
+/**
+ * @brief Apply a momentum step to a block of weights, deltas = momentum * deltas + rate * gradient, weights += deltas
+ * @param weights The weights that are being updated
+ * @param deltas The previous step, which is replaced by the current step
+ * @param gradient The descent direction for the weights
+ * @param rate The learning rate
+ * @param momentum The fraction of the previous step that is carried forward
+ * @param n The number of weights
+ */
+void MathKernels::MomentumUpdate(float * weights, float * deltas, const float * gradient, float rate, float momentum, int n)
+{
+	Kernels().MomentumUpdate(weights, deltas, gradient, rate, momentum, n);
+}
+
+/**
+ * @brief Apply an Adam step to a block of weights. The bias corrections are folded into the rate by the caller.
+ * @param weights The weights that are being updated
+ * @param first The running mean of the gradient
+ * @param second The running mean of the squared gradient
+ * @param gradient The descent direction for the weights
+ * @param rate The (bias corrected) learning rate
+ * @param beta1 The decay of the first moment
+ * @param beta2 The decay of the second moment
+ * @param epsilon The term that keeps the denominator away from zero
+ * @param n The number of weights
+ */
+void MathKernels::AdamUpdate(float * weights, float * first, float * second, const float * gradient, float rate, float beta1, float beta2, float epsilon, int n)
+{
+	Kernels().AdamUpdate(weights, first, second, gradient, rate, beta1, beta2, epsilon, n);
+}
+
+/**
+ * @brief Apply an RMSProp step to a block of weights
+ * @param weights The weights that are being updated
+ * @param average The running mean of the squared gradient
+ * @param gradient The descent direction for the weights
+ * @param rate The learning rate
+ * @param decay The decay of the running mean
+ * @param epsilon The term that keeps the denominator away from zero
+ * @param n The number of weights
+ */
+void MathKernels::RMSPropUpdate(float * weights, float * average, const float * gradient, float rate, float decay, float epsilon, int n)
+{
+	Kernels().RMSPropUpdate(weights, average, gradient, rate, decay, epsilon, n);
+}
+
+//--------------------------------------------------
+// Integer Products
+//--------------------------------------------------
+
+/**
+ * @brief The number of bytes that a block of weights takes up once it is packed for MultiplyInt8
+ * @param n The number of columns (outputs)
+ * @param k The number of rows (inputs)
+ * @return int The size of the packed weights (in bytes)
+ */
+int MathKernels::GetPackedInt8Size(int n, int k)
+{
+	auto blocks = (n + INT8_BLOCK - 1) / INT8_BLOCK; auto groups = (k + INT8_GROUP - 1) / INT8_GROUP;
+	return blocks * groups * INT8_BLOCK * INT8_GROUP;
+}
+
+/**
+ * @brief Pack a k x n block of weights into the layout that MultiplyInt8 reads, padding the ragged edges with zeros
+ * @param b The weights (one row per input)
+ * @param ldb The row stride of the weights (in elements)
+ * @param n The number of columns (outputs)
+ * @param k The number of rows (inputs)
+ * @param packed The packed weights (GetPackedInt8Size bytes)
+ */
+void MathKernels::PackInt8(const int8_t * b, int ldb, int n, int k, int8_t * packed)
+{
+	auto blocks = (n + INT8_BLOCK - 1) / INT8_BLOCK; auto groups = (k + INT8_GROUP - 1) / INT8_GROUP;
+	memset(packed, 0, GetPackedInt8Size(n, k));
+
+	for (auto block = 0; block < blocks; block++) for (auto group = 0; group < groups; group++)
+	{
+		auto target = packed + (block * groups + group) * INT8_BLOCK * INT8_GROUP;
+
+		for (auto column = 0; column < INT8_BLOCK; column++) for (auto offset = 0; offset < INT8_GROUP; offset++)
+		{
+			auto j = block * INT8_BLOCK + column; auto p = group * INT8_GROUP + offset;
+			if (j < n && p < k) target[column * INT8_GROUP + offset] = b[p * ldb + j];
+		}
+	}
+}
+
+/**
+ * @brief Find C = A * B over 8-bit values with 32-bit sums, where A holds unsigned activations and B holds packed
+ * signed weights. Each row of A must have k rounded up to a multiple of 4 readable bytes (the padding is multiplied
+ * by zero weights, so its value does not matter).
+ * @param a The activations (m x k)
+ * @param lda The row stride of the activations (in bytes)
+ * @param packed The weights, packed by PackInt8
+ * @param c The result (m x n)
+ * @param ldc The row stride of the result (in elements)
+ * @param m The number of rows
+ * @param n The number of columns
+ * @param k The inner dimension
+ */
+void MathKernels::MultiplyInt8(const uint8_t * a, int lda, const int8_t * packed, int32_t * c, int ldc, int m, int n, int k)
+{
+	Kernels().MultiplyInt8(a, lda, packed, c, ldc, m, n, k);
+}
+
+
+//--------------------------------------------------
+// Activation
+//--------------------------------------------------
+
+/**
+ * @brief Add the bias and apply the symmetric sigmoid in a single pass, y = beta * (1 - e^(-alpha * x)) / (1 + e^(-alpha * x))
+ * @param data The sums that are replaced by the activations
+ * @param ld The row stride of the data (in elements)
+ * @param bias The bias for each column
+ * @param rows The number of rows
+ * @param cols The number of columns
+ * @param alpha The slope of the sigmoid
+ * @param beta The range of the sigmoid
+ */
+void MathKernels::SigmoidSym(float * data, int ld, const float * bias, int rows, int cols, float alpha, float beta)
+{
+	Kernels().SigmoidSym(data, ld, bias, rows, cols, alpha, beta);
+}
+
+/**
+ * @brief Scale a gradient by the derivative of the symmetric sigmoid, which is found from the activations as alpha / (2 * beta) * (beta^2 - y^2)
+ * @param outputs The activations of the layer
+ * @param ldo The row stride of the activations (in elements)
+ * @param gradient The gradient that is scaled in place
+ * @param ldg The row stride of the gradient (in elements)
+ * @param rows The number of rows
+ * @param cols The number of columns
+ * @param alpha The slope of the sigmoid
+ * @param beta The range of the sigmoid
+ */
+void MathKernels::SigmoidSymGradient(const float * outputs, int ldo, float * gradient, int ldg, int rows, int cols, float alpha, float beta)
+{
+	Kernels().SigmoidSymGradient(outputs, ldo, gradient, ldg, rows, cols, alpha, beta);
+}
+
+/**
+ * @brief Replace each value with a piecewise-linear lookup into a table of samples, which is how the INT8 network
+ * evaluates its activation. Values beyond the ends of the table are clamped to the first and last samples.
+ * @param data The values, which are replaced by the looked-up results
+ * @param count The number of values
+ * @param table The samples (size + 1 of them)
+ * @param size The number of steps in the table
+ * @param start The value of the first sample
+ * @param step The distance between neighbouring samples
+ */
+void MathKernels::LookupTable(float * data, int count, const float * table, int size, float start, float step)
+{
+	Kernels().LookupTable(data, count, table, size, start, step);
+}
+
+//--------------------------------------------------
+// Details
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the name of the instruction set that the kernels picked for this CPU were built for
+ * @return string The name of the instruction set
+ */
+string MathKernels::GetInstructionSet()
+{
+	return Kernels().Name;
+}
+
+/**
+ * @brief Retrieve the name of the instruction set that the INT8 kernels picked for this CPU were built for
+ * @return string The name of the instruction set
+ */
+string MathKernels::GetInt8InstructionSet()
+{
+	return Kernels().Int8Name;
+}
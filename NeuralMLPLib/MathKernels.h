@@ -0,0 +1,45 @@
+//--------------------------------------------------
+// Vectorized matrix kernels used by the native network
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+namespace NVL_AI
+{
+	class MathKernels
+	{
+	public:
+		static void Multiply(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate);
+		static void MultiplyTransA(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k, bool accumulate);
+		static void MultiplyTransB(const float * a, int lda, const float * b, int ldb, float * c, int ldc, int m, int n, int k);
+
+		static float Dot(const float * a, const float * b, int n);
+		static void Axpy(float alpha, const float * x, float * y, int n);
+
+		static void MomentumUpdate(float * weights, float * deltas, const float * gradient, float rate, float momentum, int n);
+		static void AdamUpdate(float * weights, float * first, float * second, const float * gradient, float rate, float beta1, float beta2, float epsilon, int n);
+		static void RMSPropUpdate(float * weights, float * average, const float * gradient, float rate, float decay, float epsilon, int n);
+
+		static void SigmoidSym(float * data, int ld, const float * bias, int rows, int cols, float alpha, float beta);
+		static void SigmoidSymGradient(const float * outputs, int ldo, float * gradient, int ldg, int rows, int cols, float alpha, float beta);
+		static void LookupTable(float * data, int count, const float * table, int size, float start, float step);
+
+		static int GetPackedInt8Size(int n, int k);
+		static void PackInt8(const int8_t * b, int ldb, int n, int k, int8_t * packed);
+		static void MultiplyInt8(const uint8_t * a, int lda, const int8_t * packed, int32_t * c, int ldc, int m, int n, int k);
+
+		static string GetInstructionSet();
+		static string GetInt8InstructionSet();
+	};
+}
@@ -0,0 +1,10 @@
+//--------------------------------------------------
+// The MathKernels built for AVX2 and FMA (-mavx2 -mfma)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#define KERNEL_TABLE GetAVX2Kernels
+#include "MathKernelBody.h"
@@ -0,0 +1,10 @@
+//--------------------------------------------------
+// The MathKernels built for AVX-512 (-mavx512f -mfma)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#define KERNEL_TABLE GetAVX512Kernels
+#include "MathKernelBody.h"
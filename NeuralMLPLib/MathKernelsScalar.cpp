@@ -0,0 +1,11 @@
+//--------------------------------------------------
+// The scalar MathKernels, which run on any CPU (the compiler flags do not matter)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#define MATH_KERNELS_SCALAR
+#define KERNEL_TABLE GetScalarKernels
+#include "MathKernelBody.h"
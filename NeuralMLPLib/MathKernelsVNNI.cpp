@@ -0,0 +1,10 @@
+//--------------------------------------------------
+// The MathKernels built for AVX-512 with VNNI (-mavx512f -mavx512vnni -mfma), which only changes the INT8 product
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#define KERNEL_TABLE GetVNNIKernels
+#include "MathKernelBody.h"
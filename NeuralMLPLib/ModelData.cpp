@@ -0,0 +1,83 @@
+//--------------------------------------------------
+// Implementation of class ModelData
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ModelData.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Create an empty model. The weights follow the ANN_MLP layout: [0] is the input scale, [1 .. L-1] hold a
+ * (previous + 1) x current block for each layer with the bias in the last row, [L] is the output scale and [L+1] is the
+ * inverse output scale that maps targets into the range of the network.
+ * @param layerSizes The number of neurons in each layer (including the input and output layers)
+ * @param learnRate The learning rate that the network is trained with
+ * @param momentum The momentum that the network is trained with
+ * @param alpha The slope of the symmetric sigmoid
+ * @param beta The range of the symmetric sigmoid
+ */
+ModelData::ModelData(const vector<int>& layerSizes, double learnRate, double momentum, double alpha, double beta) :
+	_layerSizes(layerSizes), _learnRate(learnRate), _momentum(momentum), _alpha(alpha), _beta(beta)
+{
+	if (layerSizes.size() < 2) throw runtime_error("A network needs at least an input and an output layer");
+
+	auto layerCount = (int) layerSizes.size();
+
+	_weights.push_back(Mat_<double>::zeros(1, 2 * layerSizes[0]));
+	for (auto i = 1; i < layerCount; i++) _weights.push_back(Mat_<double>::zeros(layerSizes[i - 1] + 1, layerSizes[i]));
+	_weights.push_back(Mat_<double>::zeros(1, 2 * layerSizes[layerCount - 1]));
+	_weights.push_back(Mat_<double>::zeros(1, 2 * layerSizes[layerCount - 1]));
+}
+
+/**
+ * @brief Take a copy of the weights of an OpenCV network. ANN_MLP does not expose its activation parameters, so the
+ * SIGMOID_SYM defaults that NeuralUtils::CreateNetwork relies on are assumed.
+ * @param network The network that we are copying
+ */
+ModelData::ModelData(Ptr<ml::ANN_MLP>& network)
+{
+	Mat layers = network->getLayerSizes();
+	for (auto i = 0; i < (int) layers.total(); i++) _layerSizes.push_back(((int *) layers.data)[i]);
+
+	_learnRate = network->getBackpropWeightScale();
+	_momentum = network->getBackpropMomentumScale();
+	_alpha = 2.0 / 3.0; _beta = 1.7159;
+
+	for (auto i = 0; i < (int) _layerSizes.size() + 2; i++) _weights.push_back(network->getWeights(i).clone());
+}
+
+//--------------------------------------------------
+// Conversion
+//--------------------------------------------------
+
+/**
+ * @brief Build an OpenCV network that holds these weights, which is how models are written in the ANN_MLP file format.
+ * Note that ANN_MLP only allows predict() on networks that have been trained or read, so a network that is going to
+ * predict should come from NeuralUtils::ReadNetwork() instead.
+ * @return Ptr<ml::ANN_MLP> The resultant network
+ */
+Ptr<ml::ANN_MLP> ModelData::CreateNetwork()
+{
+	auto result = ml::ANN_MLP::create();
+
+	result->setLayerSizes(Mat(_layerSizes, true));
+	result->setActivationFunction(ml::ANN_MLP::ActivationFunctions::SIGMOID_SYM, _alpha, _beta);
+	result->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER + TermCriteria::EPS, 500, 1e-3));
+	result->setTrainMethod(ml::ANN_MLP::BACKPROP, _learnRate, _momentum);
+
+	// getWeights() hands back a header onto the network's own storage, so the weights are copied straight in
+	for (auto i = 0; i < (int) _weights.size(); i++)
+	{
+		Mat target = result->getWeights(i);
+		_weights[i].copyTo(target);
+	}
+
+	return result;
+}
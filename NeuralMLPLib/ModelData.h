@@ -0,0 +1,47 @@
+//--------------------------------------------------
+// The weights and settings of a trained network, held in the layout that ANN_MLP uses
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/ml/ml.hpp>
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_AI
+{
+	class ModelData
+	{
+	private:
+		vector<int> _layerSizes;
+		double _learnRate;
+		double _momentum;
+		double _alpha;
+		double _beta;
+		vector<Mat> _weights;
+	public:
+		ModelData(const vector<int>& layerSizes, double learnRate, double momentum = 0, double alpha = 2.0 / 3.0, double beta = 1.7159);
+		ModelData(Ptr<ml::ANN_MLP>& network);
+
+		Ptr<ml::ANN_MLP> CreateNetwork();
+
+		inline vector<int>& GetLayerSizes() { return _layerSizes; }
+		inline int GetLayerCount() { return (int) _layerSizes.size(); }
+		inline double GetLearnRate() { return _learnRate; }
+		inline double GetMomentum() { return _momentum; }
+		inline double GetAlpha() { return _alpha; }
+		inline double GetBeta() { return _beta; }
+
+		inline Mat& GetInputScale() { return _weights[0]; }
+		inline Mat& GetWeights(int layer) { return _weights[layer]; }
+		inline Mat& GetOutputScale() { return _weights[_layerSizes.size()]; }
+		inline Mat& GetInverseOutputScale() { return _weights[_layerSizes.size() + 1]; }
+	};
+}
@@ -0,0 +1,228 @@
+//--------------------------------------------------
+// Implementation of class ModelFile
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ModelFile.h"
+using namespace NVL_AI;
+
+// The identifiers of the model file format
+#define MODEL_MAGIC "NMLPMODL"
+#define MODEL_VERSION 1
+
+// The extension that selects the binary format when saving
+#define MODEL_EXTENSION ".nmlp"
+
+// The alignment of the weight blocks within the file
+#define MODEL_ALIGNMENT 64
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The file is mapped copy-on-write and every block is wrapped in a matrix header, so
+ * nothing is parsed or copied. Along with the exact (double) weights in the ANN_MLP layout, the file holds a float
+ * copy of each layer in the layout that the native backend runs from.
+ * @param path The path to the model file
+ */
+ModelFile::ModelFile(const string& path)
+{
+	_file = Ptr<MappedFile>(new MappedFile(path, true));
+	if (_file->GetSize() < sizeof(ModelFileHeader)) throw runtime_error("Not a model file: " + path);
+
+	_header = (ModelFileHeader *) _file->GetData();
+	if (memcmp(_header->Magic, MODEL_MAGIC, sizeof(_header->Magic)) != 0) throw runtime_error("Not a model file: " + path);
+	if (_header->Version != MODEL_VERSION) throw runtime_error(NVLib::Formatter() << "Unsupported model file version " << _header->Version << ": " << path);
+	if (_header->FileSize != _file->GetSize() || _header->LayerCount < 2) throw runtime_error("The model file is damaged: " + path);
+
+	auto blockCount = (uint64_t)(2 * _header->LayerCount + 1);
+	if (_header->LayersOffset + _header->LayerCount * sizeof(int32_t) > _file->GetSize() || _header->TableOffset + blockCount * sizeof(uint64_t) > _file->GetSize()) throw runtime_error("The model file is damaged: " + path);
+
+	auto layers = (int32_t *)(_file->GetData() + _header->LayersOffset);
+	for (auto i = 0; i < (int) _header->LayerCount; i++)
+	{
+		if (layers[i] <= 0) throw runtime_error("The model file is damaged: " + path);
+		_layerSizes.push_back(layers[i]);
+	}
+
+	auto sizes = GetBlockSizes(_layerSizes); auto table = (uint64_t *)(_file->GetData() + _header->TableOffset);
+
+	for (auto i = 0; i < (int) sizes.size(); i++) _weights.push_back(MapBlock(table[i], sizes[i].height, sizes[i].width, CV_64F));
+
+	_inferenceWeights.resize(_layerSizes.size());
+	for (auto i = 1; i < (int) _layerSizes.size(); i++) _inferenceWeights[i] = MapBlock(table[sizes.size() + i - 1], sizes[i].height, sizes[i].width, CV_32F);
+}
+
+/**
+ * @brief Wrap a block of the mapped file in a matrix header
+ * @param offset The offset of the block
+ * @param rows The number of rows in the block
+ * @param cols The number of columns in the block
+ * @param type The element type of the block
+ * @return Mat The resultant header
+ */
+Mat ModelFile::MapBlock(uint64_t offset, int rows, int cols, int type)
+{
+	auto size = (uint64_t) rows * cols * CV_ELEM_SIZE(type);
+	if (offset % MODEL_ALIGNMENT != 0 || offset + size > _file->GetSize()) throw runtime_error("The model file is damaged");
+
+	return Mat(rows, cols, type, _file->GetData() + offset);
+}
+
+//--------------------------------------------------
+// Model
+//--------------------------------------------------
+
+/**
+ * @brief Copy the exact weights out into model data (for converting back to XML, for example)
+ * @return Ptr<ModelData> The resultant model
+ */
+Ptr<ModelData> ModelFile::GetModel()
+{
+	auto result = Ptr<ModelData>(new ModelData(_layerSizes, GetLearnRate(), GetMomentum(), GetAlpha(), GetBeta()));
+	for (auto i = 0; i < (int) _weights.size(); i++) _weights[i].copyTo(result->GetWeights(i));
+	return result;
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write a model to a binary model file. The file is written to a temporary path and then renamed,
+ * so a reader never sees a half written model.
+ * @param path The path to the model file
+ * @param model The model that we are writing
+ */
+void ModelFile::Write(const string& path, ModelData& model)
+{
+	auto& layerSizes = model.GetLayerSizes(); auto sizes = GetBlockSizes(layerSizes);
+	auto floatCount = (int) layerSizes.size() - 1;
+
+	for (auto i = 0; i < (int) sizes.size(); i++)
+	{
+		auto& weights = model.GetWeights(i);
+		if (weights.rows != sizes[i].height || weights.cols != sizes[i].width || weights.type() != CV_64F) throw runtime_error(NVLib::Formatter() << "Weight block " << i << " does not match the layer sizes");
+	}
+
+	auto header = ModelFileHeader(); memset(&header, 0, sizeof(ModelFileHeader));
+	memcpy(header.Magic, MODEL_MAGIC, sizeof(header.Magic));
+	header.Version = MODEL_VERSION; header.LayerCount = (uint32_t) layerSizes.size();
+	header.LearnRate = model.GetLearnRate(); header.Momentum = model.GetMomentum();
+	header.Alpha = model.GetAlpha(); header.Beta = model.GetBeta();
+	header.LayersOffset = sizeof(ModelFileHeader);
+	header.TableOffset = Align(header.LayersOffset + layerSizes.size() * sizeof(int32_t));
+
+	auto table = vector<uint64_t>(sizes.size() + floatCount);
+	auto offset = Align(header.TableOffset + table.size() * sizeof(uint64_t));
+	for (auto i = 0; i < (int) table.size(); i++)
+	{
+		auto size = i < (int) sizes.size() ? sizes[i] : sizes[i - sizes.size() + 1];
+		auto elementSize = i < (int) sizes.size() ? sizeof(double) : sizeof(float);
+		table[i] = offset; offset = Align(offset + (uint64_t) size.area() * elementSize);
+	}
+	header.FileSize = offset;
+
+	auto tempPath = path + ".tmp";
+	auto writer = ofstream(tempPath, ios::binary);
+	if (!writer.is_open()) throw runtime_error("Unable to create file: " + tempPath);
+
+	writer.write((char *) &header, sizeof(ModelFileHeader));
+	for (auto size : layerSizes) { auto value = (int32_t) size; writer.write((char *) &value, sizeof(int32_t)); }
+
+	WritePadding(writer, header.TableOffset);
+	writer.write((char *) table.data(), table.size() * sizeof(uint64_t));
+
+	for (auto i = 0; i < (int) sizes.size(); i++)
+	{
+		WritePadding(writer, table[i]);
+		Mat weights = model.GetWeights(i).isContinuous() ? model.GetWeights(i) : model.GetWeights(i).clone();
+		writer.write((char *) weights.data, weights.total() * sizeof(double));
+	}
+
+	for (auto i = 1; i <= floatCount; i++)
+	{
+		WritePadding(writer, table[sizes.size() + i - 1]);
+		Mat weights; model.GetWeights(i).convertTo(weights, CV_32F);
+		writer.write((char *) weights.data, weights.total() * sizeof(float));
+	}
+
+	WritePadding(writer, header.FileSize);
+
+	writer.close();
+	if (writer.fail()) { remove(tempPath.c_str()); throw runtime_error("Unable to write file: " + tempPath); }
+	if (rename(tempPath.c_str(), path.c_str()) != 0) { remove(tempPath.c_str()); throw runtime_error("Unable to create file: " + path); }
+}
+
+//--------------------------------------------------
+// Format Checks
+//--------------------------------------------------
+
+/**
+ * @brief Check whether a file starts with the model file identifier
+ * @param path The path to the file
+ * @return bool True if the file is a binary model file
+ */
+bool ModelFile::IsModelFile(const string& path)
+{
+	auto reader = ifstream(path, ios::binary);
+	char magic[8]; reader.read(magic, sizeof(magic));
+	return reader.gcount() == sizeof(magic) && memcmp(magic, MODEL_MAGIC, sizeof(magic)) == 0;
+}
+
+/**
+ * @brief Check whether a path asks for the binary format (by its extension)
+ * @param path The path that we are checking
+ * @return bool True if models saved to this path should be binary
+ */
+bool ModelFile::IsBinaryPath(const string& path)
+{
+	auto extension = string(MODEL_EXTENSION);
+	return path.size() >= extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the sizes of the weight blocks, in the same order as ANN_MLP::getWeights()
+ * @param layerSizes The sizes of the layers
+ * @return vector<Size> The sizes (width is columns, height is rows)
+ */
+vector<Size> ModelFile::GetBlockSizes(const vector<int>& layerSizes)
+{
+	auto result = vector<Size>();
+
+	result.push_back(Size(2 * layerSizes.front(), 1));
+	for (auto i = 1; i < (int) layerSizes.size(); i++) result.push_back(Size(layerSizes[i], layerSizes[i - 1] + 1));
+	result.push_back(Size(2 * layerSizes.back(), 1));
+	result.push_back(Size(2 * layerSizes.back(), 1));
+
+	return result;
+}
+
+/**
+ * @brief Pad the file with zeros up to the given offset
+ * @param writer The writer that we are padding
+ * @param offset The offset that we are padding up to
+ */
+void ModelFile::WritePadding(ostream& writer, uint64_t offset)
+{
+	auto position = (uint64_t) writer.tellp();
+	while (position < offset) { writer.put(0); position++; }
+}
+
+/**
+ * @brief Round an offset up to the block alignment
+ * @param offset The offset that we are aligning
+ * @return uint64_t The aligned offset
+ */
+uint64_t ModelFile::Align(uint64_t offset)
+{
+	return (offset + MODEL_ALIGNMENT - 1) / MODEL_ALIGNMENT * MODEL_ALIGNMENT;
+}
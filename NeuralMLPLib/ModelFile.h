@@ -0,0 +1,75 @@
+//--------------------------------------------------
+// A compact binary model file that is mapped into memory and run from in place
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "ModelData.h"
+#include "MappedFile.h"
+
+namespace NVL_AI
+{
+	struct ModelFileHeader
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t LayerCount;
+		double LearnRate;
+		double Momentum;
+		double Alpha;
+		double Beta;
+		uint64_t LayersOffset;
+		uint64_t TableOffset;
+		uint64_t FileSize;
+	};
+
+	class ModelFile
+	{
+	private:
+		Ptr<MappedFile> _file;
+		ModelFileHeader * _header;
+		vector<int> _layerSizes;
+		vector<Mat> _weights;
+		vector<Mat> _inferenceWeights;
+	public:
+		ModelFile(const string& path);
+
+		Ptr<ModelData> GetModel();
+
+		inline vector<int>& GetLayerSizes() { return _layerSizes; }
+		inline double GetLearnRate() { return _header->LearnRate; }
+		inline double GetMomentum() { return _header->Momentum; }
+		inline double GetAlpha() { return _header->Alpha; }
+		inline double GetBeta() { return _header->Beta; }
+
+		inline Mat& GetInputScale() { return _weights[0]; }
+		inline Mat& GetWeights(int layer) { return _weights[layer]; }
+		inline Mat& GetOutputScale() { return _weights[_layerSizes.size()]; }
+		inline Mat& GetInverseOutputScale() { return _weights[_layerSizes.size() + 1]; }
+		inline Mat& GetInferenceWeights(int layer) { return _inferenceWeights[layer]; }
+
+		static void Write(const string& path, ModelData& model);
+		static bool IsModelFile(const string& path);
+		static bool IsBinaryPath(const string& path);
+	private:
+		Mat MapBlock(uint64_t offset, int rows, int cols, int type);
+		static vector<Size> GetBlockSizes(const vector<int>& layerSizes);
+		static void WritePadding(ostream& writer, uint64_t offset);
+		static uint64_t Align(uint64_t offset);
+	};
+}
@@ -0,0 +1,46 @@
+//--------------------------------------------------
+// Implementation of class MomentumOptimizer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "MomentumOptimizer.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Setup
+//--------------------------------------------------
+
+/**
+ * @brief Allocate the previous step for each layer
+ * @param layerSizes The sizes of the layers in the network
+ */
+void MomentumOptimizer::Setup(const vector<int>& layerSizes)
+{
+	CreateState(layerSizes, _deltas);
+}
+
+/**
+ * @brief Forget the previous steps
+ */
+void MomentumOptimizer::Reset()
+{
+	ClearState(_deltas);
+}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Update the weights of a layer, step = momentum * step + rate * gradient
+ * @param layer The index of the layer
+ * @param weights The weights of the layer
+ * @param gradient The descent direction for the weights
+ */
+void MomentumOptimizer::Update(int layer, Mat& weights, Mat& gradient)
+{
+	MathKernels::MomentumUpdate((float *) weights.data, (float *) _deltas[layer].data, (float *) gradient.data, (float) _learnRate, (float) _momentum, (int) weights.total());
+}
@@ -0,0 +1,33 @@
+//--------------------------------------------------
+// Gradient descent with momentum (plain BACKPROP when the momentum is zero)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "Optimizer.h"
+
+namespace NVL_AI
+{
+	class MomentumOptimizer : public Optimizer
+	{
+	private:
+		double _momentum;
+		vector<Mat> _deltas;
+	public:
+		MomentumOptimizer(double learnRate, double momentum) : Optimizer(learnRate), _momentum(momentum) {}
+
+		void Setup(const vector<int>& layerSizes) override;
+		void Reset() override;
+		void Update(int layer, Mat& weights, Mat& gradient) override;
+		string GetName() override { return _momentum == 0 ? "backprop" : "momentum"; }
+
+		inline double GetMomentum() { return _momentum; }
+	};
+}
@@ -0,0 +1,484 @@
+//--------------------------------------------------
+// Implementation of class NativeNetwork
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "NativeNetwork.h"
+#include "ParallelTrainer.h"
+#include "NeuralUtils.h"
+using namespace NVL_AI;
+
+// The number of rows that are pushed through the network together during prediction
+#define PREDICT_ROWS 256
+
+//--------------------------------------------------
+// Constructors
+//--------------------------------------------------
+
+/**
+ * @brief Create a new (untrained) network. The learning settings are bounded in the same way that ANN_MLP::setTrainMethod bounds them.
+ * @param layerSizes The number of neurons in each layer (including the input and output layers)
+ * @param learnRate The learning rate
+ * @param momentum The momentum applied to weight updates
+ * @param threadCount The number of threads used for prediction (0 uses every core)
+ */
+NativeNetwork::NativeNetwork(const vector<int>& layerSizes, double learnRate, double momentum, int threadCount) : _layerSizes(layerSizes)
+{
+	if (layerSizes.size() < 2) throw runtime_error("A network needs at least an input and an output layer");
+
+	_learnRate = min(max(learnRate <= 0 ? 0.1 : learnRate, 1e-3), 1.0);
+	_momentum = min(momentum < 0 ? 0.1 : momentum, 1.0);
+	_alpha = 2.0 / 3.0; _beta = 1.7159;
+
+	Setup(threadCount);
+}
+
+/**
+ * @brief Create a network from a saved set of weights
+ * @param model The model that we are loading
+ * @param threadCount The number of threads used for prediction (0 uses every core)
+ */
+NativeNetwork::NativeNetwork(ModelData& model, int threadCount) : _layerSizes(model.GetLayerSizes())
+{
+	_learnRate = model.GetLearnRate(); _momentum = model.GetMomentum();
+	_alpha = model.GetAlpha(); _beta = model.GetBeta();
+
+	Setup(threadCount);
+
+	model.GetInputScale().copyTo(_inputScale);
+	model.GetOutputScale().copyTo(_outputScale);
+	model.GetInverseOutputScale().copyTo(_inverseOutputScale);
+	for (auto i = 1; i < (int) _layerSizes.size(); i++) model.GetWeights(i).convertTo(_weights[i], CV_32F);
+}
+
+/**
+ * @brief Create a network that runs straight from the weights of a mapped model file. The mapping is copy-on-write,
+ * so training the network changes its own copy of the pages and never the file.
+ * @param file The model file that we are running from
+ * @param threadCount The number of threads used for prediction (0 uses every core)
+ */
+NativeNetwork::NativeNetwork(Ptr<ModelFile> file, int threadCount) : _layerSizes(file->GetLayerSizes()), _source(file)
+{
+	_learnRate = file->GetLearnRate(); _momentum = file->GetMomentum();
+	_alpha = file->GetAlpha(); _beta = file->GetBeta();
+
+	Setup(threadCount);
+
+	file->GetInputScale().copyTo(_inputScale);
+	file->GetOutputScale().copyTo(_outputScale);
+	file->GetInverseOutputScale().copyTo(_inverseOutputScale);
+	for (auto i = 1; i < (int) _layerSizes.size(); i++) _weights[i] = file->GetInferenceWeights(i);
+}
+
+/**
+ * @brief Allocate the weights and every buffer that training and prediction need, so that neither allocates later
+ * @param threadCount The number of threads used for prediction
+ */
+void NativeNetwork::Setup(int threadCount)
+{
+	_batchSize = 1; _maxEpochs = 500; _epsilon = 1e-3; _epochs = 0; _orderId = 0;
+	_threadCount = ParallelUtils::GetThreadCount(threadCount);
+	_random.seed(0x5eed);
+
+	auto layerCount = (int) _layerSizes.size();
+
+	_inputScale = Mat_<double>::zeros(1, 2 * _layerSizes[0]);
+	_outputScale = Mat_<double>::zeros(1, 2 * _layerSizes[layerCount - 1]);
+	_inverseOutputScale = Mat_<double>::zeros(1, 2 * _layerSizes[layerCount - 1]);
+
+	_weights.resize(layerCount);
+	for (auto i = 1; i < layerCount; i++) _weights[i] = Mat_<float>::zeros(_layerSizes[i - 1] + 1, _layerSizes[i]);
+	CreateGradients(_gradients);
+
+	SetOptimizer(Ptr<Optimizer>(new MomentumOptimizer(_learnRate, _momentum)));
+	CreateBuffers(_trainBuffers, _batchSize);
+	_predictBuffers.resize(_threadCount);
+	for (auto& buffers : _predictBuffers) CreateBuffers(buffers, PREDICT_ROWS);
+}
+
+/**
+ * @brief Allocate the activations and errors for a block of rows. Each activation row has an extra column that is
+ * fixed at one, so that the bias row of each weight block is picked up by the same matrix products as the weights.
+ * @param buffers The buffers that we are allocating
+ * @param rows The number of rows that the buffers hold
+ */
+void NativeNetwork::CreateBuffers(NativeBuffers& buffers, int rows)
+{
+	buffers.Activations.clear(); buffers.Errors.clear();
+
+	for (auto size : _layerSizes)
+	{
+		buffers.Activations.push_back(Mat_<float>::ones(rows, size + 1));
+		buffers.Errors.push_back(Mat_<float>::zeros(rows, size));
+	}
+}
+
+//--------------------------------------------------
+// Training Settings
+//--------------------------------------------------
+
+/**
+ * @brief Set the rule that turns gradients into weight updates (BACKPROP with the network's momentum by default).
+ * The learning rate of the optimizer is the one that is saved with the model.
+ * @param optimizer The optimizer that we are using
+ */
+void NativeNetwork::SetOptimizer(Ptr<Optimizer> optimizer)
+{
+	_optimizer = optimizer;
+	_optimizer->Setup(_layerSizes);
+	_learnRate = optimizer->GetLearnRate();
+}
+
+/**
+ * @brief Set the number of samples that each weight update is found from. A size of 1 gives per-sample
+ * updates (as ANN_MLP does), while larger sizes average the gradient over a mini-batch.
+ * @param batchSize The number of samples in a batch
+ */
+void NativeNetwork::SetBatchSize(int batchSize)
+{
+	if (batchSize < 1) throw runtime_error("The batch size must be at least 1");
+
+	_batchSize = batchSize;
+	CreateBuffers(_trainBuffers, _batchSize);
+}
+
+/**
+ * @brief Set the trainer that spreads each epoch across threads (nullptr trains on the calling thread)
+ * @param trainer The trainer that we are using
+ */
+void NativeNetwork::SetTrainer(Ptr<ParallelTrainer> trainer)
+{
+	_trainer = trainer;
+}
+
+/**
+ * @brief Set the maximum number of epochs that a call to Train() runs for
+ * @param maxEpochs The maximum number of epochs
+ */
+void NativeNetwork::SetMaxEpochs(int maxEpochs)
+{
+	if (maxEpochs < 1) throw runtime_error("The number of epochs must be at least 1");
+	_maxEpochs = maxEpochs;
+}
+
+/**
+ * @brief Set how the inputs and outputs are scaled when training starts again
+ * @param inputMode How the inputs are scaled ("standard", "minmax" or "none")
+ * @param outputMode How the outputs are scaled ("minmax", "standard" or "none")
+ */
+void NativeNetwork::SetScaling(const string& inputMode, const string& outputMode)
+{
+	_normalizer = Normalizer(inputMode, outputMode);
+}
+
+//--------------------------------------------------
+// Training
+//--------------------------------------------------
+
+/**
+ * @brief Train the network, following ANN_MLP's BACKPROP method: the sample order is shuffled each epoch (the batches
+ * are gathered through it, so the data itself is never copied or reordered) and training stops after the maximum number
+ * of epochs (500 by default) or once the error changes by less than 1e-3 per sample.
+ * @param data The data that we are training with
+ * @param updateWeights Carry on from the current weights (and scaling) rather than starting again
+ */
+void NativeNetwork::Train(TrainData * data, bool updateWeights)
+{
+	auto& inputs = data->GetInputs(); auto& outputs = data->GetOutputs();
+
+	if (inputs.type() != CV_32F || outputs.type() != CV_32F) throw runtime_error("The native network only supports float data");
+	if (inputs.cols != _layerSizes.front() || outputs.cols != _layerSizes.back()) throw runtime_error("The data does not match the layer sizes of the network");
+
+	if (!updateWeights)
+	{
+		InitWeights();
+		_normalizer.Fit(data, _threadCount);
+		_normalizer.GetInputScale().copyTo(_inputScale);
+		_normalizer.GetOutputScale().copyTo(_outputScale);
+		_normalizer.GetInverseOutputScale().copyTo(_inverseOutputScale);
+		_optimizer->Reset();
+	}
+
+	// The shuffled order is the list of rows that we train on, so a view just starts it from its own rows
+	auto count = data->GetRowCount();
+	if (data->GetId() != _orderId || (int) _order.size() != count)
+	{
+		if (data->IsView()) _order = data->GetRows();
+		else { _order.resize(count); for (auto i = 0; i < count; i++) _order[i] = i; }
+		_orderId = data->GetId();
+	}
+
+	auto previous = DBL_MAX * 0.5; auto epsilon = _epsilon * count;
+
+	for (_epochs = 0; _epochs < _maxEpochs;)
+	{
+		Shuffle();
+
+		auto error = 0.0;
+		if (_trainer != nullptr) error = _trainer->RunEpoch(*this, inputs, outputs, _order, _batchSize);
+		else for (auto start = 0; start < count; start += _batchSize) error += TrainBatch(inputs, outputs, start, min(_batchSize, count - start));
+		_epochs++;
+
+		if (fabs(previous - error) < epsilon) break;
+		previous = error;
+	}
+}
+
+/**
+ * @brief Initialize the weights with the Nguyen-Widrow method, as ANN_MLP does
+ */
+void NativeNetwork::InitWeights()
+{
+	uniform_real_distribution<double> random(-1.0, 1.0);
+	auto layerCount = (int) _layerSizes.size();
+
+	for (auto i = 1; i < layerCount; i++)
+	{
+		auto n1 = _layerSizes[i - 1]; auto n2 = _layerSizes[i];
+		auto G = n2 > 2 ? 0.7 * pow((double) n1, 1.0 / (n2 - 1)) : 1.0;
+		auto w = (float *) _weights[i].data;
+
+		for (auto j = 0; j < n2; j++)
+		{
+			auto sum = 0.0; auto value = 0.0;
+
+			for (auto k = 0; k <= n1; k++)
+			{
+				value = random(_random);
+				w[k * n2 + j] = (float) value;
+				sum += fabs(value);
+			}
+
+			if (i < layerCount - 1)
+			{
+				auto scale = 1.0 / (sum - fabs(value));
+				for (auto k = 0; k <= n1; k++) w[k * n2 + j] *= (float) scale;
+				w[n1 * n2 + j] *= (float) (G * (-1 + j * 2.0 / n2));
+			}
+		}
+	}
+}
+
+/**
+ * @brief Shuffle the order that the samples are presented in
+ */
+void NativeNetwork::Shuffle()
+{
+	auto count = (int) _order.size();
+	uniform_int_distribution<int> random(0, count - 1);
+
+	for (auto i = 0; i < count; i++) swap(_order[random(_random)], _order[random(_random)]);
+}
+
+/**
+ * @brief Run a forward and backward pass over a block of samples and update the weights
+ * @param inputs The training inputs
+ * @param outputs The training outputs
+ * @param start The position in the sample order that the block starts at
+ * @param rows The number of samples in the block
+ * @return double The squared error of the block (before the update)
+ */
+double NativeNetwork::TrainBatch(Mat& inputs, Mat& outputs, int start, int rows)
+{
+	auto result = GetGradients(inputs, outputs, _order.data(), start, rows, 1.0 / rows, _trainBuffers, _gradients);
+	ApplyGradients(_gradients);
+	return result;
+}
+
+/**
+ * @brief Run a forward and backward pass over a block of samples, finding the gradient of every layer without
+ * changing the weights. Each call only touches the buffers and gradients that it is given, so several threads can
+ * find the gradients of different blocks at once.
+ * @param inputs The training inputs
+ * @param outputs The training outputs
+ * @param order The sample order
+ * @param start The position in the sample order that the block starts at
+ * @param rows The number of samples in the block
+ * @param share The weight of each sample in the gradient (one over the size of the whole batch)
+ * @param buffers The buffers that the block is worked through
+ * @param gradients The resultant gradients (one per layer, as made by CreateGradients)
+ * @return double The squared error of the block
+ */
+double NativeNetwork::GetGradients(Mat& inputs, Mat& outputs, const int * order, int start, int rows, double share, NativeBuffers& buffers, vector<Mat>& gradients)
+{
+	auto& activations = buffers.Activations; auto& errors = buffers.Errors;
+	auto layerCount = (int) _layerSizes.size(); auto n = _layerSizes.back();
+	auto alpha = (float) _alpha; auto beta = (float) _beta;
+
+	LoadInputs(inputs, order, start, rows, activations[0]);
+	Forward(buffers, rows);
+
+	// Find the error against the targets, in the range of the network (scaled so that the gradient is a batch mean)
+	auto inverse = _inverseOutputScale.ptr<double>(); auto result = 0.0;
+	for (auto r = 0; r < rows; r++)
+	{
+		auto target = outputs.ptr<float>(order[start + r]); auto y = activations[layerCount - 1].ptr<float>(r); auto error = errors[layerCount - 1].ptr<float>(r);
+
+		for (auto k = 0; k < n; k++)
+		{
+			auto t = target[k] * inverse[2 * k] + inverse[2 * k + 1] - y[k];
+			error[k] = (float) (t * share); result += t * t;
+		}
+	}
+
+	// Push the error back through the layers, passing it down through each layer's weights (which are not changed here)
+	for (auto i = layerCount - 1; i > 0; i--)
+	{
+		auto n1 = _layerSizes[i - 1]; auto n2 = _layerSizes[i];
+
+		MathKernels::SigmoidSymGradient(activations[i].ptr<float>(), n2 + 1, errors[i].ptr<float>(), n2, rows, n2, alpha, beta);
+		MathKernels::MultiplyTransA(activations[i - 1].ptr<float>(), n1 + 1, errors[i].ptr<float>(), n2, gradients[i].ptr<float>(), n2, n1 + 1, n2, rows, false);
+
+		if (i > 1) MathKernels::MultiplyTransB(errors[i].ptr<float>(), n2, _weights[i].ptr<float>(), n2, errors[i - 1].ptr<float>(), n1, rows, n1, n2);
+	}
+
+	return result;
+}
+
+/**
+ * @brief Turn a set of gradients into a weight update with the optimizer
+ * @param gradients The gradients of each layer
+ */
+void NativeNetwork::ApplyGradients(vector<Mat>& gradients)
+{
+	_optimizer->BeginStep();
+	for (auto i = (int) _layerSizes.size() - 1; i > 0; i--) _optimizer->Update(i, _weights[i], gradients[i]);
+}
+
+/**
+ * @brief Allocate a set of gradients, one for each layer's weights (including the bias row)
+ * @param gradients The gradients that we are allocating
+ */
+void NativeNetwork::CreateGradients(vector<Mat>& gradients)
+{
+	gradients.resize(_layerSizes.size());
+	for (auto i = 1; i < (int) _layerSizes.size(); i++) gradients[i] = Mat_<float>::zeros(_layerSizes[i - 1] + 1, _layerSizes[i]);
+}
+
+//--------------------------------------------------
+// Prediction
+//--------------------------------------------------
+
+/**
+ * @brief Run the network over a set of inputs. The rows are split across the prediction threads and each thread
+ * works through its share in blocks, using its own buffers.
+ * @param inputs The inputs (one row per sample)
+ * @param outputs The resultant outputs (only reallocated when the size changes)
+ */
+void NativeNetwork::Predict(const Mat& inputs, Mat& outputs)
+{
+	if (inputs.type() != CV_32F || inputs.cols != _layerSizes.front()) throw runtime_error("The inputs do not match the input layer of the network");
+
+	outputs.create(inputs.rows, _layerSizes.back(), CV_32F);
+	if (inputs.rows == 0) return;
+
+	auto threads = min(_threadCount, (inputs.rows + PREDICT_ROWS - 1) / PREDICT_ROWS);
+	auto share = (inputs.rows + threads - 1) / threads;
+
+	ParallelUtils::Run(threads, [&](int index)
+	{
+		auto start = index * share;
+		PredictRows(inputs, outputs, start, min(inputs.rows, start + share), _predictBuffers[index]);
+	});
+}
+
+/**
+ * @brief Predict a range of rows
+ * @param inputs The inputs
+ * @param outputs The outputs that are written to
+ * @param start The first row
+ * @param end The row after the last row
+ * @param buffers The buffers that this range is worked through
+ */
+void NativeNetwork::PredictRows(const Mat& inputs, Mat& outputs, int start, int end, NativeBuffers& buffers)
+{
+	auto& last = buffers.Activations.back(); auto n = _layerSizes.back(); auto scale = _outputScale.ptr<double>();
+
+	for (auto block = start; block < end; block += PREDICT_ROWS)
+	{
+		auto rows = min(PREDICT_ROWS, end - block);
+
+		LoadInputs(inputs, nullptr, block, rows, buffers.Activations[0]);
+		Forward(buffers, rows);
+
+		for (auto r = 0; r < rows; r++)
+		{
+			auto y = last.ptr<float>(r); auto output = outputs.ptr<float>(block + r);
+			for (auto k = 0; k < n; k++) output[k] = (float) (y[k] * scale[2 * k] + scale[2 * k + 1]);
+		}
+	}
+}
+
+//--------------------------------------------------
+// Forward Pass
+//--------------------------------------------------
+
+/**
+ * @brief Scale a block of inputs into the first activation buffer
+ * @param inputs The raw inputs
+ * @param order The sample order (or nullptr to take the rows in sequence)
+ * @param start The first position that we are loading
+ * @param rows The number of rows that we are loading
+ * @param activations The buffer that the scaled inputs are written to
+ */
+void NativeNetwork::LoadInputs(const Mat& inputs, const int * order, int start, int rows, Mat& activations)
+{
+	auto scale = _inputScale.ptr<double>(); auto n = _layerSizes[0];
+
+	for (auto r = 0; r < rows; r++)
+	{
+		auto source = inputs.ptr<float>(order != nullptr ? order[start + r] : start + r); auto target = activations.ptr<float>(r);
+		for (auto j = 0; j < n; j++) target[j] = (float) (source[j] * scale[2 * j] + scale[2 * j + 1]);
+	}
+}
+
+/**
+ * @brief Push a block of scaled inputs through the layers
+ * @param buffers The buffers holding the block
+ * @param rows The number of rows in the block
+ */
+void NativeNetwork::Forward(NativeBuffers& buffers, int rows)
+{
+	auto& activations = buffers.Activations;
+
+	for (auto i = 1; i < (int) _layerSizes.size(); i++)
+	{
+		auto n1 = _layerSizes[i - 1]; auto n2 = _layerSizes[i];
+
+		MathKernels::Multiply(activations[i - 1].ptr<float>(), n1 + 1, _weights[i].ptr<float>(), n2, activations[i].ptr<float>(), n2 + 1, rows, n2, n1, false);
+		MathKernels::SigmoidSym(activations[i].ptr<float>(), n2 + 1, _weights[i].ptr<float>(n1), rows, n2, (float) _alpha, (float) _beta);
+	}
+}
+
+//--------------------------------------------------
+// Model
+//--------------------------------------------------
+
+/**
+ * @brief Take a snapshot of the current weights in the ANN_MLP layout
+ * @return Ptr<ModelData> The snapshot
+ */
+Ptr<ModelData> NativeNetwork::GetModel()
+{
+	auto result = Ptr<ModelData>(new ModelData(_layerSizes, _learnRate, _momentum, _alpha, _beta));
+
+	_inputScale.copyTo(result->GetInputScale());
+	_outputScale.copyTo(result->GetOutputScale());
+	_inverseOutputScale.copyTo(result->GetInverseOutputScale());
+	for (auto i = 1; i < (int) _layerSizes.size(); i++) _weights[i].convertTo(result->GetWeights(i), CV_64F);
+
+	return result;
+}
+
+/**
+ * @brief Save the network to disk, in the binary model format when the path asks for it and in the ANN_MLP format
+ * otherwise (either of which can be loaded by both backends)
+ * @param path The path that we are saving to
+ */
+void NativeNetwork::Save(const string& path)
+{
+	NeuralUtils::SaveModel(path, *GetModel(), ModelFile::IsBinaryPath(path));
+}
@@ -0,0 +1,103 @@
+//--------------------------------------------------
+// A built-in multi-layer perceptron that runs on the vectorized math kernels
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cfloat>
+#include <random>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Network.h"
+#include "ModelFile.h"
+#include "Optimizer.h"
+#include "MathKernels.h"
+#include "Normalizer.h"
+#include "ParallelUtils.h"
+#include "MomentumOptimizer.h"
+
+namespace NVL_AI
+{
+	class ParallelTrainer;
+
+	struct NativeBuffers
+	{
+		vector<Mat> Activations;
+		vector<Mat> Errors;
+	};
+
+	class NativeNetwork : public Network
+	{
+	private:
+		vector<int> _layerSizes;
+		double _learnRate;
+		double _momentum;
+		double _alpha;
+		double _beta;
+		int _batchSize;
+		int _maxEpochs;
+		double _epsilon;
+		int _threadCount;
+		int _epochs;
+
+		Mat _inputScale;
+		Mat _outputScale;
+		Mat _inverseOutputScale;
+		Normalizer _normalizer;
+		vector<Mat> _weights;
+		vector<Mat> _gradients;
+		Ptr<Optimizer> _optimizer;
+		Ptr<ParallelTrainer> _trainer;
+
+		NativeBuffers _trainBuffers;
+		vector<NativeBuffers> _predictBuffers;
+		vector<int> _order;
+		uint64_t _orderId;
+		mt19937 _random;
+		Ptr<ModelFile> _source;
+	public:
+		NativeNetwork(const vector<int>& layerSizes, double learnRate, double momentum = 0, int threadCount = 1);
+		NativeNetwork(ModelData& model, int threadCount = 1);
+		NativeNetwork(Ptr<ModelFile> file, int threadCount = 1);
+
+		void Train(TrainData * data, bool updateWeights) override;
+		void Predict(const Mat& inputs, Mat& outputs) override;
+		Ptr<ModelData> GetModel() override;
+		void Save(const string& path) override;
+		string GetBackend() override { return "native"; }
+
+		void SetOptimizer(Ptr<Optimizer> optimizer);
+		void SetBatchSize(int batchSize);
+		void SetMaxEpochs(int maxEpochs) override;
+		void SetScaling(const string& inputMode, const string& outputMode);
+		void SetTrainer(Ptr<ParallelTrainer> trainer);
+
+		double GetGradients(Mat& inputs, Mat& outputs, const int * order, int start, int rows, double share, NativeBuffers& buffers, vector<Mat>& gradients);
+		void ApplyGradients(vector<Mat>& gradients);
+		void CreateGradients(vector<Mat>& gradients);
+		void CreateBuffers(NativeBuffers& buffers, int rows);
+
+		inline vector<int>& GetLayerSizes() { return _layerSizes; }
+		inline Ptr<Optimizer>& GetOptimizer() { return _optimizer; }
+		inline Ptr<ParallelTrainer>& GetTrainer() { return _trainer; }
+		inline vector<Mat>& GetWeights() { return _weights; }
+		inline int GetBatchSize() { return _batchSize; }
+		inline int GetEpochs() override { return _epochs; }
+	private:
+		void Setup(int threadCount);
+		void InitWeights();
+		void Shuffle();
+		double TrainBatch(Mat& inputs, Mat& outputs, int start, int rows);
+		void PredictRows(const Mat& inputs, Mat& outputs, int start, int end, NativeBuffers& buffers);
+		void LoadInputs(const Mat& inputs, const int * order, int start, int rows, Mat& activations);
+		void Forward(NativeBuffers& buffers, int rows);
+	};
+}
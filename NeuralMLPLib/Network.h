@@ -0,0 +1,42 @@
+//--------------------------------------------------
+// The common interface for the neural network backends
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "TrainData.h"
+#include "ModelData.h"
+
+namespace NVL_AI
+{
+	class Network
+	{
+	public:
+		virtual ~Network() {}
+
+		virtual void Train(TrainData * data, bool updateWeights) = 0;
+		virtual void Predict(const Mat& inputs, Mat& outputs) = 0;
+		virtual Ptr<ModelData> GetModel() = 0;
+		virtual void Save(const string& path) = 0;
+		virtual string GetBackend() = 0;
+
+		// Limit the passes over the data that each call to Train makes (a backend that cannot train ignores it)
+		virtual void SetMaxEpochs(int maxEpochs) {}
+
+		// The number of passes over the data made by the last call to Train (a backend that cannot tell reports its limit)
+		virtual int GetEpochs() { return 1; }
+
+		// The memory held for a copy of the training data, on top of the data itself (a backend that trains in place reports none)
+		virtual size_t GetCopyBytes() { return 0; }
+	};
+}
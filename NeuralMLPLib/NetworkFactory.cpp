@@ -0,0 +1,155 @@
+//--------------------------------------------------
+// Implementation of class NetworkFactory
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "NetworkFactory.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Create
+//--------------------------------------------------
+
+/**
+ * @brief Create a network with the default training settings
+ * @param backend The backend that we are using ("opencv" or "native")
+ * @param structure The sizes of the hidden layers, separated by commas
+ * @param learnRate The learning rate
+ * @param inputCount The number of inputs
+ * @param outputCount The number of outputs
+ * @param threadCount The number of threads the native backend predicts with (0 uses every core)
+ * @return Ptr<Network> The resultant network
+ */
+Ptr<Network> NetworkFactory::Create(const string& backend, const string& structure, double learnRate, int inputCount, int outputCount, int threadCount)
+{
+	auto settings = NetworkSettings();
+	settings.Backend = backend; settings.Structure = structure; settings.LearnRate = learnRate; settings.ThreadCount = threadCount;
+	return Create(settings, inputCount, outputCount);
+}
+
+/**
+ * @brief Create a network. The OpenCV backend only takes the epoch limit and scaling from the training settings
+ * (it always trains with per-sample BACKPROP, on one thread); the native backend takes all of them.
+ * @param settings The settings of the network
+ * @param inputCount The number of inputs
+ * @param outputCount The number of outputs
+ * @return Ptr<Network> The resultant network
+ */
+Ptr<Network> NetworkFactory::Create(const NetworkSettings& settings, int inputCount, int outputCount)
+{
+	if (settings.Backend == "opencv")
+	{
+		auto network = NeuralUtils::CreateNetwork(settings.Structure, settings.LearnRate, inputCount, outputCount);
+		network->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER + TermCriteria::EPS, settings.Epochs, 1e-3));
+		auto result = new OpenCVNetwork(network, settings.ThreadCount);
+		result->SetScaling(settings.InputScaling, settings.OutputScaling);
+		return Ptr<Network>(result);
+	}
+
+	if (settings.Backend == "native")
+	{
+		auto network = Ptr<NativeNetwork>(new NativeNetwork(NeuralUtils::GetLayerSizes(settings.Structure, inputCount, outputCount), settings.LearnRate, 0, settings.ThreadCount));
+		Configure(network.get(), settings, settings.LearnRate);
+		return network;
+	}
+
+	throw runtime_error(NVLib::Formatter() << "Unknown network backend: " << settings.Backend);
+}
+
+//--------------------------------------------------
+// Load
+//--------------------------------------------------
+
+/**
+ * @brief Load a saved network from either an XML or a binary model file. A binary file loaded into the native
+ * backend is run straight from the mapped weights, while the OpenCV backend reads its network in (so that it can predict).
+ * @param backend The backend that we are using ("opencv" or "native")
+ * @param path The path to the model
+ * @param threadCount The number of threads the network predicts with (0 uses every core). OpenCV's own thread count is
+ * process-wide, so that is left to the application (see cv::setNumThreads).
+ * @return Ptr<Network> The resultant network
+ */
+Ptr<Network> NetworkFactory::Load(const string& backend, const string& path, int threadCount)
+{
+	if (backend == "opencv") return Ptr<Network>(new OpenCVNetwork(NeuralUtils::LoadNetwork(path), threadCount));
+
+	if (backend == "native" && ModelFile::IsModelFile(path)) return Ptr<Network>(new NativeNetwork(Ptr<ModelFile>(new ModelFile(path)), threadCount));
+	if (backend == "native") return Ptr<Network>(new NativeNetwork(*NeuralUtils::LoadModel(path), threadCount));
+
+	throw runtime_error(NVLib::Formatter() << "Unknown network backend: " << backend);
+}
+
+/**
+ * @brief Load a saved network to carry on training it, with its weights and scaling as they were saved and the
+ * training settings of this run. The structure and learning rate come from the model; the settings' own are ignored.
+ * @param settings The training settings
+ * @param path The path to the model
+ * @return Ptr<Network> The resultant network (which should only be trained with updateWeights set, so that it keeps its scaling)
+ */
+Ptr<Network> NetworkFactory::Load(const NetworkSettings& settings, const string& path)
+{
+	if (settings.Backend == "opencv")
+	{
+		auto network = NeuralUtils::LoadNetwork(path);
+		network->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER + TermCriteria::EPS, settings.Epochs, 1e-3));
+		return Ptr<Network>(new OpenCVNetwork(network, settings.ThreadCount));
+	}
+
+	if (settings.Backend == "native")
+	{
+		auto model = NeuralUtils::LoadModel(path);
+		auto network = Ptr<NativeNetwork>(new NativeNetwork(*model, settings.ThreadCount));
+		Configure(network.get(), settings, model->GetLearnRate());
+		return network;
+	}
+
+	throw runtime_error(NVLib::Formatter() << "Unknown network backend: " << settings.Backend);
+}
+
+//--------------------------------------------------
+// Optimizers
+//--------------------------------------------------
+
+/**
+ * @brief Create an optimizer for the native backend. The learning rate of "backprop" and "momentum" is bounded in the
+ * same way that ANN_MLP::setTrainMethod bounds it, while "adam" and "rmsprop" take it as given (as they are usually
+ * run with rates well below that range).
+ * @param name The name of the optimizer ("backprop", "momentum", "adam" or "rmsprop")
+ * @param learnRate The learning rate
+ * @param momentum The momentum (only used by "momentum")
+ * @return Ptr<Optimizer> The resultant optimizer
+ */
+Ptr<Optimizer> NetworkFactory::CreateOptimizer(const string& name, double learnRate, double momentum)
+{
+	auto boundedRate = min(max(learnRate <= 0 ? 0.1 : learnRate, 1e-3), 1.0);
+
+	if (name == "backprop") return Ptr<Optimizer>(new MomentumOptimizer(boundedRate, 0));
+	if (name == "momentum") return Ptr<Optimizer>(new MomentumOptimizer(boundedRate, momentum));
+	if (name == "adam") return Ptr<Optimizer>(new AdamOptimizer(learnRate));
+	if (name == "rmsprop") return Ptr<Optimizer>(new RMSPropOptimizer(learnRate));
+
+	throw runtime_error(NVLib::Formatter() << "Unknown optimizer: " << name);
+}
+
+/**
+ * @brief Apply the training settings to a native network
+ * @param network The network that we are setting up
+ * @param settings The training settings
+ * @param learnRate The learning rate, as it was given (before any bounding)
+ */
+void NetworkFactory::Configure(NativeNetwork * network, const NetworkSettings& settings, double learnRate)
+{
+	network->SetOptimizer(CreateOptimizer(settings.Optimizer, learnRate, settings.Momentum));
+	network->SetBatchSize(settings.BatchSize);
+	network->SetMaxEpochs(settings.Epochs);
+	network->SetScaling(settings.InputScaling, settings.OutputScaling);
+	if (settings.TrainThreads == 1) return;
+
+	// A sync batch is split between the threads, so asking for more threads than rows in a batch would leave them idle
+	// (0 asks for every core, which is capped at the batch size instead, see ParallelTrainer::GetWorkerCount)
+	if (settings.TrainMode == "sync" && settings.TrainThreads > settings.BatchSize) throw runtime_error(NVLib::Formatter() << "Sync training splits each batch between the threads, so batch_size (" << settings.BatchSize << ") must be at least train_threads (" << settings.TrainThreads << ")");
+	network->SetTrainer(Ptr<ParallelTrainer>(new ParallelTrainer(settings.TrainThreads, settings.TrainMode)));
+}
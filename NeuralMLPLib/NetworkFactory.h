@@ -0,0 +1,53 @@
+//--------------------------------------------------
+// Creates networks for the backend named in the configuration
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Formatter.h>
+
+#include "NeuralUtils.h"
+#include "OpenCVNetwork.h"
+#include "NativeNetwork.h"
+#include "ParallelTrainer.h"
+#include "AdamOptimizer.h"
+#include "RMSPropOptimizer.h"
+#include "MomentumOptimizer.h"
+
+namespace NVL_AI
+{
+	struct NetworkSettings
+	{
+		string Backend = "opencv";
+		string Structure;
+		double LearnRate = 0.1;
+		string Optimizer = "backprop";
+		double Momentum = 0.9;
+		int BatchSize = 1;
+		int Epochs = 500;
+		string InputScaling = "standard";
+		string OutputScaling = "minmax";
+		int ThreadCount = 0;
+		int TrainThreads = 1;
+		string TrainMode = "sync";
+	};
+
+	class NetworkFactory
+	{
+	public:
+		static Ptr<Network> Create(const string& backend, const string& structure, double learnRate, int inputCount, int outputCount = 1, int threadCount = 0);
+		static Ptr<Network> Create(const NetworkSettings& settings, int inputCount, int outputCount = 1);
+		static Ptr<Network> Load(const string& backend, const string& path, int threadCount = 0);
+		static Ptr<Network> Load(const NetworkSettings& settings, const string& path);
+		static Ptr<Optimizer> CreateOptimizer(const string& name, double learnRate, double momentum);
+	private:
+		static void Configure(NativeNetwork * network, const NetworkSettings& settings, double learnRate);
+	};
+}
@@ -19,64 +19,14 @@ using namespace NVL_AI;
  * @param name The name of the relation that we are processing
  * @param description A description of the relation that we are processing
  * @param data The data that we are writing
+ * @param threadCount The number of threads used to format the records (0 uses every core)
  */
-void NeuralUtils::WriteData(const string& path, const string& name, const string& description, Mat& data) 
+void NeuralUtils::WriteData(const string& path, const string& name, const string& description, Mat& data, int threadCount) 
 {
-	// Create a writer
-	auto writer = ofstream(path);
-
-	// Render a header
-	RenderHeader(writer, name, description, data.cols - 1);
-
-	// Render body
-	RenderData(writer, data);
-
-	// Close the file
-	writer.close();
-}
-
-/**
- * @brief The header of the ARFF file 
- * @param writer The writer that we are dealing with
- * @param name The name of the relation that we are saving
- * @param description The description of the project
- * @param paramCount The number of inputs parameters
- */
-void NeuralUtils::RenderHeader(ostream& writer, const string &name, const string& description, int paramCount) 
-{
-    writer << "%----------------------------------------------" << endl;
-    writer << "% " << description << endl;
-    writer << "%" << endl;
-    writer << "% @author: NeuralMLP " << endl;
-    writer << "%----------------------------------------------" << endl;
-    writer << endl;
-    writer << "@RELATION " << name << endl;
-    writer << endl;
-
-    for (auto i = 0; i < paramCount; i++) writer << "@ATTRIBUTE p[" << i << "] REAL" << endl;
-    writer << "@ATTRIBUTE class REAL" << endl << endl;
-}
-
-/**
- * @brief Write the outputs to disk
- * @param writer The writer that we are using 
- * @param data The data that we are writing
- */
-void NeuralUtils::RenderData(ostream& writer, Mat& data) 
-{
-    writer << "@DATA" << endl;
-
-    auto outputs = (double *)data.data;
-    for (auto row = 0; row < data.rows; row++) 
-    {
-        for (auto column = 0; column < data.cols; column++) 
-        {
-            auto index = column + row * data.cols;
-            if (column != 0) writer << ",";
-            writer << setprecision(12) << outputs[index];        
-        }
-        writer << endl;
-    }
+	auto writer = ArffWriter(path, threadCount);
+	writer.WriteHeader(name, description, data.cols - 1);
+	writer.WriteRows(data);
+	writer.Close();
 }
 
 //--------------------------------------------------
@@ -84,92 +34,62 @@ void NeuralUtils::RenderData(ostream& writer, Mat& data)
 //--------------------------------------------------
 
 /**
- * @brief Write the give data to disk
- * @param path The path that we are writing to
+ * @brief Load the given ARFF file from disk
+ * @param path The path that we are loading from
  * @return TrainData* The given set of training data
  */
 TrainData * NeuralUtils::LoadData(const string& path) 
 {
-	auto fields = vector<string>(); Mat data = LoadARFF(path, fields);
-	auto sourceData = (double *)data.data;
-
-	Mat inputs = Mat_<float>::zeros(data.rows, fields.size()); auto inputData = (float *) inputs.data;
-	Mat outputs = Mat_<float>::zeros(data.rows, 1); auto outputData = (float *) outputs.data;
-
-	for (auto row = 0; row < data.rows; row++) 
-	{
-		for (auto column = 0; column < data.cols; column++)
-		{
-			auto index = column + row * data.cols;
-			auto value = (float) sourceData[index];
-
-			if (column < inputs.cols) inputData[column + row * inputs.cols] = value;
-			else outputData[row] = value;
-		}
-	}
-
-	return new TrainData(inputs, outputs);
+	return ArffReader(path).Read();
 }
 
 /**
- * @brief Load an ARFF file from disk
- * @param path A path to the file that we are loading
- * @param fieldNames The names of the fields that we are loading
- * @return Mat Returns a Mat
+ * @brief Split a dataset into training and validation views at random (the views share its rows rather than copying them)
+ * @param data The data that we are splitting
+ * @param fraction The fraction of the rows that are held out for validation
+ * @param seed The seed of the split
+ * @param trainData The view of the rows that are trained on
+ * @param validationData The view of the rows that are held out
  */
-Mat NeuralUtils::LoadARFF(const string& path, vector<string>& fieldNames)
+void NeuralUtils::SplitData(TrainData * data, double fraction, unsigned int seed, Ptr<TrainData>& trainData, Ptr<TrainData>& validationData)
 {
-	// Open the file
-	auto reader = ifstream(path);
-	if (!reader.is_open()) throw runtime_error("Unable to open file: " + path);
+	auto rowCount = data->GetRowCount();
+	auto validationCount = (int) round(rowCount * fraction);
+	if (validationCount < 1 || validationCount >= rowCount) throw runtime_error(NVLib::Formatter() << "A validation split of " << fraction << " leaves no rows on one side of " << rowCount << " rows");
 
-	// defines a line
-	auto line = string();
+	auto order = vector<int>(rowCount);
+	for (auto i = 0; i < rowCount; i++) order[i] = data->IsView() ? data->GetRows()[i] : i;
+	shuffle(order.begin(), order.end(), mt19937(seed));
 
-	// Read in the attributes
-	while(true) 
-	{
-		getline(reader, line);
-		if (!reader.good()) break;
-
-		if (NVLib::StringUtils::StartsWith(line, "@DATA")) break;
-
-		if (NVLib::StringUtils::StartsWith(line, "@ATTRIBUTE")) 
-		{
-			auto parts = vector<string>(); NVLib::StringUtils::Split(line, ' ', parts);
-			if (parts.size() == 3 && !(parts.size() > 2 && parts[1] == "class"))
-			{
-				fieldNames.push_back(parts[1]);
-			}
-		}
-	}
+	auto validationRows = vector<int>(order.begin(), order.begin() + validationCount); sort(validationRows.begin(), validationRows.end());
+	auto trainRows = vector<int>(order.begin() + validationCount, order.end()); sort(trainRows.begin(), trainRows.end());
 
-	// Read in the data
-	Mat result;
-	while (true) 
-	{
-		getline(reader, line);
-		if (line == string()) break;
+	trainData = Ptr<TrainData>(new TrainData(data, trainRows));
+	validationData = Ptr<TrainData>(new TrainData(data, validationRows));
+}
 
-		auto parts = vector<string>(); NVLib::StringUtils::Split(line, ',', parts);
-		if (parts.size() != fieldNames.size() + 1) throw runtime_error("The file has bad data records");
+//--------------------------------------------------
+// Create Network
+//--------------------------------------------------
 
-		auto record = vector<double>(); for (auto& part : parts) record.push_back(NVLib::StringUtils::String2Double(part));
-		Mat row = Mat(record).t();
-		result.push_back(row);
-	}
+/**
+ * @brief Break a network structure string (such as "60,60,60") into the full set of layer sizes
+ * @param structure The sizes of the hidden layers, separated by commas
+ * @param inputCount The number of inputs
+ * @param outputCount The number of outputs
+ * @return vector<int> The sizes of the input, hidden and output layers
+ */
+vector<int> NeuralUtils::GetLayerSizes(const string& structure, int inputCount, int outputCount) 
+{
+	auto parts = vector<string>(); NVLib::StringUtils::Split(structure, ',', parts);
 
-	// Close the file
-	reader.close();
+	auto result = vector<int> { inputCount };
+	for (auto& part : parts) result.push_back(NVLib::StringUtils::String2Int(part));
+	result.push_back(outputCount);
 
-	// Return the result
 	return result;
 }
 
-//--------------------------------------------------
-// Create Network
-//--------------------------------------------------
-
 /**
  * @brief Create the network that we are using
  * @param structure The structure of the given network
@@ -177,23 +97,10 @@ Mat NeuralUtils::LoadARFF(const string& path, vector<string>& fieldNames)
  */
 Ptr<ml::ANN_MLP> NeuralUtils::CreateNetwork(const string structure, double learnRate, int inputCount , int outputCount) 
 {
-	// Break the parameter set
-	auto parts = vector<string>(); NVLib::StringUtils::Split(structure, ',', parts);
-
-	Mat_<int> layers(parts.size() + 2, 1);
-
-	layers(0) = inputCount;
-
-	for (auto i = 0; i < parts.size(); i++) 
-	{
-		auto count = NVLib::StringUtils::String2Int(parts[i]);
-		layers(i + 1) = count;
-	}
-
-    layers(layers.rows - 1) = outputCount;
+	auto layers = GetLayerSizes(structure, inputCount, outputCount);
 
     auto result = ml::ANN_MLP::create();
-    result->setLayerSizes(layers);
+    result->setLayerSizes(Mat(layers, true));
     result->setActivationFunction(ml::ANN_MLP::ActivationFunctions::SIGMOID_SYM, 0, 0);
     result->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER + TermCriteria::EPS, 500, 1e-3));
     result->setTrainMethod(ml::ANN_MLP::BACKPROP, learnRate);
@@ -225,6 +132,17 @@ double NeuralUtils::GetScore(TrainData * data, Ptr<ml::ANN_MLP>& network)
 	return score;
 }
 
+/**
+ * @brief Calculate the score of a network from either backend (builds a one-off Scorer; loops should keep their own)
+ * @param data The data that we are getting the score for
+ * @param network The associated neural network
+ * @return double The sum of the absolute errors
+ */
+double NeuralUtils::GetScore(TrainData * data, Ptr<Network>& network) 
+{
+	return Scorer(data, 1).Evaluate(network).Total;
+}
+
 //--------------------------------------------------
 // Save the network to disk
 //--------------------------------------------------
@@ -239,4 +157,86 @@ void NeuralUtils::Save(const string& path, Ptr<ml::ANN_MLP>& network)
 	auto writer = FileStorage(path, FileStorage::WRITE | FileStorage::FORMAT_XML);
 	network->write(writer);
 	writer.release();
-}
\ No newline at end of file
+}
+
+//--------------------------------------------------
+// Model files
+//--------------------------------------------------
+
+/**
+ * @brief Save a model, either as OpenCV XML or in the binary model format
+ * @param path The path that we are saving to
+ * @param model The model that is being saved
+ * @param binary Use the binary model format rather than XML
+ */
+void NeuralUtils::SaveModel(const string& path, ModelData& model, bool binary)
+{
+	if (binary) { ModelFile::Write(path, model); return; }
+
+	auto network = model.CreateNetwork();
+	Save(path, network);
+}
+
+/**
+ * @brief Load a model from either an OpenCV XML file or a binary model file (found from the contents of the file)
+ * @param path The path to the model
+ * @return Ptr<ModelData> The model that was loaded
+ */
+Ptr<ModelData> NeuralUtils::LoadModel(const string& path)
+{
+	if (ModelFile::IsModelFile(path)) return ModelFile(path).GetModel();
+
+	auto network = LoadNetwork(path);
+	return Ptr<ModelData>(new ModelData(network));
+}
+
+/**
+ * @brief Load a model from either an OpenCV XML file or a binary model file as an OpenCV network that is ready to predict
+ * @param path The path to the model
+ * @return Ptr<ml::ANN_MLP> The network that was loaded
+ */
+Ptr<ml::ANN_MLP> NeuralUtils::LoadNetwork(const string& path)
+{
+	if (ModelFile::IsModelFile(path)) return ReadNetwork(*ModelFile(path).GetModel());
+
+	auto reader = FileStorage(path, FileStorage::READ);
+	if (!reader.isOpened()) throw runtime_error("Unable to open model: " + path);
+
+	auto network = ml::ANN_MLP::create();
+	network->read(reader.root());
+	if (network->getLayerSizes().empty()) throw runtime_error("Unable to read a network from: " + path);
+
+	return network;
+}
+
+/**
+ * @brief Build an OpenCV network from a model that is ready to predict. ANN_MLP only allows predict() on a network
+ * that has been trained or read, so the model is written to an in-memory file and read back.
+ * @param model The model that we are building the network from
+ * @return Ptr<ml::ANN_MLP> The resultant network
+ */
+Ptr<ml::ANN_MLP> NeuralUtils::ReadNetwork(ModelData& model)
+{
+	auto writer = FileStorage(".xml", FileStorage::WRITE | FileStorage::MEMORY | FileStorage::FORMAT_XML);
+	model.CreateNetwork()->write(writer);
+	auto content = writer.releaseAndGetString();
+
+	auto reader = FileStorage(content, FileStorage::READ | FileStorage::MEMORY);
+	auto network = ml::ANN_MLP::create();
+	network->read(reader.root());
+	if (network->getLayerSizes().empty()) throw runtime_error("Unable to read back the network of a model");
+
+	return network;
+}
+
+/**
+ * @brief Convert a model between the XML and binary formats, with the target format picked by its extension.
+ * The weights are stored as doubles in both formats, so the conversion is lossless in either direction.
+ * @param sourcePath The path to the model being converted
+ * @param targetPath The path that the converted model is written to
+ */
+void NeuralUtils::ConvertModel(const string& sourcePath, const string& targetPath)
+{
+	auto model = LoadModel(sourcePath);
+	SaveModel(targetPath, *model, ModelFile::IsBinaryPath(targetPath));
+}
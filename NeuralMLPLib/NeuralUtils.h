@@ -8,31 +8,43 @@
 
 #pragma once
 
+#include <random>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 using namespace std;
 
 #include <opencv2/ml/ml.hpp>
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include <NVLib/Formatter.h>
 #include <NVLib/StringUtils.h>
 
+#include "Scorer.h"
+#include "Network.h"
+#include "ModelFile.h"
 #include "TrainData.h"
+#include "ArffReader.h"
+#include "ArffWriter.h"
 
 namespace NVL_AI
 {
 	class NeuralUtils
 	{
 	public:
-		static void WriteData(const string& path, const string& name, const string& description, Mat& data);
+		static void WriteData(const string& path, const string& name, const string& description, Mat& data, int threadCount = 0);
 		static TrainData * LoadData(const string& path);
+		static void SplitData(TrainData * data, double fraction, unsigned int seed, Ptr<TrainData>& trainData, Ptr<TrainData>& validationData);
+		static vector<int> GetLayerSizes(const string& structure, int inputCount, int outputCount = 1);
 		static Ptr<ml::ANN_MLP> CreateNetwork(const string structure, double learnRate, int inputCount, int outputCount = 1);
 		static double GetScore(TrainData * data, Ptr<ml::ANN_MLP>& network);
+		static double GetScore(TrainData * data, Ptr<Network>& network);
 		static void Save(const string& path, Ptr<ml::ANN_MLP>& network);
-	private:
-		static Mat LoadARFF(const string& path, vector<string>& fieldNames);
-		static void RenderHeader(ostream& writer, const string& name, const string& description, int paramCount);
-		static void RenderData(ostream& writer, Mat& data); 
+		static void SaveModel(const string& path, ModelData& model, bool binary);
+		static Ptr<ModelData> LoadModel(const string& path);
+		static Ptr<ml::ANN_MLP> LoadNetwork(const string& path);
+		static Ptr<ml::ANN_MLP> ReadNetwork(ModelData& model);
+		static void ConvertModel(const string& sourcePath, const string& targetPath);
 	};
 }
@@ -0,0 +1,308 @@
+//--------------------------------------------------
+// Implementation of class Normalizer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Normalizer.h"
+using namespace NVL_AI;
+
+// The fewest rows that are worth handing to a thread of their own when the statistics are gathered
+#define MIN_ROWS_PER_THREAD 4096
+
+// The range that the outputs are mapped onto (inside the range of the symmetric sigmoid, as ANN_MLP does)
+#define OUTPUT_LOW -0.95
+#define OUTPUT_HIGH 0.95
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param inputMode How the inputs are scaled ("standard" for zero mean and unit variance, "minmax" for [-1, 1] or "none")
+ * @param outputMode How the outputs are scaled ("minmax" for [-0.95, 0.95], "standard" or "none")
+ */
+Normalizer::Normalizer(const string& inputMode, const string& outputMode) : _inputMode(inputMode), _outputMode(outputMode)
+{
+	CheckMode(inputMode); CheckMode(outputMode);
+}
+
+//--------------------------------------------------
+// Fit
+//--------------------------------------------------
+
+/**
+ * @brief Find the scaling of the given data. Statistics that were cached with the dataset are used as they are;
+ * otherwise they are gathered in one parallel pass over the rows of the data (or of the view).
+ * @param data The data that we are fitting to
+ * @param threadCount The number of threads used to gather the statistics (0 uses every core)
+ */
+void Normalizer::Fit(TrainData * data, int threadCount)
+{
+	auto inputStats = data->HasStats() ? data->GetInputStats() : GetStats(data->GetInputs(), data->GetRows(), threadCount);
+	auto outputStats = data->HasStats() ? data->GetOutputStats() : GetStats(data->GetOutputs(), data->GetRows(), threadCount);
+
+	_inputScale = GetScale(inputStats, _inputMode, -1, 1);
+	_inverseOutputScale = GetScale(outputStats, _outputMode, OUTPUT_LOW, OUTPUT_HIGH);
+	_outputScale = Invert(_inverseOutputScale);
+
+	_inputFactors = GetFactors(_inputScale);
+	_outputFactors = GetFactors(_outputScale);
+	_inverseOutputFactors = GetFactors(_inverseOutputScale);
+}
+
+//--------------------------------------------------
+// Transform
+//--------------------------------------------------
+
+/**
+ * @brief Scale a set of inputs into the range that the network works in
+ * @param inputs The raw inputs (float)
+ * @param rows The rows that are scaled (empty for every row), which are packed together in the result
+ * @param result The scaled inputs
+ */
+void Normalizer::TransformInputs(const Mat& inputs, const vector<int>& rows, Mat& result)
+{
+	if (!IsFitted()) throw runtime_error("The normalizer has not been fitted");
+	Apply(inputs, rows, _inputFactors, result);
+}
+
+/**
+ * @brief Scale a set of outputs (the training targets) into the range that the network works in
+ * @param outputs The raw outputs (float)
+ * @param rows The rows that are scaled (empty for every row), which are packed together in the result
+ * @param result The scaled outputs
+ */
+void Normalizer::TransformOutputs(const Mat& outputs, const vector<int>& rows, Mat& result)
+{
+	if (!IsFitted()) throw runtime_error("The normalizer has not been fitted");
+	Apply(outputs, rows, _inverseOutputFactors, result);
+}
+
+/**
+ * @brief Map the outputs of the network back into the units of the data (in place)
+ * @param outputs The outputs of the network (float)
+ */
+void Normalizer::RestoreOutputs(Mat& outputs)
+{
+	if (!IsFitted()) throw runtime_error("The normalizer has not been fitted");
+	Apply(outputs, vector<int>(), _outputFactors, outputs);
+}
+
+//--------------------------------------------------
+// Statistics
+//--------------------------------------------------
+
+/**
+ * @brief Gather the statistics of each column, splitting the rows across threads and merging their partial sums
+ * @param data The data that we are reading (float)
+ * @param rows The rows that are read (empty for every row)
+ * @param threadCount The number of threads (0 uses every core)
+ * @return Mat The statistics (4 x columns, double): the mean, deviation, minimum and maximum of each column
+ */
+Mat Normalizer::GetStats(const Mat& data, const vector<int>& rows, int threadCount)
+{
+	if (data.type() != CV_32F) throw runtime_error("Only float data can be normalized");
+
+	auto count = rows.empty() ? data.rows : (int) rows.size();
+	auto chunks = max(1, min(ParallelUtils::GetThreadCount(threadCount), count / MIN_ROWS_PER_THREAD));
+
+	auto partials = vector<Mat>(chunks);
+	ParallelUtils::Run(chunks, [&](int chunk)
+	{
+		auto start = (int) ((long) count * chunk / chunks); auto end = (int) ((long) count * (chunk + 1) / chunks);
+		auto chunkRows = rows.empty() ? vector<int>() : vector<int>(rows.begin() + start, rows.begin() + end);
+		auto block = rows.empty() ? data.rowRange(start, end) : data;
+
+		partials[chunk] = CreateSums(data.cols);
+		Accumulate(block, chunkRows, partials[chunk]);
+	});
+
+	auto total = CreateSums(data.cols);
+	for (auto& partial : partials) Merge(partial, total);
+	return GetStats(total);
+}
+
+/**
+ * @brief Create an empty set of running sums
+ * @param columnCount The number of columns
+ * @return Mat The sums (5 x columns, double): the sum, sum of squares, minimum, maximum and row count of each column
+ */
+Mat Normalizer::CreateSums(int columnCount)
+{
+	Mat result = Mat_<double>::zeros(5, columnCount);
+	for (auto j = 0; j < columnCount; j++) { result.at<double>(2, j) = DBL_MAX; result.at<double>(3, j) = -DBL_MAX; }
+	return result;
+}
+
+/**
+ * @brief Add rows to a set of running sums (so that data which is written in blocks can be summarized as it goes)
+ * @param data The data that we are reading (float)
+ * @param rows The rows that are read (empty for every row)
+ * @param sums The sums that are updated
+ */
+void Normalizer::Accumulate(const Mat& data, const vector<int>& rows, Mat& sums)
+{
+	auto count = rows.empty() ? data.rows : (int) rows.size(); auto n = data.cols;
+	auto sum = sums.ptr<double>(0); auto squares = sums.ptr<double>(1);
+	auto minimum = sums.ptr<double>(2); auto maximum = sums.ptr<double>(3); auto total = sums.ptr<double>(4);
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto row = data.ptr<float>(rows.empty() ? i : rows[i]);
+		for (auto j = 0; j < n; j++)
+		{
+			double t = row[j];
+			sum[j] += t; squares[j] += t * t;
+			minimum[j] = min(minimum[j], t); maximum[j] = max(maximum[j], t);
+		}
+	}
+
+	for (auto j = 0; j < n; j++) total[j] += count;
+}
+
+/**
+ * @brief Merge one set of running sums into another
+ * @param sums The sums that are being added
+ * @param total The sums that are updated
+ */
+void Normalizer::Merge(const Mat& sums, Mat& total)
+{
+	for (auto j = 0; j < sums.cols; j++)
+	{
+		total.at<double>(0, j) += sums.at<double>(0, j); total.at<double>(1, j) += sums.at<double>(1, j);
+		total.at<double>(2, j) = min(total.at<double>(2, j), sums.at<double>(2, j));
+		total.at<double>(3, j) = max(total.at<double>(3, j), sums.at<double>(3, j));
+		total.at<double>(4, j) += sums.at<double>(4, j);
+	}
+}
+
+/**
+ * @brief Turn a set of running sums into statistics (a column without rows is left as zeros)
+ * @param sums The sums (5 x columns)
+ * @return Mat The statistics (4 x columns): the mean, deviation, minimum and maximum of each column
+ */
+Mat Normalizer::GetStats(const Mat& sums)
+{
+	Mat result = Mat_<double>::zeros(4, sums.cols);
+
+	for (auto j = 0; j < sums.cols; j++)
+	{
+		auto count = sums.at<double>(4, j); if (count <= 0) continue;
+		auto mean = sums.at<double>(0, j) / count; auto variance = sums.at<double>(1, j) / count - mean * mean;
+
+		result.at<double>(0, j) = mean; result.at<double>(1, j) = sqrt(max(variance, 0.0));
+		result.at<double>(2, j) = sums.at<double>(2, j); result.at<double>(3, j) = sums.at<double>(3, j);
+	}
+
+	return result;
+}
+
+//--------------------------------------------------
+// Scale
+//--------------------------------------------------
+
+/**
+ * @brief Find the scaling that a mode gives for a set of statistics. Constant columns are centered rather than divided by zero.
+ * @param stats The statistics (4 x columns)
+ * @param mode The mode ("standard", "minmax" or "none")
+ * @param low The bottom of the range for "minmax"
+ * @param high The top of the range for "minmax"
+ * @return Mat The scale (1 x 2 * columns, double), as (a, b) pairs
+ */
+Mat Normalizer::GetScale(const Mat& stats, const string& mode, double low, double high)
+{
+	CheckMode(mode);
+
+	Mat result = Mat_<double>::zeros(1, 2 * stats.cols); auto scale = result.ptr<double>();
+
+	for (auto j = 0; j < stats.cols; j++)
+	{
+		auto a = 1.0, b = 0.0;
+
+		if (mode == "standard")
+		{
+			auto mean = stats.at<double>(0, j), deviation = stats.at<double>(1, j);
+			a = deviation * deviation < DBL_EPSILON ? 1 : 1.0 / deviation;
+			b = -mean * a;
+		}
+		else if (mode == "minmax")
+		{
+			auto minimum = stats.at<double>(2, j), maximum = stats.at<double>(3, j), delta = maximum - minimum;
+			a = delta < DBL_EPSILON ? 1.0 : (high - low) / delta;
+			b = delta < DBL_EPSILON ? (high + low - maximum - minimum) * 0.5 : low - minimum * a;
+		}
+
+		scale[2 * j] = a; scale[2 * j + 1] = b;
+	}
+
+	return result;
+}
+
+/**
+ * @brief Check that a normalization mode is one that we know
+ * @param mode The mode that we are checking
+ */
+void Normalizer::CheckMode(const string& mode)
+{
+	if (mode != "standard" && mode != "minmax" && mode != "none") throw runtime_error("Unknown normalization mode: " + mode);
+}
+
+/**
+ * @brief Find the scaling that undoes another one
+ * @param scale The scale that we are inverting, as (a, b) pairs
+ * @return Mat The inverse scale
+ */
+Mat Normalizer::Invert(const Mat& scale)
+{
+	Mat result = Mat_<double>::zeros(1, scale.cols);
+	auto input = scale.ptr<double>(); auto output = result.ptr<double>();
+
+	for (auto j = 0; j < scale.cols / 2; j++) { output[2 * j] = 1.0 / input[2 * j]; output[2 * j + 1] = -input[2 * j + 1] / input[2 * j]; }
+
+	return result;
+}
+
+/**
+ * @brief Split a scale into float factors and offsets, so that applying it is a plain multiply-add that the compiler
+ * can vectorize. This is done once when the scale is found, rather than on every call.
+ * @param scale The scale, as (a, b) pairs
+ * @return Mat The factors (2 x columns, float): the factor of each column, then its offset
+ */
+Mat Normalizer::GetFactors(const Mat& scale)
+{
+	auto n = scale.cols / 2;
+	Mat result = Mat_<float>(2, n); auto pairs = scale.ptr<double>();
+	auto factors = result.ptr<float>(0); auto offsets = result.ptr<float>(1);
+
+	for (auto j = 0; j < n; j++) { factors[j] = (float) pairs[2 * j]; offsets[j] = (float) pairs[2 * j + 1]; }
+
+	return result;
+}
+
+/**
+ * @brief Apply a scale to a set of rows
+ * @param data The data that we are scaling (float)
+ * @param rows The rows that are scaled (empty for every row), which are packed together in the result
+ * @param factors The scale, as factors and offsets (see GetFactors)
+ * @param result The scaled rows (which may be the data itself when every row is scaled)
+ */
+void Normalizer::Apply(const Mat& data, const vector<int>& rows, const Mat& factors, Mat& result)
+{
+	if (data.type() != CV_32F) throw runtime_error("Only float data can be normalized");
+	if (factors.cols != data.cols) throw runtime_error("The scale does not match the columns of the data");
+
+	auto count = rows.empty() ? data.rows : (int) rows.size(); auto n = data.cols;
+	if (result.data != data.data) result.create(count, n, CV_32F);
+
+	auto a = factors.ptr<float>(0); auto b = factors.ptr<float>(1);
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto input = data.ptr<float>(rows.empty() ? i : rows[i]); auto output = result.ptr<float>(i);
+		for (auto j = 0; j < n; j++) output[j] = input[j] * a[j] + b[j];
+	}
+}
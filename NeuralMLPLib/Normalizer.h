@@ -0,0 +1,66 @@
+//--------------------------------------------------
+// Finds the per-column scaling of a dataset in one parallel pass, and applies it to inputs and outputs
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "TrainData.h"
+#include "ParallelUtils.h"
+
+namespace NVL_AI
+{
+	class Normalizer
+	{
+	private:
+		string _inputMode;
+		string _outputMode;
+		Mat _inputScale;
+		Mat _outputScale;
+		Mat _inverseOutputScale;
+		Mat _inputFactors;
+		Mat _outputFactors;
+		Mat _inverseOutputFactors;
+	public:
+		Normalizer(const string& inputMode = "standard", const string& outputMode = "minmax");
+
+		void Fit(TrainData * data, int threadCount = 1);
+		void TransformInputs(const Mat& inputs, const vector<int>& rows, Mat& result);
+		void TransformOutputs(const Mat& outputs, const vector<int>& rows, Mat& result);
+		void RestoreOutputs(Mat& outputs);
+
+		inline string& GetInputMode() { return _inputMode; }
+		inline string& GetOutputMode() { return _outputMode; }
+		inline bool IsFitted() { return !_inputScale.empty(); }
+
+		// The scales use ANN_MLP's layout: one (a, b) pair per column, so that a value maps to a * value + b
+		inline Mat& GetInputScale() { return _inputScale; }
+		inline Mat& GetOutputScale() { return _outputScale; }
+		inline Mat& GetInverseOutputScale() { return _inverseOutputScale; }
+
+		static Mat GetStats(const Mat& data, const vector<int>& rows, int threadCount = 1);
+		static Mat CreateSums(int columnCount);
+		static void Accumulate(const Mat& data, const vector<int>& rows, Mat& sums);
+		static void Merge(const Mat& sums, Mat& total);
+		static Mat GetStats(const Mat& sums);
+		static Mat GetScale(const Mat& stats, const string& mode, double low, double high);
+		static Mat Invert(const Mat& scale);
+		static Mat GetFactors(const Mat& scale);
+		static void Apply(const Mat& data, const vector<int>& rows, const Mat& factors, Mat& result);
+	private:
+		static void CheckMode(const string& mode);
+	};
+}
@@ -0,0 +1,159 @@
+//--------------------------------------------------
+// Implementation of class OpenCVNetwork
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "OpenCVNetwork.h"
+#include "NeuralUtils.h"
+using namespace NVL_AI;
+
+// The buffers that the training rows are scaled into. They belong to the thread rather than the network, so networks
+// that train side by side on one dataset (sweep trials and folds) hold one scaled copy per worker thread, not one each.
+static thread_local Mat ScaledInputs;
+static thread_local Mat ScaledOutputs;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param network The OpenCV network that we are wrapping
+ * @param threadCount The number of threads used to gather the column statistics (0 uses every core)
+ */
+OpenCVNetwork::OpenCVNetwork(Ptr<ml::ANN_MLP> network, int threadCount) : _network(network), _sourceId(0), _copyBytes(0), _threadCount(threadCount) {}
+
+/**
+ * @brief Set the maximum number of epochs that a call to Train() runs for (the error threshold is kept as it was)
+ * @param maxEpochs The maximum number of epochs
+ */
+void OpenCVNetwork::SetMaxEpochs(int maxEpochs)
+{
+	if (maxEpochs < 1) throw runtime_error("The number of epochs must be at least 1");
+
+	auto criteria = _network->getTermCriteria();
+	_network->setTermCriteria(TermCriteria(criteria.type | TermCriteria::MAX_ITER, maxEpochs, criteria.epsilon));
+}
+
+/**
+ * @brief Set how the inputs and outputs are scaled when training starts again
+ * @param inputMode How the inputs are scaled ("standard", "minmax" or "none")
+ * @param outputMode How the outputs are scaled ("minmax", "standard" or "none")
+ */
+void OpenCVNetwork::SetScaling(const string& inputMode, const string& outputMode)
+{
+	_normalizer = Normalizer(inputMode, outputMode);
+}
+
+//--------------------------------------------------
+// Training
+//--------------------------------------------------
+
+/**
+ * @brief Train the network. The scaling is found once when training starts (from the statistics cached with the
+ * dataset when it has them), and the data is scaled into a training copy on each call, so ANN_MLP runs with
+ * NO_INPUT_SCALE | NO_OUTPUT_SCALE and never gathers statistics of its own.
+ * The rows are not scaled in place, since the scorer reads them to report errors in the data's own units and the
+ * views over them (validation splits, folds and sweep trials) fit scaling of their own. The copy goes into buffers
+ * that are kept by the calling thread and reused from call to call, so the network itself holds no copy of the rows
+ * (scaling them again is a single pass, which is small next to the epochs that ANN_MLP runs over them).
+ * A network that was loaded from disk (and so carries its scaling in its weights) is trained on the raw data.
+ * @param data The data that we are training with
+ * @param updateWeights Carry on from the current weights rather than starting again
+ */
+void OpenCVNetwork::Train(TrainData * data, bool updateWeights)
+{
+	if (!updateWeights) { _normalizer.Fit(data, _threadCount); _sourceId = 0; }
+
+	if (!_normalizer.IsFitted())
+	{
+		if (data->GetId() != _sourceId)
+		{
+			auto samples = data->IsView() ? Mat(data->GetRows(), true) : Mat();
+			_train = ml::TrainData::create(data->GetInputs(), ml::ROW_SAMPLE, data->GetOutputs(), noArray(), samples);
+			_sourceId = data->GetId();
+		}
+
+		_network->train(_train, ml::ANN_MLP::UPDATE_WEIGHTS);
+		return;
+	}
+
+	Mat inputs = GetScratch(ScaledInputs, data->GetRowCount(), data->GetInputs().cols);
+	Mat outputs = GetScratch(ScaledOutputs, data->GetRowCount(), data->GetOutputs().cols);
+	_normalizer.TransformInputs(data->GetInputs(), data->GetRows(), inputs);
+	_normalizer.TransformOutputs(data->GetOutputs(), data->GetRows(), outputs);
+	_copyBytes = inputs.total() * inputs.elemSize() + outputs.total() * outputs.elemSize();
+
+	auto flags = ml::ANN_MLP::NO_INPUT_SCALE | ml::ANN_MLP::NO_OUTPUT_SCALE;
+	_network->train(ml::TrainData::create(inputs, ml::ROW_SAMPLE, outputs), updateWeights ? flags | ml::ANN_MLP::UPDATE_WEIGHTS : flags);
+}
+
+/**
+ * @brief Take the leading rows of a scratch buffer, growing the buffer when it is too small (it never shrinks, so
+ * a thread that moves between views of different sizes does not allocate again)
+ * @param buffer The scratch buffer of the thread
+ * @param rows The number of rows that are needed
+ * @param cols The number of columns
+ * @return Mat A view of the rows that were asked for
+ */
+Mat OpenCVNetwork::GetScratch(Mat& buffer, int rows, int cols)
+{
+	if (buffer.cols != cols || buffer.rows < rows) buffer.create(rows, cols, CV_32F);
+	return buffer.rowRange(0, rows);
+}
+
+//--------------------------------------------------
+// Prediction
+//--------------------------------------------------
+
+/**
+ * @brief Run the network over a set of inputs, scaling them on the way in (into a buffer that is kept between calls) and the outputs on the way out
+ * @param inputs The inputs (one row per sample)
+ * @param outputs The resultant outputs
+ */
+void OpenCVNetwork::Predict(const Mat& inputs, Mat& outputs)
+{
+	if (!_normalizer.IsFitted()) { _network->predict(inputs, outputs); return; }
+
+	_normalizer.TransformInputs(inputs, vector<int>(), _scaled);
+	_network->predict(_scaled, outputs);
+	_normalizer.RestoreOutputs(outputs);
+}
+
+//--------------------------------------------------
+// Model
+//--------------------------------------------------
+
+/**
+ * @brief Take a snapshot of the current weights. The network itself trains with identity scales, so the scaling
+ * of the normalizer is folded into the snapshot, which then predicts on raw data like any other model.
+ * @return Ptr<ModelData> The snapshot
+ */
+Ptr<ModelData> OpenCVNetwork::GetModel()
+{
+	auto result = Ptr<ModelData>(new ModelData(_network));
+
+	if (_normalizer.IsFitted())
+	{
+		_normalizer.GetInputScale().copyTo(result->GetInputScale());
+		_normalizer.GetOutputScale().copyTo(result->GetOutputScale());
+		_normalizer.GetInverseOutputScale().copyTo(result->GetInverseOutputScale());
+	}
+
+	return result;
+}
+
+/**
+ * @brief Save the network to disk (with its scaling folded into the scale weights)
+ * @param path The path that we are saving to
+ */
+void OpenCVNetwork::Save(const string& path)
+{
+	if (!_normalizer.IsFitted()) { NeuralUtils::Save(path, _network); return; }
+
+	auto network = GetModel()->CreateNetwork();
+	NeuralUtils::Save(path, network);
+}
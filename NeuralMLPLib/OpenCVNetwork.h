@@ -0,0 +1,54 @@
+//--------------------------------------------------
+// The network backend that wraps OpenCV's ANN_MLP
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/ml/ml.hpp>
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Network.h"
+#include "Normalizer.h"
+
+namespace NVL_AI
+{
+	class OpenCVNetwork : public Network
+	{
+	private:
+		Ptr<ml::ANN_MLP> _network;
+		uint64_t _sourceId;
+		Ptr<ml::TrainData> _train;
+		Normalizer _normalizer;
+		size_t _copyBytes;
+		Mat _scaled;
+		int _threadCount;
+	public:
+		OpenCVNetwork(Ptr<ml::ANN_MLP> network, int threadCount = 1);
+
+		void Train(TrainData * data, bool updateWeights) override;
+		void Predict(const Mat& inputs, Mat& outputs) override;
+		Ptr<ModelData> GetModel() override;
+		void Save(const string& path) override;
+		string GetBackend() override { return "opencv"; }
+
+		// ANN_MLP does not report how many epochs it ran, so this is its epoch limit (which it runs to unless the error settles first)
+		inline int GetEpochs() override { return _network->getTermCriteria().maxCount; }
+		inline size_t GetCopyBytes() override { return _copyBytes; }
+
+		void SetMaxEpochs(int maxEpochs) override;
+		void SetScaling(const string& inputMode, const string& outputMode);
+
+		inline Ptr<ml::ANN_MLP>& GetNetwork() { return _network; }
+		inline Normalizer& GetNormalizer() { return _normalizer; }
+	private:
+		static Mat GetScratch(Mat& buffer, int rows, int cols);
+	};
+}
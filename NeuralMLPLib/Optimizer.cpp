@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// Implementation of class Optimizer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Optimizer.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// State Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Allocate a block of optimizer state for each layer, shaped like the weights of that layer
+ * @param layerSizes The sizes of the layers in the network
+ * @param state The state that we are allocating (entry 0 is left empty, as there are no input weights)
+ */
+void Optimizer::CreateState(const vector<int>& layerSizes, vector<Mat>& state)
+{
+	state.resize(layerSizes.size());
+	for (auto i = 1; i < (int) layerSizes.size(); i++) state[i] = Mat_<float>::zeros(layerSizes[i - 1] + 1, layerSizes[i]);
+}
+
+/**
+ * @brief Set a block of optimizer state back to zero
+ * @param state The state that we are clearing
+ */
+void Optimizer::ClearState(vector<Mat>& state)
+{
+	for (auto i = 1; i < (int) state.size(); i++) state[i].setTo(0);
+}
@@ -0,0 +1,40 @@
+//--------------------------------------------------
+// The common interface for the rules that turn gradients into weight updates
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "MathKernels.h"
+
+namespace NVL_AI
+{
+	class Optimizer
+	{
+	protected:
+		double _learnRate;
+	public:
+		Optimizer(double learnRate) : _learnRate(learnRate) {}
+		virtual ~Optimizer() {}
+
+		virtual void Setup(const vector<int>& layerSizes) = 0;
+		virtual void Reset() = 0;
+		virtual void BeginStep() {}
+		virtual void Update(int layer, Mat& weights, Mat& gradient) = 0;
+		virtual string GetName() = 0;
+
+		inline double GetLearnRate() { return _learnRate; }
+	protected:
+		static void CreateState(const vector<int>& layerSizes, vector<Mat>& state);
+		static void ClearState(vector<Mat>& state);
+	};
+}
@@ -0,0 +1,215 @@
+//--------------------------------------------------
+// Implementation of class ParallelTrainer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ParallelTrainer.h"
+using namespace NVL_AI;
+
+// The number of times a waiting thread checks the barrier before it starts yielding its core
+#define SPIN_LIMIT 4096
+
+//--------------------------------------------------
+// Barrier
+//--------------------------------------------------
+
+/**
+ * @brief Set the number of threads that meet at the barrier (only while no thread is waiting)
+ * @param count The number of threads
+ */
+void SpinBarrier::Reset(int count)
+{
+	_count = count; _waiting = 0;
+}
+
+/**
+ * @brief Wait until every thread has reached the barrier. The last thread to arrive moves the barrier on to its
+ * next generation, which is what the others are spinning on, so no locks are taken.
+ */
+void SpinBarrier::Wait()
+{
+	auto generation = _generation.load(memory_order_acquire);
+
+	if (_waiting.fetch_add(1, memory_order_acq_rel) + 1 == _count)
+	{
+		_waiting.store(0, memory_order_relaxed);
+		_generation.fetch_add(1, memory_order_release);
+		return;
+	}
+
+	for (auto spins = 0; _generation.load(memory_order_acquire) == generation; spins++)
+	{
+		if (spins > SPIN_LIMIT) this_thread::yield();
+	}
+}
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param threadCount The number of worker threads (0 uses every core)
+ * @param mode How the workers' gradients are combined: "sync" sums them with a tree reduction before each update,
+ * while "hogwild" lets every worker update the shared weights as it goes, without any synchronization
+ */
+ParallelTrainer::ParallelTrainer(int threadCount, const string& mode) : _mode(mode), _rows(0)
+{
+	if (mode != "sync" && mode != "hogwild") throw runtime_error("Unknown parallel training mode: " + mode);
+	_threadCount = ParallelUtils::GetThreadCount(threadCount);
+}
+
+//--------------------------------------------------
+// Epoch
+//--------------------------------------------------
+
+/**
+ * @brief Run one pass over the data, in the order given. In "sync" mode each batch is split evenly between the
+ * workers, so the update is the same as the serial one (a batch smaller than the number of threads leaves the spare
+ * workers out). In "hogwild" mode each worker works through its own share of the order in whole batches and
+ * applies plain gradient steps at the optimizer's learning rate straight to the shared weights.
+ * @param network The network that we are training
+ * @param inputs The training inputs
+ * @param outputs The training outputs
+ * @param order The order that the rows are presented in
+ * @param batchSize The number of rows in each batch
+ * @return double The squared error of the pass
+ */
+double ParallelTrainer::RunEpoch(NativeNetwork& network, Mat& inputs, Mat& outputs, const vector<int>& order, int batchSize)
+{
+	auto count = (int) order.size(); if (count == 0) return 0;
+
+	auto sync = _mode == "sync";
+	auto workers = min(GetWorkerCount(_threadCount, _mode, batchSize), count);
+	Setup(network, sync ? (batchSize + workers - 1) / workers : batchSize);
+
+	_barrier.Reset(workers);
+	for (auto& partial : _partials) partial.Error = 0;
+
+	ParallelUtils::Run(workers, [&](int index)
+	{
+		if (sync) RunSync(network, inputs, outputs, order, batchSize, workers, index);
+		else RunHogwild(network, inputs, outputs, order, batchSize, workers, index);
+	});
+
+	auto result = 0.0;
+	for (auto i = 0; i < workers; i++) result += _partials[i].Error;
+	return result;
+}
+
+/**
+ * @brief The number of workers that an epoch runs on. In "sync" mode a batch is split between the workers, so there
+ * are never more workers than rows in a batch; in "hogwild" mode every thread works through its own share of the rows.
+ * @param threadCount The number of threads that were asked for (0 uses every core)
+ * @param mode How the workers' gradients are combined ("sync" or "hogwild")
+ * @param batchSize The number of rows in each batch
+ * @return int The number of workers (before the epoch's row count caps it)
+ */
+int ParallelTrainer::GetWorkerCount(int threadCount, const string& mode, int batchSize)
+{
+	auto threads = ParallelUtils::GetThreadCount(threadCount);
+	return mode == "sync" ? max(1, min(threads, batchSize)) : threads;
+}
+
+/**
+ * @brief The loop run by each worker in "sync" mode: find the gradient of this worker's slice of the batch, sum the
+ * gradients down to the first worker and wait while it updates the weights
+ * @param network The network that we are training
+ * @param inputs The training inputs
+ * @param outputs The training outputs
+ * @param order The order that the rows are presented in
+ * @param batchSize The number of rows in each batch
+ * @param workers The number of workers
+ * @param index The index of this worker
+ */
+void ParallelTrainer::RunSync(NativeNetwork& network, Mat& inputs, Mat& outputs, const vector<int>& order, int batchSize, int workers, int index)
+{
+	auto count = (int) order.size(); auto& gradients = _gradients[index];
+
+	for (auto start = 0; start < count; start += batchSize)
+	{
+		auto rows = min(batchSize, count - start); auto slice = (rows + workers - 1) / workers;
+		auto first = min(rows, index * slice); auto size = min(rows, first + slice) - first;
+
+		if (size > 0) _partials[index].Error += network.GetGradients(inputs, outputs, order.data(), start + first, size, 1.0 / rows, _buffers[index], gradients);
+		else for (auto& gradient : gradients) if (!gradient.empty()) memset(gradient.data, 0, gradient.total() * sizeof(float));
+
+		Reduce(workers, index);
+		if (index == 0) network.ApplyGradients(gradients);
+		_barrier.Wait();
+	}
+}
+
+/**
+ * @brief The loop run by each worker in "hogwild" mode: work through this worker's share of the order in batches,
+ * adding each gradient straight onto the shared weights. The updates from different workers race with each other by
+ * design; with sparse overlap between the updates the lost writes are rare enough not to hurt convergence.
+ * @param network The network that we are training
+ * @param inputs The training inputs
+ * @param outputs The training outputs
+ * @param order The order that the rows are presented in
+ * @param batchSize The number of rows in each batch
+ * @param workers The number of workers
+ * @param index The index of this worker
+ */
+void ParallelTrainer::RunHogwild(NativeNetwork& network, Mat& inputs, Mat& outputs, const vector<int>& order, int batchSize, int workers, int index)
+{
+	auto count = (int) order.size(); auto& gradients = _gradients[index]; auto& weights = network.GetWeights();
+	auto first = (int) ((int64_t) index * count / workers); auto last = (int) ((int64_t) (index + 1) * count / workers);
+	auto rate = (float) network.GetOptimizer()->GetLearnRate();
+
+	for (auto start = first; start < last; start += batchSize)
+	{
+		auto rows = min(batchSize, last - start);
+		_partials[index].Error += network.GetGradients(inputs, outputs, order.data(), start, rows, 1.0 / rows, _buffers[index], gradients);
+
+		for (auto i = 1; i < (int) weights.size(); i++) MathKernels::Axpy(rate, (float *) gradients[i].data, (float *) weights[i].data, (int) weights[i].total());
+	}
+}
+
+/**
+ * @brief Sum the gradients of every worker into the first worker's gradients with a binary tree: at each level,
+ * every worker whose index is a multiple of twice the stride adds in the gradients of its partner one stride along,
+ * so the sum takes log2(workers) steps and the workers only meet at the barrier between them
+ * @param workers The number of workers
+ * @param index The index of this worker
+ */
+void ParallelTrainer::Reduce(int workers, int index)
+{
+	for (auto stride = 1; stride < workers; stride *= 2)
+	{
+		_barrier.Wait();
+		if (index % (2 * stride) != 0 || index + stride >= workers) continue;
+
+		auto& target = _gradients[index]; auto& source = _gradients[index + stride];
+		for (auto i = 1; i < (int) target.size(); i++) MathKernels::Axpy(1.0f, (float *) source[i].data, (float *) target[i].data, (int) target[i].total());
+	}
+
+	_barrier.Wait();
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Allocate the buffers and gradients of each worker (only when the layers or the slice size change)
+ * @param network The network that we are training
+ * @param rows The most rows that a worker handles at once
+ */
+void ParallelTrainer::Setup(NativeNetwork& network, int rows)
+{
+	if (_layerSizes == network.GetLayerSizes() && _rows >= rows) return;
+
+	_layerSizes = network.GetLayerSizes(); _rows = rows;
+	_buffers.resize(_threadCount); _gradients.resize(_threadCount); _partials.resize(_threadCount);
+
+	for (auto i = 0; i < _threadCount; i++)
+	{
+		network.CreateBuffers(_buffers[i], rows);
+		network.CreateGradients(_gradients[i]);
+	}
+}
@@ -0,0 +1,69 @@
+//--------------------------------------------------
+// Trains a single native network across threads by splitting the rows of each epoch between workers
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "MathKernels.h"
+#include "NativeNetwork.h"
+#include "ParallelUtils.h"
+
+namespace NVL_AI
+{
+	struct alignas(64) TrainerPartial
+	{
+		double Error;
+	};
+
+	class SpinBarrier
+	{
+	private:
+		int _count;
+		atomic<int> _waiting;
+		atomic<int> _generation;
+	public:
+		SpinBarrier() : _count(1), _waiting(0), _generation(0) {}
+
+		void Reset(int count);
+		void Wait();
+	};
+
+	class ParallelTrainer
+	{
+	private:
+		int _threadCount;
+		string _mode;
+		vector<int> _layerSizes;
+		int _rows;
+		vector<NativeBuffers> _buffers;
+		vector<vector<Mat>> _gradients;
+		vector<TrainerPartial> _partials;
+		SpinBarrier _barrier;
+	public:
+		ParallelTrainer(int threadCount, const string& mode = "sync");
+
+		double RunEpoch(NativeNetwork& network, Mat& inputs, Mat& outputs, const vector<int>& order, int batchSize);
+
+		inline int GetThreadCount() { return _threadCount; }
+		inline string& GetMode() { return _mode; }
+
+		static int GetWorkerCount(int threadCount, const string& mode, int batchSize);
+	private:
+		void Setup(NativeNetwork& network, int rows);
+		void RunSync(NativeNetwork& network, Mat& inputs, Mat& outputs, const vector<int>& order, int batchSize, int workers, int index);
+		void RunHogwild(NativeNetwork& network, Mat& inputs, Mat& outputs, const vector<int>& order, int batchSize, int workers, int index);
+		void Reduce(int workers, int index);
+	};
+}
@@ -0,0 +1,159 @@
+//--------------------------------------------------
+// Implementation of class ParallelUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ParallelUtils.h"
+using namespace NVL_AI;
+
+#define MAX_TEAM_THREADS 256
+
+// The team of threads that is shared by every call (created on first use, and never destroyed so that its idle
+// threads are simply parked until the process exits)
+static ParallelTeam * team = nullptr;
+static once_flag teamCreated;
+
+//--------------------------------------------------
+// Thread Count
+//--------------------------------------------------
+
+/**
+ * @brief Convert a requested thread count into an actual one
+ * @param requested The requested number of threads (0 or less means every core)
+ * @return int The number of threads to use
+ */
+int ParallelUtils::GetThreadCount(int requested)
+{
+	if (requested > 0) return requested;
+	return max(1, (int)thread::hardware_concurrency());
+}
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Run a task for each index on its own thread, re-throwing the first failure in index order. The calling
+ * thread runs index 0 and a team of threads that is kept between calls runs the rest, so once the team has grown to
+ * the size that a loop asks for, calling this again does not create threads or allocate. A call made while the team
+ * is in use (from inside a task, or from another thread) starts threads of its own instead.
+ * @param count The number of tasks
+ * @param task The function that runs a task
+ * @param context The state that is passed to the function
+ */
+void ParallelUtils::Run(int count, ParallelTask task, const void * context)
+{
+	if (count < 1) return;
+	if (count == 1) { task(context, 0); return; }
+
+	auto current = GetTeam(); auto idle = false;
+	if (count - 1 > MAX_TEAM_THREADS || !current->Busy.compare_exchange_strong(idle, true)) { Spawn(count, task, context); return; }
+
+	try
+	{
+		while ((int) current->Workers.size() < count - 1) current->Workers.push_back(thread(&ParallelUtils::Work, current, (int) current->Workers.size() + 1, current->Generation));
+		if ((int) current->Errors.size() < count) current->Errors.resize(count);
+	}
+	catch (...) { current->Busy = false; throw; }
+
+	{
+		lock_guard<mutex> guard(current->Lock);
+		current->Task = task; current->Context = context; current->Count = count; current->Remaining = count - 1; current->Generation++;
+	}
+	current->Started.notify_all();
+
+	try { task(context, 0); }
+	catch (...) { current->Errors[0] = current_exception(); }
+
+	{
+		unique_lock<mutex> lock(current->Lock);
+		current->Finished.wait(lock, [&]() { return current->Remaining == 0; });
+	}
+
+	auto error = exception_ptr();
+	for (auto i = 0; i < count; i++)
+	{
+		if (error == nullptr) error = current->Errors[i];
+		current->Errors[i] = nullptr;
+	}
+	current->Busy = false;
+
+	if (error != nullptr) rethrow_exception(error);
+}
+
+/**
+ * @brief Run the tasks on threads that are started for this call alone
+ * @param count The number of tasks
+ * @param task The function that runs a task
+ * @param context The state that is passed to the function
+ */
+void ParallelUtils::Spawn(int count, ParallelTask task, const void * context)
+{
+	auto errors = vector<exception_ptr>(count);
+	auto workers = vector<thread>();
+
+	for (auto i = 0; i < count; i++)
+	{
+		workers.push_back(thread([&, i]()
+		{
+			try { task(context, i); }
+			catch (...) { errors[i] = current_exception(); }
+		}));
+	}
+
+	for (auto& worker : workers) worker.join();
+	for (auto& error : errors) if (error != nullptr) rethrow_exception(error);
+}
+
+//--------------------------------------------------
+// Team
+//--------------------------------------------------
+
+/**
+ * @brief The loop of a thread in the team: wait for a call to start, run this thread's task if the call has one
+ * for it, and report back
+ * @param team The team that the thread belongs to
+ * @param index The index of the task that this thread runs
+ * @param generation The last call that the thread has seen
+ */
+void ParallelUtils::Work(ParallelTeam * team, int index, int generation)
+{
+	while (true)
+	{
+		unique_lock<mutex> lock(team->Lock);
+		team->Started.wait(lock, [&]() { return team->Generation != generation; });
+		generation = team->Generation;
+		if (index >= team->Count) continue;
+
+		auto task = team->Task; auto context = team->Context;
+		lock.unlock();
+
+		try { task(context, index); }
+		catch (...) { team->Errors[index] = current_exception(); }
+
+		lock.lock();
+		if (--team->Remaining == 0) team->Finished.notify_one();
+	}
+}
+
+/**
+ * @brief Get the shared team, creating it on first use
+ * @return ParallelTeam * The team
+ */
+ParallelTeam * ParallelUtils::GetTeam()
+{
+	call_once(teamCreated, []() { team = new ParallelTeam(); pthread_atfork(nullptr, nullptr, &ParallelUtils::ResetTeam); });
+	return team;
+}
+
+/**
+ * @brief Give a forked child a team of its own. The threads of the parent's team do not exist in the child, so the
+ * old team is left as it is (it cannot be joined) and a new one grows as the child needs it.
+ */
+void ParallelUtils::ResetTeam()
+{
+	team = new ParallelTeam();
+}
@@ -0,0 +1,62 @@
+//--------------------------------------------------
+// Helpers for splitting work across threads
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+using namespace std;
+
+#include <unistd.h>
+#include <pthread.h>
+
+namespace NVL_AI
+{
+	typedef void (*ParallelTask)(const void * context, int index);
+
+	struct ParallelTeam
+	{
+		atomic<bool> Busy { false };
+		mutex Lock;
+		condition_variable Started;
+		condition_variable Finished;
+		vector<thread> Workers;
+		vector<exception_ptr> Errors;
+		ParallelTask Task = nullptr;
+		const void * Context = nullptr;
+		int Count = 0;
+		int Remaining = 0;
+		int Generation = 0;
+	};
+
+	class ParallelUtils
+	{
+	public:
+		static int GetThreadCount(int requested);
+
+		// The task is handed to the threads by reference rather than wrapped in a std::function, so a call does not allocate
+		template <class Task> static void Run(int count, const Task& task)
+		{
+			if (count == 1) { task(0); return; }
+			Run(count, [](const void * context, int index) { (*(const Task *) context)(index); }, &task);
+		}
+
+		static void Run(int count, ParallelTask task, const void * context);
+	private:
+		static void Spawn(int count, ParallelTask task, const void * context);
+		static void Work(ParallelTeam * team, int index, int generation);
+		static ParallelTeam * GetTeam();
+		static void ResetTeam();
+	};
+}
@@ -0,0 +1,313 @@
+//--------------------------------------------------
+// Implementation of class QuantizedNetwork
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "QuantizedNetwork.h"
+using namespace NVL_AI;
+
+// The number of rows that each prediction thread pushes through the layers at a time
+#define PREDICT_ROWS 256
+
+// The largest magnitude of a quantized value (the range is kept symmetric, so -128 is never used)
+#define QUANT_LIMIT 127
+
+// The number of steps in the sigmoid table, and how far it reaches (in units of alpha * x)
+#define TABLE_SIZE 4096
+#define TABLE_LIMIT 16.0f
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The weights are quantized with one scale per output neuron ("channel") or one per layer
+ * ("layer"), and the activation scale of each layer is calibrated from the largest value that the float network
+ * produces over a sample of the data.
+ * @param model The trained model
+ * @param calibration The data that the activation ranges are calibrated on
+ * @param granularity The granularity of the weight scales ("channel" or "layer")
+ * @param sampleRows The number of rows that are sampled for calibration (0 uses every row)
+ * @param threadCount The number of threads that predictions are split across (0 uses every core)
+ */
+QuantizedNetwork::QuantizedNetwork(Ptr<ModelData> model, TrainData * calibration, const string& granularity, int sampleRows, int threadCount) : _model(model), _granularity(granularity)
+{
+	if (granularity != "channel" && granularity != "layer") throw runtime_error("Unknown quantization granularity: " + granularity);
+
+	auto& sizes = model->GetLayerSizes(); auto layerCount = (int) sizes.size();
+	if (layerCount < 2) throw runtime_error("A model needs at least an input and an output layer");
+	if (calibration->GetInputs().cols != sizes.front()) throw runtime_error("The calibration data does not match the input layer of the network");
+
+	_alpha = (float) model->GetAlpha(); _beta = (float) model->GetBeta();
+	_threadCount = ParallelUtils::GetThreadCount(threadCount);
+
+	auto inputScale = model->GetInputScale().ptr<double>(); auto outputScale = model->GetOutputScale().ptr<double>();
+	_inputScale.assign(inputScale, inputScale + 2 * sizes.front());
+	_outputScale.assign(outputScale, outputScale + 2 * sizes.back());
+
+	_tableRange = TABLE_LIMIT / _alpha; _table.resize(TABLE_SIZE + 1);
+	for (auto i = 0; i <= TABLE_SIZE; i++)
+	{
+		auto x = -_tableRange + 2.0 * _tableRange * i / TABLE_SIZE;
+		_table[i] = (float) (_beta * tanh(0.5 * _alpha * x));
+	}
+
+	auto ranges = Calibrate(calibration, sampleRows);
+	_layers.resize(layerCount - 1);
+	for (auto i = 1; i < layerCount; i++) QuantizeLayer(i, max(ranges[i - 1], 1e-6f) / QUANT_LIMIT);
+
+	auto stride = 0, width = 0;
+	for (auto& layer : _layers) { stride = max(stride, layer.Stride); width = max(width, layer.OutputCount); }
+
+	_buffers.resize(_threadCount);
+	for (auto& buffers : _buffers)
+	{
+		buffers.First.resize(PREDICT_ROWS * stride); buffers.Second.resize(PREDICT_ROWS * stride);
+		buffers.Sums.resize(PREDICT_ROWS * width); buffers.Values.resize(PREDICT_ROWS * max(width, _layers.front().InputCount));
+	}
+}
+
+//--------------------------------------------------
+// Network
+//--------------------------------------------------
+
+/**
+ * @brief A quantized network is built from a trained model, so it cannot be trained itself
+ * @param data The data that we are training with
+ * @param updateWeights Whether the existing weights are updated
+ */
+void QuantizedNetwork::Train(TrainData * data, bool updateWeights)
+{
+	throw runtime_error("A quantized network can only be used for prediction");
+}
+
+/**
+ * @brief A quantized network is not saved: the float model is saved and quantized again when it is loaded
+ * @param path The path that we are saving to
+ */
+void QuantizedNetwork::Save(const string& path)
+{
+	throw runtime_error("A quantized network cannot be saved (save the model it was built from instead)");
+}
+
+/**
+ * @brief Predict the outputs for a set of inputs, splitting the rows across the prediction threads
+ * @param inputs The inputs (one row per sample)
+ * @param outputs The resultant outputs
+ */
+void QuantizedNetwork::Predict(const Mat& inputs, Mat& outputs)
+{
+	if (inputs.type() != CV_32F || inputs.cols != _layers.front().InputCount) throw runtime_error("The inputs do not match the input layer of the network");
+
+	outputs.create(inputs.rows, _layers.back().OutputCount, CV_32F);
+	if (inputs.rows == 0) return;
+
+	auto threads = min(_threadCount, (inputs.rows + PREDICT_ROWS - 1) / PREDICT_ROWS);
+	auto share = (inputs.rows + threads - 1) / threads;
+
+	ParallelUtils::Run(threads, [&](int index)
+	{
+		auto start = index * share;
+		PredictRows(inputs, outputs, start, min(inputs.rows, start + share), _buffers[index]);
+	});
+}
+
+/**
+ * @brief Predict a range of rows. Each layer is an INT8 product with 32-bit sums, which are scaled back to floats,
+ * passed through the interpolated sigmoid table and then quantized again as the inputs of the next layer.
+ * @param inputs The inputs
+ * @param outputs The outputs that are written to
+ * @param start The first row
+ * @param end The row after the last row
+ * @param buffers The buffers that this range is worked through
+ */
+void QuantizedNetwork::PredictRows(const Mat& inputs, Mat& outputs, int start, int end, QuantizedBuffers& buffers)
+{
+	auto layerCount = (int) _layers.size();
+
+	for (auto block = start; block < end; block += PREDICT_ROWS)
+	{
+		auto rows = min(PREDICT_ROWS, end - block);
+		auto current = buffers.First.data(); auto next = buffers.Second.data();
+		auto sums = buffers.Sums.data(); auto values = buffers.Values.data();
+
+		QuantizeInputs(inputs, block, rows, values, current);
+
+		for (auto i = 0; i < layerCount; i++)
+		{
+			auto& layer = _layers[i]; auto n = layer.OutputCount;
+			auto scales = layer.Scales.data(); auto bias = layer.Bias.data(); auto offsets = layer.Offsets.data();
+
+			MathKernels::MultiplyInt8(current, layer.Stride, layer.Weights.data(), sums, n, rows, n, layer.InputCount);
+
+			for (auto r = 0; r < rows; r++)
+			{
+				auto sum = sums + r * n; auto value = values + r * n;
+				for (auto j = 0; j < n; j++) value[j] = (sum[j] + offsets[j]) * scales[j] + bias[j];
+			}
+
+			MathKernels::LookupTable(values, rows * n, _table.data(), TABLE_SIZE, -_tableRange, 2.0f * _tableRange / TABLE_SIZE);
+
+			for (auto r = 0; r < rows; r++)
+			{
+				auto value = values + r * n;
+
+				if (i + 1 == layerCount)
+				{
+					auto output = outputs.ptr<float>(block + r);
+					for (auto j = 0; j < n; j++) output[j] = value[j] * _outputScale[2 * j] + _outputScale[2 * j + 1];
+				}
+				else Quantize(value, n, _layers[i + 1].InputScale, next + r * _layers[i + 1].Stride);
+			}
+
+			if (i + 1 < layerCount) swap(current, next);
+		}
+	}
+}
+
+/**
+ * @brief Scale a block of inputs with the model's input scale and quantize them for the first layer
+ * @param inputs The raw inputs
+ * @param start The first row of the block
+ * @param rows The number of rows in the block
+ * @param values The buffer that a row of scaled inputs is written to
+ * @param result The quantized inputs (offset by 128)
+ */
+void QuantizedNetwork::QuantizeInputs(const Mat& inputs, int start, int rows, float * values, uint8_t * result)
+{
+	auto& layer = _layers.front(); auto scale = _inputScale.data();
+
+	for (auto r = 0; r < rows; r++)
+	{
+		auto input = inputs.ptr<float>(start + r);
+		for (auto j = 0; j < layer.InputCount; j++) values[j] = input[j] * scale[2 * j] + scale[2 * j + 1];
+		Quantize(values, layer.InputCount, layer.InputScale, result + r * layer.Stride);
+	}
+}
+
+/**
+ * @brief Quantize a row of activations, offsetting them by 128 so that they can be used as unsigned bytes
+ * @param values The activations
+ * @param count The number of activations
+ * @param scale The scale of the quantized activations
+ * @param result The quantized activations
+ */
+void QuantizedNetwork::Quantize(const float * values, int count, float scale, uint8_t * result)
+{
+	auto inverse = 1.0f / scale;
+
+	for (auto j = 0; j < count; j++)
+	{
+		// Clamped to the symmetric range first, so that adding 128.5 and truncating rounds to the nearest step
+		auto value = min(max(values[j] * inverse, (float) -QUANT_LIMIT), (float) QUANT_LIMIT);
+		result[j] = (uint8_t) (int) (value + 128.5f);
+	}
+}
+
+//--------------------------------------------------
+// Quantization
+//--------------------------------------------------
+
+/**
+ * @brief Find the largest magnitude reaching each layer by running the float network over a sample of the data
+ * @param data The calibration data
+ * @param sampleRows The number of rows that are sampled (0 uses every row)
+ * @return vector<float> The largest magnitude of the inputs of each layer
+ */
+vector<float> QuantizedNetwork::Calibrate(TrainData * data, int sampleRows)
+{
+	auto& sizes = _model->GetLayerSizes(); auto layerCount = (int) sizes.size();
+	auto result = vector<float>(layerCount - 1, 0.0f);
+	auto width = *max_element(sizes.begin(), sizes.end());
+	auto current = vector<double>(width); auto next = vector<double>(width);
+
+	for (auto row : GetSampleRows(data, sampleRows))
+	{
+		auto input = data->GetInputs().ptr<float>(row);
+		for (auto j = 0; j < sizes[0]; j++) current[j] = input[j] * _inputScale[2 * j] + _inputScale[2 * j + 1];
+
+		for (auto i = 1; i < layerCount; i++)
+		{
+			auto& weights = _model->GetWeights(i);
+			for (auto k = 0; k < sizes[i - 1]; k++) result[i - 1] = max(result[i - 1], (float) abs(current[k]));
+
+			for (auto j = 0; j < sizes[i]; j++)
+			{
+				auto sum = weights.at<double>(sizes[i - 1], j);
+				for (auto k = 0; k < sizes[i - 1]; k++) sum += current[k] * weights.at<double>(k, j);
+				next[j] = _beta * tanh(0.5 * _alpha * sum);
+			}
+			swap(current, next);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Quantize the weights of a layer to INT8 and fold the scales, the bias and the activation offset into the
+ * factors that turn its 32-bit sums back into floats
+ * @param layer The index of the layer (1 is the first hidden layer)
+ * @param inputScale The scale of the quantized inputs of the layer
+ */
+void QuantizedNetwork::QuantizeLayer(int layer, float inputScale)
+{
+	auto& weights = _model->GetWeights(layer); auto& result = _layers[layer - 1];
+	auto inputs = weights.rows - 1; auto outputs = weights.cols;
+
+	result.InputCount = inputs; result.OutputCount = outputs; result.Stride = (inputs + 3) / 4 * 4;
+	result.InputScale = inputScale;
+
+	auto limits = vector<double>(outputs, 0.0);
+	for (auto k = 0; k < inputs; k++) for (auto j = 0; j < outputs; j++) limits[j] = max(limits[j], abs(weights.at<double>(k, j)));
+	if (_granularity == "layer") fill(limits.begin(), limits.end(), *max_element(limits.begin(), limits.end()));
+
+	auto values = vector<int8_t>(inputs * outputs);
+	result.Scales.resize(outputs); result.Bias.resize(outputs); result.Offsets.assign(outputs, 0);
+
+	for (auto j = 0; j < outputs; j++)
+	{
+		auto scale = limits[j] > 0 ? limits[j] / QUANT_LIMIT : 1.0;
+
+		for (auto k = 0; k < inputs; k++)
+		{
+			auto value = (int) lround(weights.at<double>(k, j) / scale);
+			values[k * outputs + j] = (int8_t) min(max(value, -QUANT_LIMIT), QUANT_LIMIT);
+			result.Offsets[j] -= 128 * values[k * outputs + j];
+		}
+
+		result.Scales[j] = (float) (scale * inputScale);
+		result.Bias[j] = (float) weights.at<double>(inputs, j);
+	}
+
+	result.Weights.resize(MathKernels::GetPackedInt8Size(outputs, inputs));
+	MathKernels::PackInt8(values.data(), outputs, outputs, inputs, result.Weights.data());
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Pick evenly spaced rows of a dataset (following the rows of a view)
+ * @param data The data that we are sampling
+ * @param count The number of rows that we want (0 uses every row)
+ * @return vector<int> The indices of the rows within the data's matrices
+ */
+vector<int> QuantizedNetwork::GetSampleRows(TrainData * data, int count)
+{
+	auto total = data->GetRowCount();
+	if (count <= 0 || count > total) count = total;
+
+	auto result = vector<int>(count);
+	for (auto i = 0; i < count; i++)
+	{
+		auto row = (int) ((int64_t) i * total / count);
+		result[i] = data->IsView() ? data->GetRows()[row] : row;
+	}
+
+	return result;
+}
@@ -0,0 +1,83 @@
+//--------------------------------------------------
+// A prediction-only network that runs a trained model on INT8 weights and activations
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Network.h"
+#include "TrainData.h"
+#include "ModelData.h"
+#include "MathKernels.h"
+#include "ParallelUtils.h"
+
+namespace NVL_AI
+{
+	struct QuantizedLayer
+	{
+		int InputCount;
+		int OutputCount;
+		int Stride;
+		float InputScale;
+		vector<int8_t> Weights;
+		vector<float> Scales;
+		vector<float> Bias;
+		vector<int32_t> Offsets;
+	};
+
+	struct QuantizedBuffers
+	{
+		vector<uint8_t> First;
+		vector<uint8_t> Second;
+		vector<int32_t> Sums;
+		vector<float> Values;
+	};
+
+	class QuantizedNetwork : public Network
+	{
+	private:
+		Ptr<ModelData> _model;
+		string _granularity;
+		int _threadCount;
+		float _alpha;
+		float _beta;
+
+		vector<float> _inputScale;
+		vector<float> _outputScale;
+		vector<QuantizedLayer> _layers;
+		vector<float> _table;
+		float _tableRange;
+		vector<QuantizedBuffers> _buffers;
+	public:
+		QuantizedNetwork(Ptr<ModelData> model, TrainData * calibration, const string& granularity = "channel", int sampleRows = 4096, int threadCount = 1);
+
+		void Train(TrainData * data, bool updateWeights) override;
+		void Predict(const Mat& inputs, Mat& outputs) override;
+		Ptr<ModelData> GetModel() override { return _model; }
+		void Save(const string& path) override;
+		string GetBackend() override { return "int8"; }
+
+		inline string& GetGranularity() { return _granularity; }
+		inline vector<QuantizedLayer>& GetLayers() { return _layers; }
+
+		static vector<int> GetSampleRows(TrainData * data, int count);
+	private:
+		vector<float> Calibrate(TrainData * data, int sampleRows);
+		void QuantizeLayer(int layer, float inputScale);
+		void PredictRows(const Mat& inputs, Mat& outputs, int start, int end, QuantizedBuffers& buffers);
+		void QuantizeInputs(const Mat& inputs, int start, int rows, float * values, uint8_t * result);
+		static void Quantize(const float * values, int count, float scale, uint8_t * result);
+	};
+}
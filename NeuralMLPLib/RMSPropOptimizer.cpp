@@ -0,0 +1,46 @@
+//--------------------------------------------------
+// Implementation of class RMSPropOptimizer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "RMSPropOptimizer.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Setup
+//--------------------------------------------------
+
+/**
+ * @brief Allocate the running averages for each layer
+ * @param layerSizes The sizes of the layers in the network
+ */
+void RMSPropOptimizer::Setup(const vector<int>& layerSizes)
+{
+	CreateState(layerSizes, _average);
+}
+
+/**
+ * @brief Forget the running averages
+ */
+void RMSPropOptimizer::Reset()
+{
+	ClearState(_average);
+}
+
+//--------------------------------------------------
+// Update
+//--------------------------------------------------
+
+/**
+ * @brief Update the weights of a layer
+ * @param layer The index of the layer
+ * @param weights The weights of the layer
+ * @param gradient The descent direction for the weights
+ */
+void RMSPropOptimizer::Update(int layer, Mat& weights, Mat& gradient)
+{
+	MathKernels::RMSPropUpdate((float *) weights.data, (float *) _average[layer].data, (float *) gradient.data, (float) _learnRate, (float) _decay, (float) _epsilon, (int) weights.total());
+}
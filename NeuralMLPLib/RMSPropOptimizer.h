@@ -0,0 +1,33 @@
+//--------------------------------------------------
+// The RMSProp optimizer (gradients scaled by a running RMS)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "Optimizer.h"
+
+namespace NVL_AI
+{
+	class RMSPropOptimizer : public Optimizer
+	{
+	private:
+		double _decay;
+		double _epsilon;
+		vector<Mat> _average;
+	public:
+		RMSPropOptimizer(double learnRate, double decay = 0.9, double epsilon = 1e-8) :
+			Optimizer(learnRate), _decay(decay), _epsilon(epsilon) {}
+
+		void Setup(const vector<int>& layerSizes) override;
+		void Reset() override;
+		void Update(int layer, Mat& weights, Mat& gradient) override;
+		string GetName() override { return "rmsprop"; }
+	};
+}
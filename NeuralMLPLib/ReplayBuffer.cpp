@@ -0,0 +1,114 @@
+//--------------------------------------------------
+// Implementation of class ReplayBuffer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ReplayBuffer.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param capacity The most rows that are kept (0 keeps none)
+ * @param inputCount The number of inputs in each row
+ * @param outputCount The number of outputs in each row
+ * @param seed The seed for choosing which rows are kept and replayed
+ */
+ReplayBuffer::ReplayBuffer(int capacity, int inputCount, int outputCount, int seed) : _capacity(max(0, capacity)), _size(0), _seen(0), _random(seed)
+{
+	_inputs = Mat_<float>(max(1, _capacity), inputCount);
+	_outputs = Mat_<float>(max(1, _capacity), outputCount);
+}
+
+//--------------------------------------------------
+// Add
+//--------------------------------------------------
+
+/**
+ * @brief Offer every row of a dataset (or a view of one) to the buffer
+ * @param data The rows that are offered
+ */
+void ReplayBuffer::Add(TrainData * data)
+{
+	auto& inputs = data->GetInputs(); auto& outputs = data->GetOutputs();
+	if (inputs.cols != _inputs.cols || outputs.cols != _outputs.cols) throw runtime_error("The data does not match the replay buffer");
+
+	for (auto i = 0; i < data->GetRowCount(); i++)
+	{
+		auto row = data->IsView() ? data->GetRows()[i] : i;
+		AddRow(inputs.ptr<float>(row), outputs.ptr<float>(row));
+	}
+}
+
+/**
+ * @brief Offer the first rows of a batch to the buffer
+ * @param inputs The inputs of the batch
+ * @param outputs The outputs of the batch
+ * @param rows The number of rows of the batch that hold records
+ */
+void ReplayBuffer::Add(const Mat& inputs, const Mat& outputs, int rows)
+{
+	if (inputs.cols != _inputs.cols || outputs.cols != _outputs.cols) throw runtime_error("The data does not match the replay buffer");
+	for (auto row = 0; row < rows; row++) AddRow(inputs.ptr<float>(row), outputs.ptr<float>(row));
+}
+
+/**
+ * @brief Offer a row to the buffer. Once the buffer is full, each new row replaces a random one with a chance of
+ * capacity / seen (reservoir sampling), so what is kept stays an even sample of every row seen, however long the
+ * run goes on.
+ * @param inputs The inputs of the row
+ * @param outputs The outputs of the row
+ */
+void ReplayBuffer::AddRow(const float * inputs, const float * outputs)
+{
+	_seen++;
+	if (_capacity == 0) return;
+
+	auto slot = _size;
+	if (_size == _capacity)
+	{
+		auto pick = uniform_int_distribution<long>(0, _seen - 1)(_random);
+		if (pick >= _capacity) return;
+		slot = (int) pick;
+	}
+	else _size++;
+
+	memcpy(_inputs.ptr<float>(slot), inputs, _inputs.cols * sizeof(float));
+	memcpy(_outputs.ptr<float>(slot), outputs, _outputs.cols * sizeof(float));
+}
+
+//--------------------------------------------------
+// Sample
+//--------------------------------------------------
+
+/**
+ * @brief Copy randomly chosen rows (with replacement) into part of a batch
+ * @param count The number of rows that are wanted
+ * @param inputs The inputs of the batch
+ * @param outputs The outputs of the batch
+ * @param offset The first row of the batch that is written to
+ * @return int The number of rows that were written (none while the buffer is empty)
+ */
+int ReplayBuffer::Sample(int count, Mat& inputs, Mat& outputs, int offset)
+{
+	if (inputs.cols != _inputs.cols || outputs.cols != _outputs.cols) throw runtime_error("The batch does not match the replay buffer");
+	if (_size == 0) return 0;
+
+	count = min(count, inputs.rows - offset);
+	auto pick = uniform_int_distribution<int>(0, _size - 1);
+
+	for (auto i = 0; i < count; i++)
+	{
+		auto slot = pick(_random);
+		memcpy(inputs.ptr<float>(offset + i), _inputs.ptr<float>(slot), _inputs.cols * sizeof(float));
+		memcpy(outputs.ptr<float>(offset + i), _outputs.ptr<float>(slot), _outputs.cols * sizeof(float));
+	}
+
+	return count;
+}
@@ -0,0 +1,46 @@
+//--------------------------------------------------
+// A bounded store of the rows that have been trained on, kept as an even sample of everything seen so far, so that
+// training on new rows can be mixed with older ones
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <random>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "TrainData.h"
+
+namespace NVL_AI
+{
+	class ReplayBuffer
+	{
+	private:
+		int _capacity;
+		Mat _inputs;
+		Mat _outputs;
+		int _size;
+		long _seen;
+		mt19937 _random;
+	public:
+		ReplayBuffer(int capacity, int inputCount, int outputCount, int seed = 0x5eed);
+
+		void Add(TrainData * data);
+		void Add(const Mat& inputs, const Mat& outputs, int rows);
+		int Sample(int count, Mat& inputs, Mat& outputs, int offset);
+
+		inline int GetCapacity() { return _capacity; }
+		inline int GetSize() { return _size; }
+		inline long GetSeen() { return _seen; }
+	private:
+		void AddRow(const float * inputs, const float * outputs);
+	};
+}
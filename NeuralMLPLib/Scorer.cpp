@@ -0,0 +1,176 @@
+//--------------------------------------------------
+// Implementation of class Scorer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Scorer.h"
+using namespace NVL_AI;
+
+// The smallest number of rows worth giving to a scoring thread
+#define MIN_THREAD_ROWS 16384
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The prediction buffer and the per-thread partial sums are allocated here, so that
+ * scoring does not allocate anything. The rows of a view are gathered once here, so that the network can
+ * predict them as a single block.
+ * @param data The data that networks are scored against
+ * @param threadCount The number of threads that the errors are summed with (0 uses every core)
+ */
+Scorer::Scorer(TrainData * data, int threadCount)
+{
+	_inputs = data->IsView() ? GatherRows(data->GetInputs(), data->GetRows()) : data->GetInputs();
+	_outputs = data->IsView() ? GatherRows(data->GetOutputs(), data->GetRows()) : data->GetOutputs();
+
+	auto& outputs = _outputs;
+	if (outputs.type() != CV_32F || !outputs.isContinuous()) throw runtime_error("Scoring requires continuous float outputs");
+
+	auto maxThreads = max(1, outputs.rows / MIN_THREAD_ROWS);
+	_threadCount = min(ParallelUtils::GetThreadCount(threadCount), maxThreads);
+
+	_predictions = Mat_<float>(outputs.rows, outputs.cols);
+	_partials = vector<ScorePartial>(_threadCount);
+	_totalSquares = GetTotalSquares(outputs);
+}
+
+//--------------------------------------------------
+// Evaluate
+//--------------------------------------------------
+
+/**
+ * @brief Score a network, predicting into the preallocated buffer
+ * @param network The network that we are scoring
+ * @return Score The resultant score
+ */
+Score Scorer::Evaluate(Ptr<Network>& network)
+{
+	network->Predict(_inputs, _predictions);
+	return Evaluate(_predictions);
+}
+
+/**
+ * @brief Score a set of predictions. The rows are split across the threads, each thread keeps its own partial
+ * sums and these are reduced at the end.
+ * @param predictions The predictions (one row per sample)
+ * @return Score The resultant score
+ */
+Score Scorer::Evaluate(const Mat& predictions)
+{
+	auto& outputs = _outputs;
+	if (predictions.type() != CV_32F || predictions.rows != outputs.rows || predictions.cols != outputs.cols) throw runtime_error("The predictions do not match the dataset outputs");
+
+	auto share = (outputs.rows + _threadCount - 1) / _threadCount;
+
+	ParallelUtils::Run(_threadCount, [&](int index)
+	{
+		auto start = index * share;
+		Accumulate(predictions, start, min(outputs.rows, start + share), _partials[index]);
+	});
+
+	auto absError = 0.0; auto squaredError = 0.0; auto maxError = 0.0;
+	for (auto& partial : _partials)
+	{
+		absError += partial.AbsError; squaredError += partial.SquaredError; maxError = max(maxError, partial.MaxError);
+	}
+
+	auto count = max(1.0, (double)outputs.total());
+
+	auto result = Score();
+	result.Total = absError;
+	result.MAE = absError / count;
+	result.RMSE = sqrt(squaredError / count);
+	result.MaxError = maxError;
+	result.R2 = _totalSquares > 0 ? 1.0 - squaredError / _totalSquares : 0.0;
+	return result;
+}
+
+/**
+ * @brief Sum the errors of a range of rows
+ * @param predictions The predictions
+ * @param start The first row
+ * @param end The row after the last row
+ * @param partial The partial sums that are written to
+ */
+void Scorer::Accumulate(const Mat& predictions, int start, int end, ScorePartial& partial)
+{
+	auto& outputs = _outputs; auto n = outputs.cols;
+	auto absError = 0.0; auto squaredError = 0.0; auto maxError = 0.0;
+
+	for (auto row = start; row < end; row++)
+	{
+		auto actual = predictions.ptr<float>(row); auto expected = outputs.ptr<float>(row);
+
+		for (auto k = 0; k < n; k++)
+		{
+			auto diff = abs((double)actual[k] - (double)expected[k]);
+			absError += diff; squaredError += diff * diff; maxError = max(maxError, diff);
+		}
+	}
+
+	partial.AbsError = absError; partial.SquaredError = squaredError; partial.MaxError = maxError;
+}
+
+//--------------------------------------------------
+// Metrics
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the value of a metric, arranged so that lower is always better
+ * @param score The score that we are reading
+ * @param metric The metric ("total", "mae", "rmse", "max" or "r2")
+ * @return double The resultant loss (R² is returned as 1 - R²)
+ */
+double Scorer::GetLoss(const Score& score, const string& metric)
+{
+	if (metric == "total") return score.Total;
+	if (metric == "mae") return score.MAE;
+	if (metric == "rmse") return score.RMSE;
+	if (metric == "max") return score.MaxError;
+	if (metric == "r2") return 1.0 - score.R2;
+
+	throw runtime_error(NVLib::Formatter() << "Unknown score metric: " << metric);
+}
+
+/**
+ * @brief Find the total sum of squares of the outputs about their column means (the denominator of R²)
+ * @param outputs The expected outputs
+ * @return double The resultant sum of squares
+ */
+double Scorer::GetTotalSquares(const Mat& outputs)
+{
+	auto result = 0.0;
+
+	for (auto k = 0; k < outputs.cols; k++)
+	{
+		auto mean = 0.0;
+		for (auto row = 0; row < outputs.rows; row++) mean += outputs.ptr<float>(row)[k];
+		mean /= max(1, outputs.rows);
+
+		for (auto row = 0; row < outputs.rows; row++)
+		{
+			auto diff = outputs.ptr<float>(row)[k] - mean;
+			result += diff * diff;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Copy a set of rows into a new (continuous) matrix
+ * @param source The matrix that the rows come from
+ * @param rows The indices of the rows
+ * @return Mat The resultant matrix
+ */
+Mat Scorer::GatherRows(const Mat& source, const vector<int>& rows)
+{
+	auto result = Mat((int) rows.size(), source.cols, source.type()); auto rowBytes = source.cols * source.elemSize();
+	for (auto i = 0; i < (int) rows.size(); i++) memcpy(result.ptr(i), source.ptr(rows[i]), rowBytes);
+	return result;
+}
@@ -0,0 +1,64 @@
+//--------------------------------------------------
+// Scores a network against a dataset, finding every error metric in one parallel pass
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "Network.h"
+#include "TrainData.h"
+#include "ParallelUtils.h"
+
+namespace NVL_AI
+{
+	struct Score
+	{
+		double Total = 0;
+		double MAE = 0;
+		double RMSE = 0;
+		double MaxError = 0;
+		double R2 = 0;
+	};
+
+	struct alignas(64) ScorePartial
+	{
+		double AbsError;
+		double SquaredError;
+		double MaxError;
+	};
+
+	class Scorer
+	{
+	private:
+		Mat _inputs;
+		Mat _outputs;
+		int _threadCount;
+		Mat _predictions;
+		vector<ScorePartial> _partials;
+		double _totalSquares;
+	public:
+		Scorer(TrainData * data, int threadCount = 0);
+
+		Score Evaluate(Ptr<Network>& network);
+		Score Evaluate(const Mat& predictions);
+
+		inline Mat& GetPredictions() { return _predictions; }
+
+		static double GetLoss(const Score& score, const string& metric);
+	private:
+		void Accumulate(const Mat& predictions, int start, int end, ScorePartial& partial);
+		static double GetTotalSquares(const Mat& outputs);
+		static Mat GatherRows(const Mat& source, const vector<int>& rows);
+	};
+}
@@ -0,0 +1,209 @@
+//--------------------------------------------------
+// Implementation of class ShardReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "ShardReader.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, opens the dataset and starts the background reader. The memory budget is split into
+ * bufferCount + 2 equal parts: the ring of shard buffers, a score sample of at most one shard, and the working copy
+ * that a backend may make of the shard that it is training on. So the shard size follows from the budget, never
+ * from the size of the dataset.
+ * @param path The path to a binary dataset (a .nmld file or a dataset cache)
+ * @param memoryBytes The memory budget in bytes
+ * @param bufferCount The number of shard buffers in the ring (at least 2, so one can load while another trains)
+ * @param seed The seed of the shard order shuffle
+ */
+ShardReader::ShardReader(const string& path, uint64_t memoryBytes, int bufferCount, int seed) :
+	_path(path), _random(seed), _filled(0), _taken(0), _released(0), _reading(false), _stopping(false)
+{
+	if (bufferCount < 2) throw runtime_error("The shard ring needs at least 2 buffers");
+
+	_file = open(path.c_str(), O_RDONLY);
+	if (_file < 0) throw runtime_error("Unable to open file: " + path);
+
+	struct stat info;
+	if (fstat(_file, &info) != 0 || (uint64_t) info.st_size < sizeof(DataCacheHeader)) { close(_file); throw runtime_error("Not a valid binary dataset: " + path); }
+	ReadBlock(0, sizeof(DataCacheHeader), &_header);
+	if (!DataCache::IsValid(_header, (uint64_t) info.st_size)) { close(_file); throw runtime_error("Not a valid binary dataset: " + path); }
+
+	auto statsRows = (int) (DataCache::GetStatsSize(_header) / ((_header.InputCount + _header.OutputCount) * sizeof(double)));
+	_inputStats = Mat(statsRows, (int) _header.InputCount, CV_64F); _outputStats = Mat(statsRows, (int) _header.OutputCount, CV_64F);
+	ReadBlock(_header.StatsOffset, _inputStats.total() * sizeof(double), _inputStats.data);
+	ReadBlock(_header.StatsOffset + _inputStats.total() * sizeof(double), _outputStats.total() * sizeof(double), _outputStats.data);
+
+	auto shardRows = memoryBytes / ((bufferCount + 2) * GetRowBytes());
+	_shardRows = (int) max((uint64_t) 1, min(shardRows, max(_header.RowCount, (uint64_t) 1)));
+	_shardCount = (int) ((_header.RowCount + _shardRows - 1) / _shardRows);
+
+	_buffers.resize(bufferCount);
+	for (auto& buffer : _buffers) { buffer.Inputs = Mat(_shardRows, (int) _header.InputCount, CV_32F); buffer.Outputs = Mat(_shardRows, (int) _header.OutputCount, CV_32F); }
+
+	_reader = thread(&ShardReader::Run, this);
+}
+
+/**
+ * @brief Main Terminator, stops the background reader and closes the dataset
+ */
+ShardReader::~ShardReader()
+{
+	{
+		lock_guard<mutex> guard(_lock);
+		_stopping = true;
+	}
+
+	_changed.notify_all();
+	_reader.join();
+	close(_file);
+}
+
+//--------------------------------------------------
+// Epochs
+//--------------------------------------------------
+
+/**
+ * @brief Start a pass over the dataset in a freshly shuffled shard order. The shards of the last pass must have
+ * been let go of first, since their buffers are handed to the reader again.
+ */
+void ShardReader::StartEpoch()
+{
+	{
+		unique_lock<mutex> guard(_lock);
+		_changed.wait(guard, [this]() { return !_reading; });
+
+		_order.resize(_shardCount);
+		for (auto i = 0; i < _shardCount; i++) _order[i] = i;
+		shuffle(_order.begin(), _order.end(), _random);
+
+		_filled = 0; _taken = 0; _released = 0; _error = nullptr;
+	}
+
+	_changed.notify_all();
+}
+
+/**
+ * @brief Hand over the next shard of the pass, waiting for the reader if it has not been loaded yet. The shard that
+ * was handed over before is released back to the reader, so only one shard is held at a time.
+ * @return Ptr<TrainData> The shard (which carries the statistics of the whole dataset), or nothing at the end of the pass
+ */
+Ptr<TrainData> ShardReader::Next()
+{
+	unique_lock<mutex> guard(_lock);
+
+	if (_taken > _released) { _released = _taken; _changed.notify_all(); }
+	if (_taken >= (int) _order.size()) return Ptr<TrainData>();
+
+	_changed.wait(guard, [this]() { return _filled > _taken || _error != nullptr; });
+	if (_error != nullptr) { auto error = _error; _error = nullptr; rethrow_exception(error); }
+
+	auto& buffer = _buffers[_taken % _buffers.size()]; _taken++;
+
+	Mat inputs = buffer.Inputs.rowRange(0, buffer.Rows); Mat outputs = buffer.Outputs.rowRange(0, buffer.Rows);
+	auto result = Ptr<TrainData>(new TrainData(inputs, outputs));
+	result->SetStats(_inputStats, _outputStats);
+	return result;
+}
+
+//--------------------------------------------------
+// Sample
+//--------------------------------------------------
+
+/**
+ * @brief Read an evenly spaced sample of rows (for scoring, since the whole dataset cannot be held)
+ * @param rowCount The number of rows in the sample (at most the number in the dataset)
+ * @return TrainData * The sample, which the caller owns
+ */
+TrainData * ShardReader::ReadSample(int rowCount)
+{
+	auto count = (int) min((uint64_t) max(rowCount, 0), _header.RowCount);
+	auto inputSize = _header.InputCount * sizeof(float); auto outputSize = _header.OutputCount * sizeof(float);
+
+	Mat inputs = Mat(count, (int) _header.InputCount, CV_32F); Mat outputs = Mat(count, (int) _header.OutputCount, CV_32F);
+	for (auto i = 0; i < count; i++)
+	{
+		auto row = (uint64_t) i * _header.RowCount / count;
+		ReadBlock(_header.InputOffset + row * inputSize, inputSize, inputs.ptr(i));
+		ReadBlock(_header.OutputOffset + row * outputSize, outputSize, outputs.ptr(i));
+	}
+
+	return new TrainData(inputs, outputs);
+}
+
+//--------------------------------------------------
+// Reader
+//--------------------------------------------------
+
+/**
+ * @brief The loop of the background reader, which loads shards into free buffers ahead of the trainer
+ */
+void ShardReader::Run()
+{
+	AllocationCounter::MarkBackground();
+
+	while (true)
+	{
+		auto index = 0; auto shard = 0;
+
+		{
+			unique_lock<mutex> guard(_lock);
+			_changed.wait(guard, [this]() { return _stopping || (_error == nullptr && _filled < (int) _order.size() && _filled - _released < (int) _buffers.size()); });
+			if (_stopping) return;
+
+			index = _filled; shard = _order[index]; _reading = true;
+		}
+
+		exception_ptr error;
+		try { ReadShard(shard, _buffers[index % _buffers.size()]); } catch (...) { error = current_exception(); }
+
+		{
+			lock_guard<mutex> guard(_lock);
+			_reading = false;
+			if (error != nullptr) _error = error; else _filled++;
+		}
+
+		_changed.notify_all();
+	}
+}
+
+/**
+ * @brief Load a shard into a buffer (its rows are contiguous in both the input and the output block)
+ * @param shard The index of the shard
+ * @param buffer The buffer that it is loaded into
+ */
+void ShardReader::ReadShard(int shard, ShardBuffer& buffer)
+{
+	auto start = (uint64_t) shard * _shardRows;
+	auto rows = (int) min((uint64_t) _shardRows, _header.RowCount - start);
+	auto inputSize = _header.InputCount * sizeof(float); auto outputSize = _header.OutputCount * sizeof(float);
+
+	ReadBlock(_header.InputOffset + start * inputSize, rows * inputSize, buffer.Inputs.data);
+	ReadBlock(_header.OutputOffset + start * outputSize, rows * outputSize, buffer.Outputs.data);
+	buffer.Shard = shard; buffer.Rows = rows;
+}
+
+/**
+ * @brief Read a block of bytes from the dataset (positioned reads, so the reader and the sampler can share the file)
+ * @param offset The offset of the block
+ * @param size The number of bytes
+ * @param target The memory that the block is read into
+ */
+void ShardReader::ReadBlock(uint64_t offset, uint64_t size, void * target)
+{
+	auto output = (char *) target;
+
+	while (size > 0)
+	{
+		auto count = pread(_file, output, size, (off_t) offset);
+		if (count <= 0) throw runtime_error(NVLib::Formatter() << "Unable to read " << size << " bytes at " << offset << " from " << _path);
+		output += count; offset += count; size -= count;
+	}
+}
@@ -0,0 +1,90 @@
+//--------------------------------------------------
+// Streams a binary dataset through a bounded ring of shard buffers, so that it never has to fit in memory
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <random>
+#include <thread>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+#include <exception>
+#include <condition_variable>
+using namespace std;
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+#include "DataCache.h"
+#include "AllocationCounter.h"
+#include "TrainData.h"
+
+namespace NVL_AI
+{
+	struct ShardBuffer
+	{
+		Mat Inputs;
+		Mat Outputs;
+		int Shard = -1;
+		int Rows = 0;
+	};
+
+	class ShardReader
+	{
+	private:
+		string _path;
+		int _file;
+		DataCacheHeader _header;
+		Mat _inputStats;
+		Mat _outputStats;
+		int _shardRows;
+		int _shardCount;
+		vector<ShardBuffer> _buffers;
+		vector<int> _order;
+		mt19937 _random;
+
+		mutex _lock;
+		condition_variable _changed;
+		int _filled;
+		int _taken;
+		int _released;
+		bool _reading;
+		bool _stopping;
+		exception_ptr _error;
+		thread _reader;
+	public:
+		ShardReader(const string& path, uint64_t memoryBytes, int bufferCount = 2, int seed = 0x5eed);
+		~ShardReader();
+
+		ShardReader(const ShardReader&) = delete;
+		ShardReader& operator=(const ShardReader&) = delete;
+
+		void StartEpoch();
+		Ptr<TrainData> Next();
+		TrainData * ReadSample(int rowCount);
+
+		inline uint64_t GetRowCount() { return _header.RowCount; }
+		inline int GetInputCount() { return (int) _header.InputCount; }
+		inline int GetOutputCount() { return (int) _header.OutputCount; }
+		inline int GetShardRows() { return _shardRows; }
+		inline int GetShardCount() { return _shardCount; }
+		inline int GetBufferCount() { return (int) _buffers.size(); }
+		inline uint64_t GetRowBytes() { return (_header.InputCount + _header.OutputCount) * sizeof(float); }
+	private:
+		void Run();
+		void ReadShard(int shard, ShardBuffer& buffer);
+		void ReadBlock(uint64_t offset, uint64_t size, void * target);
+	};
+}
@@ -0,0 +1,216 @@
+//--------------------------------------------------
+// Implementation of class SharedMemoryTransport
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "SharedMemoryTransport.h"
+using namespace NVL_AI;
+
+// The value that the first worker writes once the segment is ready to use
+#define SEGMENT_READY 0x4e4d4c50
+
+// The space set aside for the header at the start of the segment
+#define HEADER_BYTES 256
+
+// The most workers that can share a segment (each has its process id in the header)
+#define MAX_WORKERS (int) (sizeof(SharedMemoryHeader::Workers) / sizeof(int))
+
+// The number of values that each worker can post at once (larger blocks are reduced in pieces)
+#define SLOT_VALUES (1 << 16)
+
+// The number of times a waiting worker checks the barrier before it starts yielding its core
+#define SPIN_LIMIT 4096
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The first worker creates the segment (replacing any that an earlier job left behind) and the
+ * others attach to it once it is ready. A segment is only joined if it was created for the same job id, so a worker
+ * never joins a segment of the same name that a crashed run or another job on this machine left behind.
+ * @param name The name of the shared memory segment
+ * @param rank The index of this worker
+ * @param size The number of workers in the job
+ * @param timeout The seconds to wait for the other workers to join before giving up
+ * @param job The id that every worker of the job shares
+ */
+SharedMemoryTransport::SharedMemoryTransport(const string& name, int rank, int size, double timeout, uint64_t job) : Transport(rank, size), _job(job), _timeout(timeout), _data(nullptr), _length(0), _header(nullptr)
+{
+	static_assert(sizeof(SharedMemoryHeader) <= HEADER_BYTES, "The shared memory header has outgrown its space");
+	if (size > MAX_WORKERS) throw runtime_error(NVLib::Formatter() << "Shared memory supports at most " << MAX_WORKERS << " workers");
+
+	_name = name.empty() || name[0] != '/' ? "/" + name : name;
+	_length = HEADER_BYTES + (size_t) size * SLOT_VALUES * sizeof(double);
+
+	if (rank == 0) Create(); else Attach();
+	_header->Workers[rank] = getpid();
+
+	try { Wait(_timeout); }
+	catch (runtime_error&) { Release(); throw; }
+}
+
+/**
+ * @brief Main Terminator
+ */
+SharedMemoryTransport::~SharedMemoryTransport()
+{
+	Release();
+}
+
+//--------------------------------------------------
+// Reduce
+//--------------------------------------------------
+
+/**
+ * @brief Combine a block of values across every worker. Each worker posts its values to its own slot and then reads
+ * every slot back in rank order; the second barrier stops a fast worker from posting its next block over a slot that
+ * is still being read.
+ * @param values The values of this worker, which are replaced with the combined values
+ * @param count The number of values
+ * @param op The operation that combines them
+ */
+void SharedMemoryTransport::AllReduce(double * values, int count, ReduceOp op)
+{
+	for (auto offset = 0; offset < count; offset += SLOT_VALUES)
+	{
+		auto n = min(SLOT_VALUES, count - offset);
+
+		memcpy(GetSlot(GetRank()), values + offset, n * sizeof(double));
+		Wait(0);
+
+		memcpy(values + offset, GetSlot(0), n * sizeof(double));
+		for (auto rank = 1; rank < GetSize(); rank++) Reduce(values + offset, GetSlot(rank), n, op);
+		Wait(0);
+	}
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Create the segment and mark it as ready (the first worker)
+ */
+void SharedMemoryTransport::Create()
+{
+	shm_unlink(_name.c_str());
+
+	auto handle = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (handle < 0) throw runtime_error("Unable to create shared memory: " + _name);
+	if (ftruncate(handle, (off_t) _length) != 0) { close(handle); throw runtime_error("Unable to size shared memory: " + _name); }
+
+	auto data = mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0); close(handle);
+	if (data == MAP_FAILED) throw runtime_error("Unable to map shared memory: " + _name);
+
+	_data = (char *) data; _header = new (_data) SharedMemoryHeader();
+	_header->Size = GetSize(); _header->Capacity = SLOT_VALUES; _header->Job = _job; _header->Waiting = 0; _header->Generation = 0;
+	_header->Ready.store(SEGMENT_READY, memory_order_release);
+}
+
+/**
+ * @brief Attach to the segment once the first worker of this job has made it ready (the other workers)
+ */
+void SharedMemoryTransport::Attach()
+{
+	auto start = chrono::steady_clock::now();
+
+	while (chrono::duration<double>(chrono::steady_clock::now() - start).count() < _timeout)
+	{
+		auto handle = shm_open(_name.c_str(), O_RDWR, 0600);
+		struct stat info;
+
+		if (handle >= 0 && fstat(handle, &info) == 0 && (size_t) info.st_size == _length)
+		{
+			auto data = mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0); close(handle);
+			if (data == MAP_FAILED) throw runtime_error("Unable to map shared memory: " + _name);
+
+			auto header = (SharedMemoryHeader *) data;
+			auto ready = header->Ready.load(memory_order_acquire) == SEGMENT_READY;
+			if (ready && header->Size == GetSize() && header->Job == _job) { _data = (char *) data; _header = header; return; }
+			munmap(data, _length);
+		}
+		else if (handle >= 0) close(handle);
+
+		this_thread::sleep_for(chrono::milliseconds(1));
+	}
+
+	throw runtime_error("Timed out waiting for the first worker to create " + _name);
+}
+
+/**
+ * @brief Let the segment go. The first worker removes it; the others keep their mapping until they let it go.
+ */
+void SharedMemoryTransport::Release()
+{
+	if (_data == nullptr) return;
+
+	if (GetRank() == 0) { _header->Ready.store(0); shm_unlink(_name.c_str()); }
+	munmap(_data, _length); _data = nullptr; _header = nullptr;
+}
+
+/**
+ * @brief Wait until every worker has reached the barrier. The last worker to arrive moves the barrier on to its
+ * next generation, which is what the others are spinning on. A waiting worker checks now and then that the others
+ * are still running, so a worker that dies part way through stops the job rather than hanging it.
+ * @param timeout The seconds to wait (0 waits for as long as it takes)
+ */
+void SharedMemoryTransport::Wait(double timeout)
+{
+	auto generation = _header->Generation.load(memory_order_acquire);
+
+	if (_header->Waiting.fetch_add(1, memory_order_acq_rel) + 1 == GetSize())
+	{
+		_header->Waiting.store(0, memory_order_relaxed);
+		_header->Generation.fetch_add(1, memory_order_release);
+		return;
+	}
+
+	auto start = chrono::steady_clock::now();
+	for (auto spins = 0L; _header->Generation.load(memory_order_acquire) == generation; spins++)
+	{
+		if (spins < SPIN_LIMIT) continue;
+
+		this_thread::yield();
+		if ((spins & 1023) != 0) continue;
+
+		if (timeout > 0 && chrono::duration<double>(chrono::steady_clock::now() - start).count() > timeout) throw runtime_error("Timed out waiting for the other workers on " + _name);
+		for (auto rank = 0; rank < GetSize(); rank++)
+		{
+			// A worker that has passed the barrier may have finished and exited since the generation was read
+			if (IsRunning(_header->Workers[rank]) || _header->Generation.load(memory_order_acquire) != generation) continue;
+			throw runtime_error(NVLib::Formatter() << "Worker " << rank << " stopped on " << _name);
+		}
+	}
+}
+
+/**
+ * @brief Find the slot that a worker posts its values to
+ * @param rank The index of the worker
+ * @return double * The start of the slot
+ */
+double * SharedMemoryTransport::GetSlot(int rank)
+{
+	return (double *) (_data + HEADER_BYTES) + (size_t) rank * SLOT_VALUES;
+}
+
+/**
+ * @brief Check whether a worker process is still running. A worker that has exited but not been collected by its
+ * parent (which may be the worker that is waiting on it) still answers a signal, so its state is read as well.
+ * @param worker The process id of the worker (0 if it has not joined yet)
+ * @return bool True unless the process is known to have stopped
+ */
+bool SharedMemoryTransport::IsRunning(int worker)
+{
+	if (worker <= 0) return true;
+	if (kill((pid_t) worker, 0) != 0) return errno != ESRCH;
+
+	auto reader = ifstream(NVLib::Formatter() << "/proc/" << worker << "/stat");
+	auto line = string(); getline(reader, line);
+
+	auto position = line.rfind(')');
+	return position == string::npos || position + 2 >= line.size() || line[position + 2] != 'Z';
+}
@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// A transport between the worker processes of one machine, through a block of POSIX shared memory
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Transport.h"
+
+namespace NVL_AI
+{
+	struct SharedMemoryHeader
+	{
+		atomic<uint32_t> Ready;
+		int Size;
+		int Capacity;
+		uint64_t Job;
+		alignas(64) atomic<int> Waiting;
+		alignas(64) atomic<int> Generation;
+		int Workers[16];
+	};
+
+	class SharedMemoryTransport : public Transport
+	{
+	private:
+		string _name;
+		uint64_t _job;
+		double _timeout;
+		char * _data;
+		size_t _length;
+		SharedMemoryHeader * _header;
+	public:
+		SharedMemoryTransport(const string& name, int rank, int size, double timeout = 60, uint64_t job = 0);
+		~SharedMemoryTransport();
+
+		void AllReduce(double * values, int count, ReduceOp op) override;
+		string GetName() override { return "shm"; }
+
+		inline string& GetSegmentName() { return _name; }
+	private:
+		void Create();
+		void Attach();
+		void Release();
+		void Wait(double timeout);
+		double * GetSlot(int rank);
+		static bool IsRunning(int worker);
+	};
+}
@@ -0,0 +1,190 @@
+//--------------------------------------------------
+// Implementation of class Sweeper
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Sweeper.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, builds a trial for every combination of structure, learning rate and iteration budget.
+ * A share of the rows (ValidationSplit, which 0 switches off) is held out, so that the trials are ranked on rows
+ * that they were not trained on.
+ * @param data The training data, which every trial reads (and none of them changes)
+ * @param settings The settings of the sweep
+ */
+Sweeper::Sweeper(TrainData * data, const SweepSettings& settings) : _data(data), _settings(settings), _rungCount(0), _stealCount(0)
+{
+	if (settings.Structures.empty() || settings.LearnRates.empty() || settings.Budgets.empty()) throw runtime_error("A sweep needs at least one structure, learning rate and iteration budget");
+	if (settings.MinIterations < 1 || settings.Eta < 2) throw runtime_error("A sweep needs at least 1 iteration per rung and a halving rate of at least 2");
+	if (settings.ValidationSplit > 0) NeuralUtils::SplitData(data, settings.ValidationSplit, settings.ValidationSeed, _fitView, _validationView);
+
+	for (auto& structure : settings.Structures) for (auto learnRate : settings.LearnRates) for (auto budget : settings.Budgets)
+	{
+		auto trial = Ptr<SweepTrial>(new SweepTrial());
+		trial->Id = (int) _trials.size();
+		trial->Settings = settings.Base; trial->Settings.Structure = structure; trial->Settings.LearnRate = learnRate;
+		trial->Settings.ThreadCount = 1;
+		trial->Budget = budget;
+		_trials.push_back(trial);
+	}
+}
+
+//--------------------------------------------------
+// Run
+//--------------------------------------------------
+
+/**
+ * @brief Run the sweep. Rung r trains every surviving trial up to MinIterations * Eta^r iterations (or its own budget)
+ * on the work pool, then only the best 1/Eta of them carry on. Trials that reach their budget stop there.
+ * @return vector<Ptr<SweepTrial>> The leaderboard (best first, led by a trial that kept its model)
+ */
+vector<Ptr<SweepTrial>> Sweeper::Run()
+{
+	auto pool = WorkPool(_settings.ThreadCount);
+	auto alive = _trials; auto target = (double) _settings.MinIterations;
+
+	for (_rungCount = 0; !alive.empty(); _rungCount++, target *= _settings.Eta)
+	{
+		for (auto& trial : alive)
+		{
+			auto limit = (int) min((double) trial->Budget, target);
+			auto current = trial;
+			pool.Submit([this, current, limit]() { Advance(*current, limit); });
+		}
+		pool.Wait();
+
+		sort(alive.begin(), alive.end(), IsAhead);
+		auto keepCount = max(1, (int) ceil(alive.size() / (double) _settings.Eta));
+
+		auto survivors = vector<Ptr<SweepTrial>>();
+		for (auto i = 0; i < (int) alive.size(); i++)
+		{
+			auto& trial = alive[i];
+
+			if (i >= keepCount) { trial->CutRung = _rungCount; Release(*trial, false); }
+			else if (trial->Iterations >= trial->Budget) Release(*trial, true);
+			else survivors.push_back(trial);
+		}
+		alive = survivors;
+	}
+
+	_stealCount = pool.GetStealCount();
+
+	auto result = _trials;
+	sort(result.begin(), result.end(), IsAhead);
+	if (result[0]->BestModel == nullptr) throw runtime_error("The sweep finished without keeping the model of any trial");
+	return result;
+}
+
+/**
+ * @brief Order two trials on the leaderboard. Trials that kept their model come before those that were cut (which
+ * can tie them on score), then the lower score wins and the trial id breaks any tie that is left, so the order never
+ * depends on the sort.
+ * @param a The first trial
+ * @param b The second trial
+ * @return bool True if the first trial ranks ahead of the second
+ */
+bool Sweeper::IsAhead(const Ptr<SweepTrial>& a, const Ptr<SweepTrial>& b)
+{
+	if ((a->BestModel != nullptr) != (b->BestModel != nullptr)) return a->BestModel != nullptr;
+	if (a->BestScore != b->BestScore) return a->BestScore < b->BestScore;
+	return a->Id < b->Id;
+}
+
+/**
+ * @brief Train a trial until it has done the given number of iterations, keeping a snapshot of the weights that
+ * score best on the held out rows
+ * @param trial The trial that we are training
+ * @param target The number of iterations that the trial should have done afterwards
+ */
+void Sweeper::Advance(SweepTrial& trial, int target)
+{
+	auto start = chrono::steady_clock::now();
+
+	auto fitData = _fitView != nullptr ? _fitView.get() : _data;
+
+	if (trial.Learner == nullptr)
+	{
+		trial.Learner = NetworkFactory::Create(trial.Settings, _data->GetInputs().cols, _data->GetOutputs().cols);
+		trial.Evaluator = Ptr<Scorer>(new Scorer(GetValidationData(), 1));
+
+		trial.Learner->Train(fitData, false);
+		trial.BestScore = Scorer::GetLoss(trial.Evaluator->Evaluate(trial.Learner), _settings.Metric);
+		trial.BestModel = trial.Learner->GetModel();
+	}
+
+	for (; trial.Iterations < target; trial.Iterations++)
+	{
+		trial.Learner->Train(fitData, true);
+
+		auto score = Scorer::GetLoss(trial.Evaluator->Evaluate(trial.Learner), _settings.Metric);
+		if (score < trial.BestScore) { trial.BestScore = score; trial.BestModel = trial.Learner->GetModel(); }
+	}
+
+	trial.Seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Free the network and buffers of a trial that has stopped training
+ * @param trial The trial that has stopped
+ * @param keepModel Keep the snapshot of its best weights (only needed while it could still be the winner)
+ */
+void Sweeper::Release(SweepTrial& trial, bool keepModel)
+{
+	trial.Learner.reset(); trial.Evaluator.reset();
+	if (!keepModel) trial.BestModel.reset();
+}
+
+//--------------------------------------------------
+// Parsing
+//--------------------------------------------------
+
+/**
+ * @brief Parse a list of values, given either as "a;b;c" or as an evenly spaced range "start:end:count"
+ * @param text The text that we are parsing
+ * @return vector<double> The resultant values
+ */
+vector<double> Sweeper::ParseValues(const string& text)
+{
+	auto result = vector<double>();
+
+	auto parts = vector<string>(); NVLib::StringUtils::Split(text, ':', parts);
+	if (parts.size() == 3)
+	{
+		auto start = NVLib::StringUtils::String2Double(parts[0]); auto end = NVLib::StringUtils::String2Double(parts[1]);
+		auto count = NVLib::StringUtils::String2Int(parts[2]);
+		if (count < 1) throw runtime_error("A range needs at least one value: " + text);
+
+		for (auto i = 0; i < count; i++) result.push_back(count == 1 ? start : start + (end - start) * i / (count - 1));
+		return result;
+	}
+
+	for (auto& part : ParseList(text)) result.push_back(NVLib::StringUtils::String2Double(part));
+	return result;
+}
+
+/**
+ * @brief Split a list of items separated by semicolons (empty items are dropped)
+ * @param text The text that we are splitting
+ * @return vector<string> The resultant items
+ */
+vector<string> Sweeper::ParseList(const string& text)
+{
+	auto parts = vector<string>(); NVLib::StringUtils::Split(text, ';', parts);
+
+	auto result = vector<string>();
+	for (auto& part : parts)
+	{
+		auto first = part.find_first_not_of(" \t"); if (first == string::npos) continue;
+		result.push_back(part.substr(first, part.find_last_not_of(" \t") - first + 1));
+	}
+	return result;
+}
@@ -0,0 +1,86 @@
+//--------------------------------------------------
+// Trains a grid of network settings side by side, cutting the losing trials by successive halving
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <chrono>
+#include <cfloat>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+#include <NVLib/StringUtils.h>
+
+#include "Scorer.h"
+#include "WorkPool.h"
+#include "TrainData.h"
+#include "NetworkFactory.h"
+
+namespace NVL_AI
+{
+	struct SweepSettings
+	{
+		NetworkSettings Base;
+		vector<string> Structures;
+		vector<double> LearnRates;
+		vector<int> Budgets;
+		int MinIterations = 10;
+		int Eta = 3;
+		int ThreadCount = 0;
+		string Metric = "total";
+		double ValidationSplit = 0.2;
+		unsigned int ValidationSeed = 0x5eed;
+	};
+
+	struct SweepTrial
+	{
+		int Id = 0;
+		NetworkSettings Settings;
+		int Budget = 0;
+		int Iterations = 0;
+		double BestScore = DBL_MAX;
+		int CutRung = -1;
+		double Seconds = 0;
+		Ptr<Network> Learner;
+		Ptr<Scorer> Evaluator;
+		Ptr<ModelData> BestModel;
+	};
+
+	class Sweeper
+	{
+	private:
+		TrainData * _data;
+		Ptr<TrainData> _fitView;
+		Ptr<TrainData> _validationView;
+		SweepSettings _settings;
+		vector<Ptr<SweepTrial>> _trials;
+		int _rungCount;
+		int _stealCount;
+	public:
+		Sweeper(TrainData * data, const SweepSettings& settings);
+
+		vector<Ptr<SweepTrial>> Run();
+
+		inline vector<Ptr<SweepTrial>>& GetTrials() { return _trials; }
+		inline TrainData * GetValidationData() { return _validationView != nullptr ? _validationView.get() : _data; }
+		inline int GetRungCount() { return _rungCount; }
+		inline int GetStealCount() { return _stealCount; }
+
+		static vector<double> ParseValues(const string& text);
+		static vector<string> ParseList(const string& text);
+		static bool IsAhead(const Ptr<SweepTrial>& a, const Ptr<SweepTrial>& b);
+	private:
+		void Advance(SweepTrial& trial, int target);
+		static void Release(SweepTrial& trial, bool keepModel);
+	};
+}
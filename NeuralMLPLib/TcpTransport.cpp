@@ -0,0 +1,211 @@
+//--------------------------------------------------
+// Implementation of class TcpTransport
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "TcpTransport.h"
+using namespace NVL_AI;
+
+// The milliseconds a worker waits between attempts to reach the hub while it is starting up
+#define CONNECT_RETRY 10
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor. The first worker listens on the address and the others connect to it; the call returns once
+ * the hub has heard from every worker.
+ * @param address The host:port that the first worker listens on
+ * @param rank The index of this worker
+ * @param size The number of workers in the job
+ * @param timeout The seconds to wait for the other workers to join before giving up
+ */
+TcpTransport::TcpTransport(const string& address, int rank, int size, double timeout) : Transport(rank, size), _timeout(timeout)
+{
+	auto split = address.rfind(':');
+	if (split == string::npos) throw runtime_error("A TCP address needs the form host:port, not " + address);
+	_host = address.substr(0, split); _port = address.substr(split + 1);
+
+	_sockets.assign(size, -1);
+	if (rank == 0) Listen(); else Connect();
+}
+
+/**
+ * @brief Main Terminator
+ */
+TcpTransport::~TcpTransport()
+{
+	for (auto socket : _sockets) if (socket >= 0) close(socket);
+}
+
+//--------------------------------------------------
+// Reduce
+//--------------------------------------------------
+
+/**
+ * @brief Combine a block of values across every worker. Each worker sends its values to the hub, which folds them
+ * into its own in rank order and sends the result back to everyone.
+ * @param values The values of this worker, which are replaced with the combined values
+ * @param count The number of values
+ * @param op The operation that combines them
+ */
+void TcpTransport::AllReduce(double * values, int count, ReduceOp op)
+{
+	auto bytes = (size_t) count * sizeof(double);
+
+	if (GetRank() != 0)
+	{
+		Send(_sockets[0], values, bytes);
+		Receive(_sockets[0], values, bytes, 0);
+		return;
+	}
+
+	_buffer.resize(count);
+	for (auto rank = 1; rank < GetSize(); rank++)
+	{
+		Receive(_sockets[rank], _buffer.data(), bytes, 0);
+		Reduce(values, _buffer.data(), count, op);
+	}
+
+	for (auto rank = 1; rank < GetSize(); rank++) Send(_sockets[rank], values, bytes);
+}
+
+//--------------------------------------------------
+// Connections
+//--------------------------------------------------
+
+/**
+ * @brief Accept a connection from every other worker (the first worker). Each worker introduces itself with its rank
+ * and is told the size of the job once everyone is in.
+ */
+void TcpTransport::Listen()
+{
+	addrinfo hints = {}; hints.ai_family = AF_UNSPEC; hints.ai_socktype = SOCK_STREAM; hints.ai_flags = AI_PASSIVE;
+	addrinfo * info = nullptr;
+	if (getaddrinfo(_host.empty() ? nullptr : _host.c_str(), _port.c_str(), &hints, &info) != 0) throw runtime_error("Unable to resolve " + _host + ":" + _port);
+
+	auto listener = socket(info->ai_family, info->ai_socktype, info->ai_protocol); auto reuse = 1;
+	setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+	auto bound = listener >= 0 && bind(listener, info->ai_addr, info->ai_addrlen) == 0 && listen(listener, GetSize()) == 0;
+	freeaddrinfo(info);
+	if (!bound) { if (listener >= 0) close(listener); throw runtime_error("Unable to listen on " + _host + ":" + _port); }
+
+	try
+	{
+		for (auto joined = 1; joined < GetSize(); joined++)
+		{
+			auto request = pollfd { listener, POLLIN, 0 };
+			if (poll(&request, 1, (int) (_timeout * 1000)) <= 0) throw runtime_error(NVLib::Formatter() << "Timed out waiting for the workers to connect (" << joined << " of " << GetSize() << ")");
+
+			auto connection = accept(listener, nullptr, nullptr);
+			if (connection < 0) throw runtime_error("Unable to accept a worker connection");
+			SetOptions(connection);
+
+			auto rank = 0; Receive(connection, &rank, sizeof(rank), _timeout);
+			if (rank <= 0 || rank >= GetSize() || _sockets[rank] >= 0) { close(connection); throw runtime_error(NVLib::Formatter() << "A worker joined with an invalid rank: " << rank); }
+			_sockets[rank] = connection;
+		}
+	}
+	catch (runtime_error&)
+	{
+		close(listener); throw;
+	}
+
+	close(listener);
+
+	auto size = GetSize();
+	for (auto rank = 1; rank < size; rank++) Send(_sockets[rank], &size, sizeof(size));
+}
+
+/**
+ * @brief Connect to the hub, retrying while it starts up (the other workers)
+ */
+void TcpTransport::Connect()
+{
+	auto start = chrono::steady_clock::now();
+
+	while (_sockets[0] < 0)
+	{
+		addrinfo hints = {}; hints.ai_family = AF_UNSPEC; hints.ai_socktype = SOCK_STREAM;
+		addrinfo * info = nullptr;
+
+		if (getaddrinfo(_host.c_str(), _port.c_str(), &hints, &info) == 0)
+		{
+			auto connection = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+			if (connection >= 0 && connect(connection, info->ai_addr, info->ai_addrlen) == 0) _sockets[0] = connection;
+			else if (connection >= 0) close(connection);
+			freeaddrinfo(info);
+		}
+
+		if (_sockets[0] >= 0) break;
+		if (chrono::duration<double>(chrono::steady_clock::now() - start).count() > _timeout) throw runtime_error("Timed out connecting to the first worker at " + _host + ":" + _port);
+		this_thread::sleep_for(chrono::milliseconds(CONNECT_RETRY));
+	}
+
+	SetOptions(_sockets[0]);
+
+	auto rank = GetRank(); Send(_sockets[0], &rank, sizeof(rank));
+	auto size = 0; Receive(_sockets[0], &size, sizeof(size), _timeout);
+	if (size != GetSize()) throw runtime_error(NVLib::Formatter() << "The first worker expects " << size << " workers, not " << GetSize());
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Send a block of bytes, all of them
+ * @param socket The socket that we are sending on
+ * @param data The bytes that we are sending
+ * @param bytes The number of bytes
+ */
+void TcpTransport::Send(int socket, const void * data, size_t bytes)
+{
+	auto position = (const char *) data;
+
+	while (bytes > 0)
+	{
+		auto sent = send(socket, position, bytes, MSG_NOSIGNAL);
+		if (sent < 0 && errno == EINTR) continue;
+		if (sent <= 0) throw runtime_error("Lost the connection to another worker");
+		position += sent; bytes -= sent;
+	}
+}
+
+/**
+ * @brief Receive a block of bytes, all of them. A worker that has died closes its connection, so a reduce can wait as
+ * long as the others take to train; the timeout is only needed while the job is starting up.
+ * @param socket The socket that we are receiving from
+ * @param data Where the bytes are written
+ * @param bytes The number of bytes
+ * @param timeout The seconds to wait for the sender (0 waits for as long as it takes)
+ */
+void TcpTransport::Receive(int socket, void * data, size_t bytes, double timeout)
+{
+	auto position = (char *) data;
+
+	while (bytes > 0)
+	{
+		auto request = pollfd { socket, POLLIN, 0 };
+		if (poll(&request, 1, timeout > 0 ? (int) (timeout * 1000) : -1) == 0) throw runtime_error("Timed out waiting for another worker");
+
+		auto received = recv(socket, position, bytes, 0);
+		if (received < 0 && errno == EINTR) continue;
+		if (received <= 0) throw runtime_error("Lost the connection to another worker");
+		position += received; bytes -= received;
+	}
+}
+
+/**
+ * @brief Send small messages straight away rather than waiting to fill a packet
+ * @param socket The socket that we are setting up
+ */
+void TcpTransport::SetOptions(int socket)
+{
+	auto flag = 1;
+	setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
@@ -0,0 +1,51 @@
+//--------------------------------------------------
+// A transport between worker processes over TCP, with the first worker as the hub that combines the values
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+#include <poll.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "Transport.h"
+
+namespace NVL_AI
+{
+	class TcpTransport : public Transport
+	{
+	private:
+		string _host;
+		string _port;
+		double _timeout;
+		vector<int> _sockets;
+		vector<double> _buffer;
+	public:
+		TcpTransport(const string& address, int rank, int size, double timeout = 60);
+		~TcpTransport();
+
+		void AllReduce(double * values, int count, ReduceOp op) override;
+		string GetName() override { return "tcp"; }
+	private:
+		void Listen();
+		void Connect();
+		void Send(int socket, const void * data, size_t bytes);
+		void Receive(int socket, void * data, size_t bytes, double timeout);
+		static void SetOptions(int socket);
+	};
+}
@@ -8,12 +8,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 using namespace std;
 
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "MappedFile.h"
+
 namespace NVL_AI
 {
 	class TrainData
@@ -21,12 +25,40 @@ namespace NVL_AI
 	private:
 		Mat _inputs;
 		Mat _outputs;
+		Ptr<MappedFile> _source;
+		vector<int> _rows;
+		uint64_t _id;
+		Mat _inputStats;
+		Mat _outputStats;
 
 	public:
 		TrainData(Mat& inputs, Mat& outputs) :
-			_inputs(inputs), _outputs(outputs) {}
+			_inputs(inputs), _outputs(outputs), _id(NextId()) {}
+
+		TrainData(Mat& inputs, Mat& outputs, Ptr<MappedFile> source) :
+			_inputs(inputs), _outputs(outputs), _source(source), _id(NextId()) {}
+
+		TrainData(TrainData * data, const vector<int>& rows) :
+			_inputs(data->_inputs), _outputs(data->_outputs), _source(data->_source), _rows(rows), _id(NextId()) {}
 
 		inline Mat& GetInputs() { return _inputs; }
 		inline Mat& GetOutputs() { return _outputs; }
+		inline Ptr<MappedFile>& GetSource() { return _source; }
+
+		// Every data set gets its own id, so a network can tell when it is handed new data (even at a reused address)
+		inline uint64_t GetId() { return _id; }
+
+		// A view shares the matrices of its data set and only lists the rows that belong to it (no rows are copied)
+		inline vector<int>& GetRows() { return _rows; }
+		inline bool IsView() { return !_rows.empty(); }
+		inline int GetRowCount() { return IsView() ? (int) _rows.size() : _inputs.rows; }
+
+		// Column statistics that were stored with the dataset (mean, deviation, minimum and maximum rows); a view has none of its own
+		inline void SetStats(const Mat& inputStats, const Mat& outputStats) { _inputStats = inputStats; _outputStats = outputStats; }
+		inline Mat& GetInputStats() { return _inputStats; }
+		inline Mat& GetOutputStats() { return _outputStats; }
+		inline bool HasStats() { return !IsView() && !_inputStats.empty() && !_outputStats.empty(); }
+	private:
+		static uint64_t NextId() { static atomic<uint64_t> next(1); return next++; }
 	};
 }
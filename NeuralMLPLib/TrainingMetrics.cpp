@@ -0,0 +1,167 @@
+//--------------------------------------------------
+// Implementation of class TrainingMetrics
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "TrainingMetrics.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The file that a line is written to for each iteration (".csv" gives CSV, anything else JSON lines; empty for none)
+ * @param prometheusPath The Prometheus text file that the running totals are exported to (empty for none)
+ * @param exportInterval The number of seconds between exports (the line file is flushed at the same time)
+ */
+TrainingMetrics::TrainingMetrics(const string& path, const string& prometheusPath, double exportInterval) :
+	_csv(false), _prometheusPath(prometheusPath), _exportInterval(exportInterval), _iterationCount(0), _trainSeconds(0), _scoreSeconds(0),
+	_checkpointSeconds(0), _sampleCount(0), _allocationCount(0), _allocatedBytes(0), _bestScore(0), _loadSeconds(0), _checkpointWrites(0), _checkpointWriteSeconds(0), _checkpointLastWriteSeconds(0)
+{
+	_start = _lastExport = chrono::steady_clock::now();
+	if (path.empty()) return;
+
+	_writer.open(path);
+	if (!_writer.is_open()) throw runtime_error("Unable to open the metrics file: " + path);
+
+	_csv = path.size() >= 4 && path.substr(path.size() - 4) == ".csv";
+	if (_csv) _writer << "iteration,elapsed_seconds,train_seconds,score_seconds,checkpoint_seconds,samples_per_second,score,peak_rss_bytes,checkpoint_write_seconds,allocations,allocated_bytes\n";
+}
+
+/**
+ * @brief Main Terminator, makes sure that the last iterations are written out
+ */
+TrainingMetrics::~TrainingMetrics()
+{
+	try { Export(); } catch (...) {}
+}
+
+//--------------------------------------------------
+// Setters
+//--------------------------------------------------
+
+/**
+ * @brief Set the time that was taken to load the training data
+ * @param seconds The load time
+ */
+void TrainingMetrics::SetLoadSeconds(double seconds)
+{
+	_loadSeconds = seconds;
+}
+
+/**
+ * @brief Set the checkpoint write statistics (the writes happen on a background thread, so they are read from its counters)
+ * @param writeCount The number of checkpoints written
+ * @param lastWriteSeconds The time taken by the last write
+ * @param writeSeconds The total time spent writing
+ */
+void TrainingMetrics::SetCheckpointStats(int writeCount, double lastWriteSeconds, double writeSeconds)
+{
+	_checkpointWrites = writeCount; _checkpointLastWriteSeconds = lastWriteSeconds; _checkpointWriteSeconds = writeSeconds;
+}
+
+//--------------------------------------------------
+// Record
+//--------------------------------------------------
+
+/**
+ * @brief Record an iteration. This is a handful of additions and one buffered line, and the exports only happen
+ * every few seconds, so that the cost per iteration stays negligible.
+ * @param metrics The metrics of the iteration
+ */
+void TrainingMetrics::Record(const IterationMetrics& metrics)
+{
+	auto now = chrono::steady_clock::now();
+
+	_bestScore = _iterationCount == 0 ? metrics.Score : min(_bestScore, metrics.Score);
+	_last = metrics; _iterationCount++;
+	_trainSeconds += metrics.TrainSeconds; _scoreSeconds += metrics.ScoreSeconds; _checkpointSeconds += metrics.CheckpointSeconds;
+	_sampleCount += metrics.Samples; _allocationCount += metrics.Allocations; _allocatedBytes += metrics.AllocatedBytes;
+
+	if (_writer.is_open())
+	{
+		auto elapsed = chrono::duration<double>(now - _start).count();
+		auto samplesPerSecond = metrics.TrainSeconds > 0 ? metrics.Samples / metrics.TrainSeconds : 0.0;
+
+		if (_csv) _writer << metrics.Iteration << "," << elapsed << "," << metrics.TrainSeconds << "," << metrics.ScoreSeconds << "," << metrics.CheckpointSeconds << "," << samplesPerSecond << "," << metrics.Score << "," << GetPeakMemory() << "," << _checkpointLastWriteSeconds << "," << metrics.Allocations << "," << metrics.AllocatedBytes << "\n";
+		else _writer << "{\"iteration\":" << metrics.Iteration << ",\"elapsed_seconds\":" << elapsed << ",\"train_seconds\":" << metrics.TrainSeconds << ",\"score_seconds\":" << metrics.ScoreSeconds << ",\"checkpoint_seconds\":" << metrics.CheckpointSeconds << ",\"samples_per_second\":" << samplesPerSecond << ",\"score\":" << metrics.Score << ",\"peak_rss_bytes\":" << GetPeakMemory() << ",\"checkpoint_write_seconds\":" << _checkpointLastWriteSeconds << ",\"allocations\":" << metrics.Allocations << ",\"allocated_bytes\":" << metrics.AllocatedBytes << "}\n";
+	}
+
+	if (chrono::duration<double>(now - _lastExport).count() >= _exportInterval) Export();
+}
+
+//--------------------------------------------------
+// Export
+//--------------------------------------------------
+
+/**
+ * @brief Flush the line file and write the running totals to the Prometheus text file. The file is written to a
+ * temporary path and renamed into place, so that a scraper never reads half of it.
+ */
+void TrainingMetrics::Export()
+{
+	_lastExport = chrono::steady_clock::now();
+	if (_writer.is_open()) _writer.flush();
+	if (_prometheusPath.empty()) return;
+
+	auto tempPath = _prometheusPath + ".tmp";
+	auto writer = ofstream(tempPath);
+	if (!writer.is_open()) throw runtime_error("Unable to write the Prometheus metrics file: " + tempPath);
+
+	auto samplesPerSecond = _trainSeconds > 0 ? _sampleCount / _trainSeconds : 0.0;
+
+	writer << "# HELP neuralmlp_iterations_total Training iterations completed\n# TYPE neuralmlp_iterations_total counter\n";
+	writer << "neuralmlp_iterations_total " << _iterationCount << "\n";
+	writer << "# HELP neuralmlp_phase_seconds_total Wall time spent in each phase of training\n# TYPE neuralmlp_phase_seconds_total counter\n";
+	writer << "neuralmlp_phase_seconds_total{phase=\"load\"} " << _loadSeconds << "\n";
+	writer << "neuralmlp_phase_seconds_total{phase=\"train\"} " << _trainSeconds << "\n";
+	writer << "neuralmlp_phase_seconds_total{phase=\"score\"} " << _scoreSeconds << "\n";
+	writer << "neuralmlp_phase_seconds_total{phase=\"checkpoint\"} " << _checkpointSeconds << "\n";
+	writer << "# HELP neuralmlp_iteration_seconds Wall time of each phase of the last iteration\n# TYPE neuralmlp_iteration_seconds gauge\n";
+	writer << "neuralmlp_iteration_seconds{phase=\"train\"} " << _last.TrainSeconds << "\n";
+	writer << "neuralmlp_iteration_seconds{phase=\"score\"} " << _last.ScoreSeconds << "\n";
+	writer << "neuralmlp_iteration_seconds{phase=\"checkpoint\"} " << _last.CheckpointSeconds << "\n";
+	writer << "# HELP neuralmlp_samples_per_second Training samples processed per second of training time\n# TYPE neuralmlp_samples_per_second gauge\n";
+	writer << "neuralmlp_samples_per_second " << samplesPerSecond << "\n";
+	writer << "# HELP neuralmlp_score The score of the last iteration\n# TYPE neuralmlp_score gauge\n";
+	writer << "neuralmlp_score " << _last.Score << "\n";
+	writer << "# HELP neuralmlp_best_score The best score so far\n# TYPE neuralmlp_best_score gauge\n";
+	writer << "neuralmlp_best_score " << _bestScore << "\n";
+	writer << "# HELP neuralmlp_peak_rss_bytes Peak resident memory of the process\n# TYPE neuralmlp_peak_rss_bytes gauge\n";
+	writer << "neuralmlp_peak_rss_bytes " << GetPeakMemory() << "\n";
+	writer << "# HELP neuralmlp_checkpoint_writes_total Checkpoints written to disk\n# TYPE neuralmlp_checkpoint_writes_total counter\n";
+	writer << "neuralmlp_checkpoint_writes_total " << _checkpointWrites << "\n";
+	writer << "# HELP neuralmlp_checkpoint_write_seconds_total Time spent writing checkpoints (on the background writer)\n# TYPE neuralmlp_checkpoint_write_seconds_total counter\n";
+	writer << "neuralmlp_checkpoint_write_seconds_total " << _checkpointWriteSeconds << "\n";
+	writer << "# HELP neuralmlp_checkpoint_last_write_seconds Time taken by the last checkpoint write\n# TYPE neuralmlp_checkpoint_last_write_seconds gauge\n";
+	writer << "neuralmlp_checkpoint_last_write_seconds " << _checkpointLastWriteSeconds << "\n";
+	writer << "# HELP neuralmlp_allocations_total Heap allocations made while training and scoring\n# TYPE neuralmlp_allocations_total counter\n";
+	writer << "neuralmlp_allocations_total " << _allocationCount << "\n";
+	writer << "# HELP neuralmlp_allocated_bytes_total Bytes allocated on the heap while training and scoring\n# TYPE neuralmlp_allocated_bytes_total counter\n";
+	writer << "neuralmlp_allocated_bytes_total " << _allocatedBytes << "\n";
+	writer << "# HELP neuralmlp_iteration_allocations Heap allocations made while training and scoring the last iteration\n# TYPE neuralmlp_iteration_allocations gauge\n";
+	writer << "neuralmlp_iteration_allocations " << _last.Allocations << "\n";
+	writer.close();
+
+	if (rename(tempPath.c_str(), _prometheusPath.c_str()) != 0) throw runtime_error("Unable to move the Prometheus metrics file into place: " + _prometheusPath);
+}
+
+//--------------------------------------------------
+// Memory
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the peak resident memory of the process
+ * @return long The peak in bytes
+ */
+long TrainingMetrics::GetPeakMemory()
+{
+	auto usage = rusage();
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+	return usage.ru_maxrss * 1024L;
+}
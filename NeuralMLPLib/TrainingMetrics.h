@@ -0,0 +1,73 @@
+//--------------------------------------------------
+// Records the timing of each training iteration, writing it out as JSON lines (or CSV) and a Prometheus text file
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sys/resource.h>
+using namespace std;
+
+#include <NVLib/Formatter.h>
+
+namespace NVL_AI
+{
+	struct IterationMetrics
+	{
+		int Iteration = 0;
+		double TrainSeconds = 0;
+		double ScoreSeconds = 0;
+		double CheckpointSeconds = 0;
+		long Samples = 0;
+		double Score = 0;
+		long Allocations = 0;
+		long AllocatedBytes = 0;
+	};
+
+	class TrainingMetrics
+	{
+	private:
+		ofstream _writer;
+		bool _csv;
+		string _prometheusPath;
+		double _exportInterval;
+		chrono::steady_clock::time_point _start;
+		chrono::steady_clock::time_point _lastExport;
+
+		IterationMetrics _last;
+		int _iterationCount;
+		double _trainSeconds;
+		double _scoreSeconds;
+		double _checkpointSeconds;
+		long _sampleCount;
+		long _allocationCount;
+		long _allocatedBytes;
+		double _bestScore;
+		double _loadSeconds;
+		int _checkpointWrites;
+		double _checkpointWriteSeconds;
+		double _checkpointLastWriteSeconds;
+	public:
+		TrainingMetrics(const string& path, const string& prometheusPath, double exportInterval = 5);
+		~TrainingMetrics();
+
+		void SetLoadSeconds(double seconds);
+		void SetCheckpointStats(int writeCount, double lastWriteSeconds, double writeSeconds);
+		void Record(const IterationMetrics& metrics);
+		void Export();
+
+		inline int GetIterationCount() { return _iterationCount; }
+		inline double GetTrainSeconds() { return _trainSeconds; }
+		inline double GetScoreSeconds() { return _scoreSeconds; }
+		inline double GetCheckpointSeconds() { return _checkpointSeconds; }
+
+		static long GetPeakMemory();
+	};
+}
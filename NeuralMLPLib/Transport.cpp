@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// Implementation of class Transport
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Transport.h"
+#include "TcpTransport.h"
+#include "SharedMemoryTransport.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param rank The index of this worker
+ * @param size The number of workers in the job
+ */
+Transport::Transport(int rank, int size) : _rank(rank), _size(size)
+{
+	if (size < 1 || rank < 0 || rank >= size) throw runtime_error(NVLib::Formatter() << "Invalid worker rank " << rank << " of " << size);
+}
+
+//--------------------------------------------------
+// Create
+//--------------------------------------------------
+
+/**
+ * @brief Join a distributed job. The call returns once every worker has joined.
+ * @param type The type of transport ("shm" for POSIX shared memory between the processes of one machine, or "tcp")
+ * @param address The shared memory name, or the host:port that the first worker listens on
+ * @param rank The index of this worker
+ * @param size The number of workers in the job
+ * @param timeout The seconds to wait for the other workers to join before giving up
+ * @param job The id that every worker of the job shares (shared memory only refuses a segment made for another job)
+ * @return Ptr<Transport> The resultant transport
+ */
+Ptr<Transport> Transport::Create(const string& type, const string& address, int rank, int size, double timeout, uint64_t job)
+{
+	if (type == "shm") return Ptr<Transport>(new SharedMemoryTransport(address, rank, size, timeout, job));
+	if (type == "tcp") return Ptr<Transport>(new TcpTransport(address, rank, size, timeout));
+
+	throw runtime_error(NVLib::Formatter() << "Unknown transport: " << type);
+}
+
+//--------------------------------------------------
+// Reduce
+//--------------------------------------------------
+
+/**
+ * @brief Combine a block of values into a running result. Each transport applies the workers' blocks in rank order,
+ * so every worker ends up with the same bits.
+ * @param target The running result
+ * @param source The values that are combined into it
+ * @param count The number of values
+ * @param op The operation that combines them
+ */
+void Transport::Reduce(double * target, const double * source, int count, ReduceOp op)
+{
+	if (op == ReduceOp::Sum) for (auto i = 0; i < count; i++) target[i] += source[i];
+	else if (op == ReduceOp::Min) for (auto i = 0; i < count; i++) target[i] = min(target[i], source[i]);
+	else for (auto i = 0; i < count; i++) target[i] = max(target[i], source[i]);
+}
@@ -0,0 +1,42 @@
+//--------------------------------------------------
+// The link between the worker processes of a distributed training job, which combines a block of values across all of them
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/Formatter.h>
+
+namespace NVL_AI
+{
+	enum class ReduceOp { Sum, Min, Max };
+
+	class Transport
+	{
+	private:
+		int _rank;
+		int _size;
+	public:
+		Transport(int rank, int size);
+		virtual ~Transport() {}
+
+		virtual void AllReduce(double * values, int count, ReduceOp op) = 0;
+		virtual string GetName() = 0;
+
+		inline int GetRank() { return _rank; }
+		inline int GetSize() { return _size; }
+
+		static Ptr<Transport> Create(const string& type, const string& address, int rank, int size, double timeout = 60, uint64_t job = 0);
+		static void Reduce(double * target, const double * source, int count, ReduceOp op);
+	};
+}
@@ -0,0 +1,143 @@
+//--------------------------------------------------
+// Implementation of class WorkPool
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "WorkPool.h"
+using namespace NVL_AI;
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor, starts the workers (each with its own queue)
+ * @param threadCount The number of worker threads (0 uses every core)
+ */
+WorkPool::WorkPool(int threadCount) : _queued(0), _pending(0), _next(0), _stopping(false), _stealCount(0)
+{
+	auto count = ParallelUtils::GetThreadCount(threadCount);
+
+	for (auto i = 0; i < count; i++) _queues.push_back(unique_ptr<WorkQueue>(new WorkQueue()));
+	for (auto i = 0; i < count; i++) _workers.push_back(thread(&WorkPool::Run, this, i));
+}
+
+/**
+ * @brief Main Terminator, finishes the queued tasks and stops the workers
+ */
+WorkPool::~WorkPool()
+{
+	{
+		unique_lock<mutex> guard(_lock);
+		_changed.wait(guard, [this]() { return _pending == 0; });
+		_stopping = true;
+	}
+
+	_changed.notify_all();
+	for (auto& worker : _workers) worker.join();
+}
+
+//--------------------------------------------------
+// Submit and Wait
+//--------------------------------------------------
+
+/**
+ * @brief Add a task to the pool. Tasks are dealt out to the worker queues in turn, and a worker that runs out
+ * of work takes tasks from the far end of the other queues.
+ * @param task The task that is being added
+ */
+void WorkPool::Submit(const function<void()>& task)
+{
+	{
+		lock_guard<mutex> guard(_lock);
+		auto& queue = *_queues[_next]; _next = (_next + 1) % (int) _queues.size();
+
+		lock_guard<mutex> queueGuard(queue.Lock);
+		queue.Tasks.push_back(task);
+		_queued++; _pending++;
+	}
+
+	_changed.notify_all();
+}
+
+/**
+ * @brief Wait until every submitted task has finished, re-throwing the first failure
+ */
+void WorkPool::Wait()
+{
+	unique_lock<mutex> guard(_lock);
+	_changed.wait(guard, [this]() { return _pending == 0; });
+
+	if (_error != nullptr)
+	{
+		auto error = _error; _error = nullptr;
+		rethrow_exception(error);
+	}
+}
+
+//--------------------------------------------------
+// Workers
+//--------------------------------------------------
+
+/**
+ * @brief The loop of a worker thread
+ * @param index The index of the worker (and its queue)
+ */
+void WorkPool::Run(int index)
+{
+	while (true)
+	{
+		{
+			unique_lock<mutex> guard(_lock);
+			_changed.wait(guard, [this]() { return _queued > 0 || _stopping; });
+			if (_queued == 0 && _stopping) return;
+		}
+
+		function<void()> task;
+		if (!TryTake(index, task)) continue;
+
+		exception_ptr error;
+		try { task(); } catch (...) { error = current_exception(); }
+
+		{
+			lock_guard<mutex> guard(_lock);
+			if (error != nullptr && _error == nullptr) _error = error;
+			_pending--;
+		}
+
+		_changed.notify_all();
+	}
+}
+
+/**
+ * @brief Take a task, working from the back of the worker's own queue and then stealing from the front of the others
+ * @param index The index of the worker
+ * @param task The task that was taken
+ * @return bool True if a task was found
+ */
+bool WorkPool::TryTake(int index, function<void()>& task)
+{
+	auto count = (int) _queues.size();
+
+	for (auto offset = 0; offset < count; offset++)
+	{
+		auto& queue = *_queues[(index + offset) % count];
+
+		{
+			lock_guard<mutex> queueGuard(queue.Lock);
+			if (queue.Tasks.empty()) continue;
+
+			if (offset == 0) { task = move(queue.Tasks.back()); queue.Tasks.pop_back(); }
+			else { task = move(queue.Tasks.front()); queue.Tasks.pop_front(); _stealCount++; }
+		}
+
+		lock_guard<mutex> guard(_lock);
+		_queued--;
+		return true;
+	}
+
+	return false;
+}
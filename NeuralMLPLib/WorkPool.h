@@ -0,0 +1,61 @@
+//--------------------------------------------------
+// A fixed set of worker threads that share out tasks by work stealing
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <iostream>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+using namespace std;
+
+#include "ParallelUtils.h"
+
+namespace NVL_AI
+{
+	struct WorkQueue
+	{
+		mutex Lock;
+		deque<function<void()>> Tasks;
+	};
+
+	class WorkPool
+	{
+	private:
+		vector<unique_ptr<WorkQueue>> _queues;
+		vector<thread> _workers;
+		mutex _lock;
+		condition_variable _changed;
+		int _queued;
+		int _pending;
+		int _next;
+		bool _stopping;
+		exception_ptr _error;
+		atomic<int> _stealCount;
+	public:
+		WorkPool(int threadCount = 0);
+		~WorkPool();
+
+		WorkPool(const WorkPool&) = delete;
+		WorkPool& operator=(const WorkPool&) = delete;
+
+		void Submit(const function<void()>& task);
+		void Wait();
+
+		inline int GetThreadCount() { return (int) _workers.size(); }
+		inline int GetStealCount() { return _stealCount; }
+	private:
+		void Run(int index);
+		bool TryTake(int index, function<void()>& task);
+	};
+}
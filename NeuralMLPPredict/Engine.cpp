@@ -0,0 +1,123 @@
+//--------------------------------------------------
+// Implementation code for the prediction Engine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include "Engine.h"
+using namespace NVL_App;
+
+// The number of times the float and INT8 networks are timed over the calibration data (the fastest run is kept)
+#define TIMING_RUNS 5
+
+//--------------------------------------------------
+// Constructor and Terminator
+//--------------------------------------------------
+
+/**
+ * Main Constructor
+ * @param logger The logger that we are using for the system
+ * @param parameters The input parameters
+ */
+Engine::Engine(NVLib::Logger* logger, NVLib::Parameters* parameters) 
+{
+    _logger = logger; _parameters = parameters;
+
+    _logger->Log(1, "Loading the model");
+    auto modelPath = ArgUtils::GetString(parameters, "model");
+    auto backend = ArgUtils::GetString(parameters, "backend", "native");
+    auto threads = ArgUtils::GetInteger(parameters, "threads", 0);
+    if (backend == "opencv" && threads > 0) cv::setNumThreads(threads);
+    auto network = NVL_AI::NetworkFactory::Load(backend, modelPath, threads);
+    if (backend == "native") _logger->Log(1, "Using the native backend (%s kernels)", NVL_AI::MathKernels::GetInstructionSet().c_str());
+
+    auto quantize = ArgUtils::GetString(parameters, "quantize", "none");
+    if (quantize != "none") network = Quantize(network, modelPath, quantize, threads);
+
+    auto batchSize = ArgUtils::GetInteger(parameters, "batch_size", 65536);
+    _predictor = Ptr<NVL_AI::BatchPredictor>(new NVL_AI::BatchPredictor(network, batchSize, threads));
+    _inputPath = ArgUtils::GetString(parameters, "input");
+    _outputPath = ArgUtils::GetString(parameters, "output");
+}
+
+/**
+ * Main Terminator 
+ */
+Engine::~Engine() 
+{
+    delete _parameters; 
+}
+
+//--------------------------------------------------
+// Execution Entry Point
+//--------------------------------------------------
+
+/**
+ * Entry point function
+ */
+void Engine::Run()
+{
+    _logger->Log(1, "Predicting %s in batches of %i rows", _inputPath.c_str(), _predictor->GetBatchSize());
+    auto stats = _predictor->Run(_inputPath, _outputPath);
+
+    _logger->Log(1, "Predicted %i rows in %i batches in %f seconds (%f rows/sec)", stats.Rows, stats.Batches, stats.Seconds, stats.RowsPerSecond);
+    _logger->Log(1, "Batch latency (ms): p50 %f, p90 %f, p99 %f, max %f", stats.LatencyP50, stats.LatencyP90, stats.LatencyP99, stats.LatencyMax);
+    _logger->Log(1, "Predictions written to %s", _outputPath.c_str());
+}
+
+//--------------------------------------------------
+// Quantization
+//--------------------------------------------------
+
+/**
+ * Quantize the model to INT8, reporting how the score and the prediction time change against the float network
+ * over the calibration data, so that the choice to ship the quantized model can be made per model
+ * @param network The float network
+ * @param modelPath The path to the model
+ * @param granularity The granularity of the weight scales ("channel" or "layer")
+ * @param threads The number of prediction threads
+ * @return The quantized network
+ */
+Ptr<NVL_AI::Network> Engine::Quantize(Ptr<NVL_AI::Network>& network, const string& modelPath, const string& granularity, int threads)
+{
+    auto calibrationPath = ArgUtils::GetString(_parameters, "calibration");
+    auto sampleRows = ArgUtils::GetInteger(_parameters, "calibration_rows", 4096);
+
+    _logger->Log(1, "Quantizing the model to INT8 (per-%s scales, %s kernels), calibrated on %s", granularity.c_str(), NVL_AI::MathKernels::GetInt8InstructionSet().c_str(), calibrationPath.c_str());
+    auto data = Ptr<NVL_AI::TrainData>(NVL_AI::NeuralUtils::LoadData(calibrationPath));
+    auto result = Ptr<NVL_AI::Network>(new NVL_AI::QuantizedNetwork(NVL_AI::NeuralUtils::LoadModel(modelPath), data.get(), granularity, sampleRows, threads));
+
+    auto floatScore = NVL_AI::NeuralUtils::GetScore(data.get(), network);
+    auto quantizedScore = NVL_AI::NeuralUtils::GetScore(data.get(), result);
+    auto change = floatScore > 0 ? 100.0 * (quantizedScore - floatScore) / floatScore : 0.0;
+    _logger->Log(1, "Score (sum of absolute errors): float %f, INT8 %f (delta %f, %f%%)", floatScore, quantizedScore, quantizedScore - floatScore, change);
+
+    auto floatTime = GetPredictTime(network, data->GetInputs());
+    auto quantizedTime = GetPredictTime(result, data->GetInputs());
+    _logger->Log(1, "Prediction over %i rows: float %f ms, INT8 %f ms (%fx speedup)", data->GetInputs().rows, floatTime, quantizedTime, quantizedTime > 0 ? floatTime / quantizedTime : 0.0);
+
+    return result;
+}
+
+/**
+ * Time a network over a block of inputs
+ * @param network The network that we are timing
+ * @param inputs The inputs
+ * @return The fastest of the runs (in milliseconds)
+ */
+double Engine::GetPredictTime(Ptr<NVL_AI::Network>& network, const Mat& inputs)
+{
+    auto result = 0.0; Mat outputs;
+
+    for (auto run = 0; run < TIMING_RUNS; run++)
+    {
+        auto start = chrono::steady_clock::now();
+        network->Predict(inputs, outputs);
+        auto elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        result = run == 0 ? elapsed : min(result, elapsed);
+    }
+
+    return result;
+}
@@ -0,0 +1,43 @@
+//--------------------------------------------------
+// Defines the engine that streams a dataset through a saved model
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+using namespace std;
+
+#include <NVLib/Logger.h>
+
+#include <NeuralMLPLib/ArgUtils.h>
+#include <NeuralMLPLib/MathKernels.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/BatchPredictor.h>
+#include <NeuralMLPLib/QuantizedNetwork.h>
+
+namespace NVL_App
+{
+	class Engine
+	{
+	private:
+		NVLib::Parameters * _parameters;
+		NVLib::Logger* _logger;
+
+		Ptr<NVL_AI::BatchPredictor> _predictor;
+		string _inputPath;
+		string _outputPath;
+	public:
+		Engine(NVLib::Logger* logger, NVLib::Parameters * parameters);
+		~Engine();
+
+		void Run();
+	private:
+		Ptr<NVL_AI::Network> Quantize(Ptr<NVL_AI::Network>& network, const string& modelPath, const string& granularity, int threads);
+		static double GetPredictTime(Ptr<NVL_AI::Network>& network, const Mat& inputs);
+	};
+}
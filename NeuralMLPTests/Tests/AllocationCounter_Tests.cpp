@@ -0,0 +1,89 @@
+//--------------------------------------------------
+// Unit Tests for AllocationCounter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/Scorer.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/AllocationCounter.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateAllocationData(int rows);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that heap allocations are counted along with their size
+ */
+TEST(AllocationCounter_Test, counts_allocations)
+{
+	// Setup
+	auto start = NVL_AI::AllocationCounter::GetStats();
+
+	// Execute
+	auto values = vector<double>(1000, 1.0);
+	auto change = NVL_AI::AllocationCounter::GetChange(start);
+
+	// Confirm
+	ASSERT_EQ(values.back(), 1.0);
+	ASSERT_GE(change.Count, 1); ASSERT_GE(change.Bytes, (long) (1000 * sizeof(double)));
+}
+
+/**
+ * @brief Confirm that once the first iterations have sized the buffers, training and scoring on several threads
+ * make no heap allocations at all
+ */
+TEST(AllocationCounter_Test, training_loop_is_allocation_free)
+{
+	// Setup a native network that trains and scores across threads, as the engine sets it up
+	auto data = CreateAllocationData(300);
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "native"; settings.Structure = "8,8"; settings.LearnRate = 0.01; settings.Epochs = 3;
+	settings.Optimizer = "adam"; settings.BatchSize = 8; settings.TrainThreads = 2;
+	auto network = NVL_AI::NetworkFactory::Create(settings, 2, 1);
+	auto scorer = NVL_AI::Scorer(data, 2);
+
+	network->Train(data, false);
+	for (auto i = 0; i < 2; i++) { network->Train(data, true); scorer.Evaluate(network); }
+
+	// Execute
+	auto start = NVL_AI::AllocationCounter::GetStats();
+	for (auto i = 0; i < 5; i++) { network->Train(data, true); scorer.Evaluate(network); }
+	auto change = NVL_AI::AllocationCounter::GetChange(start);
+
+	// Confirm
+	ASSERT_EQ(change.Count, 0); ASSERT_EQ(change.Bytes, 0);
+
+	// Free working variables
+	delete data;
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a small dataset with a smooth relationship between two inputs and the output
+ * @param rows The number of rows
+ * @return NVL_AI::TrainData * The resultant dataset
+ */
+NVL_AI::TrainData * CreateAllocationData(int rows)
+{
+	Mat inputs = Mat_<float>(rows, 2); Mat outputs = Mat_<float>(rows, 1);
+	for (auto row = 0; row < rows; row++)
+	{
+		auto x = (float) (row % 17) / 17.0f; auto y = (float) (row % 11) / 11.0f;
+		inputs.at<float>(row, 0) = x; inputs.at<float>(row, 1) = y; outputs.at<float>(row) = x * 2 - y;
+	}
+	return new NVL_AI::TrainData(inputs, outputs);
+}
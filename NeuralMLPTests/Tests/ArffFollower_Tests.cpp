@@ -0,0 +1,118 @@
+//--------------------------------------------------
+// Unit Tests for ArffFollower
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <sstream>
+#include <fstream>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <NVLib/Formatter.h>
+
+#include <NeuralMLPLib/ArffFollower.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+void AppendText(const string& path, const string& text, bool create = false);
+string GetFollowHeader(int fieldCount);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that only the rows appended after the start are read, and that a half written row waits for its line to end
+ */
+TEST(ArffFollower_Test, follows_appended_rows)
+{
+	// Setup
+	AppendText("follow.arff", GetFollowHeader(2) + "1,1,1\n2,2,2\n", true);
+	auto follower = NVL_AI::ArffFollower("follow.arff", 2, 2);
+	Mat inputs = Mat_<float>(4, 2); Mat outputs = Mat_<float>(4, 1);
+
+	// Execute
+	auto first = follower.Poll(0);
+	AppendText("follow.arff", "3,4,5\n6,7");
+	auto second = follower.Poll(0);
+	AppendText("follow.arff", ",8\nbad,row,9\n");
+	auto third = follower.Poll(0);
+	auto rows = follower.Take(inputs, outputs);
+
+	// Confirm
+	ASSERT_FALSE(follower.IsStream());
+	ASSERT_EQ(first, 0); ASSERT_EQ(second, 1); ASSERT_EQ(third, 1);
+	ASSERT_EQ(rows, 2); ASSERT_EQ(follower.GetPendingRows(), 0); ASSERT_EQ(follower.GetBadCount(), 1);
+	ASSERT_EQ(inputs.at<float>(0, 0), 3.0f); ASSERT_EQ(inputs.at<float>(0, 1), 4.0f); ASSERT_EQ(outputs.at<float>(0), 5.0f);
+	ASSERT_EQ(inputs.at<float>(1, 0), 6.0f); ASSERT_EQ(inputs.at<float>(1, 1), 7.0f); ASSERT_EQ(outputs.at<float>(1), 8.0f);
+}
+
+/**
+ * @brief Confirm that a pipe is read until it closes, including a last row with no line feed
+ */
+TEST(ArffFollower_Test, reads_a_pipe)
+{
+	// Setup
+	int ends[2]; ASSERT_EQ(pipe(ends), 0);
+	auto follower = NVL_AI::ArffFollower(NVLib::Formatter() << "/dev/fd/" << ends[0], 1);
+	auto text = GetFollowHeader(1) + "1,2\n3,4\n5,6";
+	ASSERT_EQ(write(ends[1], text.c_str(), text.size()), (ssize_t) text.size()); close(ends[1]);
+
+	// Execute
+	auto rows = 0;
+	for (auto i = 0; i < 10 && !follower.IsClosed(); i++) rows += follower.Poll(100);
+
+	Mat inputs = Mat_<float>(3, 1); Mat outputs = Mat_<float>(3, 1);
+	follower.Take(inputs, outputs); close(ends[0]);
+
+	// Confirm
+	ASSERT_TRUE(follower.IsStream()); ASSERT_TRUE(follower.IsClosed());
+	ASSERT_EQ(rows, 3);
+	ASSERT_EQ(inputs.at<float>(2), 5.0f); ASSERT_EQ(outputs.at<float>(2), 6.0f);
+}
+
+/**
+ * @brief Confirm that a source with a different number of inputs is rejected
+ */
+TEST(ArffFollower_Test, rejects_other_inputs)
+{
+	AppendText("follow.arff", GetFollowHeader(3) + "1,2,3,4\n", true);
+	auto follower = NVL_AI::ArffFollower("follow.arff", 2);
+	ASSERT_THROW(follower.Poll(0), runtime_error);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Add text to the end of a file
+ * @param path The path to the file
+ * @param text The text that is added
+ * @param create Start the file again rather than adding to it
+ */
+void AppendText(const string& path, const string& text, bool create)
+{
+	auto writer = ofstream(path, create ? ios::trunc : ios::app);
+	writer << text;
+}
+
+/**
+ * @brief Build the header of a small ARFF file
+ * @param fieldCount The number of inputs
+ * @return string The resultant header
+ */
+string GetFollowHeader(int fieldCount)
+{
+	auto result = stringstream(); result << "@RELATION follow\n\n";
+	for (auto i = 0; i < fieldCount; i++) result << "@ATTRIBUTE p[" << i << "] NUMERIC\n";
+	result << "@ATTRIBUTE class NUMERIC\n\n@DATA\n";
+	return result.str();
+}
@@ -0,0 +1,171 @@
+//--------------------------------------------------
+// Unit Tests for ArffReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+#include <NVLib/StringUtils.h>
+
+#include <NeuralMLPLib/ArffReader.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+void LoadReference(const string& path, Mat& inputs, Mat& outputs);
+void CompareWithReference(const string& path, int threadCount);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the problem dataset matches the line-by-line reader
+ */
+TEST(ArffReader_Test, problem_matches_reference)
+{
+	CompareWithReference(string(RESOURCE_FOLDER) + "/Input/problem.arff", 1);
+}
+
+/**
+ * @brief Confirm that the feature dataset matches the line-by-line reader
+ */
+TEST(ArffReader_Test, data_matches_reference)
+{
+	CompareWithReference(string(RESOURCE_FOLDER) + "/Input/data.arff", 1);
+}
+
+/**
+ * @brief Confirm that parsing in parallel chunks gives the same rows in the same order
+ */
+TEST(ArffReader_Test, parallel_matches_reference)
+{
+	CompareWithReference(string(RESOURCE_FOLDER) + "/Input/data.arff", 4);
+}
+
+/**
+ * @brief Confirm that reading in batches gives the same rows as reading the whole file
+ */
+TEST(ArffReader_Test, batches_match_read)
+{
+	// Setup
+	auto path = string(RESOURCE_FOLDER) + "/Input/data.arff";
+	auto expected = NVL_AI::ArffReader(path).Read();
+
+	// Execute
+	auto reader = NVL_AI::ArffReader(path, 4); reader.Open();
+	Mat inputs = Mat_<float>(1000, (int)reader.GetFieldNames().size()); Mat outputs = Mat_<float>(1000, 1);
+
+	auto total = 0;
+	for (auto rows = reader.ReadBatch(inputs, outputs); rows > 0; rows = reader.ReadBatch(inputs, outputs))
+	{
+		// Confirm
+		for (auto row = 0; row < rows; row++)
+		{
+			for (auto column = 0; column < inputs.cols; column++) ASSERT_EQ(inputs.at<float>(row, column), expected->GetInputs().at<float>(total + row, column));
+			ASSERT_EQ(outputs.at<float>(row, 0), expected->GetOutputs().at<float>(total + row, 0));
+		}
+		total += rows;
+	}
+
+	ASSERT_EQ(total, expected->GetInputs().rows);
+	ASSERT_TRUE(reader.IsFinished());
+
+	// Teardown
+	delete expected;
+}
+
+/**
+ * @brief Confirm that records with the wrong number of fields are rejected
+ */
+TEST(ArffReader_Test, bad_record_rejected)
+{
+	// Create a file with a short record
+	if (NVLib::FileUtils::Exists("bad.arff")) NVLib::FileUtils::Remove("bad.arff");
+	auto writer = ofstream("bad.arff");
+	writer << "@ATTRIBUTE p[0] REAL" << endl << "@ATTRIBUTE class REAL" << endl << endl;
+	writer << "@DATA" << endl << "1,2" << endl << "3" << endl;
+	writer.close();
+
+	// Confirm that the reader fails and points at the bad line
+	try
+	{
+		NVL_AI::ArffReader("bad.arff").Read();
+		FAIL() << "Expected the bad record to be rejected";
+	}
+	catch (runtime_error& exception)
+	{
+		ASSERT_NE(string(exception.what()).find("line 6"), string::npos);
+	}
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Load the given file with a straightforward line-by-line parser
+ * @param path The path to the file that we are loading
+ * @param inputs The inputs that were loaded
+ * @param outputs The outputs that were loaded
+ */
+void LoadReference(const string& path, Mat& inputs, Mat& outputs)
+{
+	auto reader = ifstream(path); auto line = string(); auto fieldCount = 0;
+
+	while (getline(reader, line))
+	{
+		if (NVLib::StringUtils::StartsWith(line, "@DATA")) break;
+		if (NVLib::StringUtils::StartsWith(line, "@ATTRIBUTE"))
+		{
+			auto parts = vector<string>(); NVLib::StringUtils::Split(line, ' ', parts);
+			if (parts.size() == 3 && parts[1] != "class") fieldCount++;
+		}
+	}
+
+	auto records = vector<vector<double>>();
+	while (getline(reader, line) && line != string())
+	{
+		auto parts = vector<string>(); NVLib::StringUtils::Split(line, ',', parts);
+		auto record = vector<double>(); for (auto& part : parts) record.push_back(NVLib::StringUtils::String2Double(part));
+		records.push_back(record);
+	}
+
+	inputs = Mat_<float>((int)records.size(), fieldCount); outputs = Mat_<float>((int)records.size(), 1);
+	for (auto row = 0; row < (int)records.size(); row++)
+	{
+		for (auto column = 0; column < fieldCount; column++) inputs.at<float>(row, column) = (float) records[row][column];
+		outputs.at<float>(row) = (float) records[row][fieldCount];
+	}
+}
+
+/**
+ * @brief Confirm that the reader produces exactly the same values as the reference parser
+ * @param path The path to the file that we are checking
+ * @param threadCount The number of threads that the reader uses
+ */
+void CompareWithReference(const string& path, int threadCount)
+{
+	Mat inputs, outputs; LoadReference(path, inputs, outputs);
+
+	auto reader = NVL_AI::ArffReader(path, threadCount);
+	auto trainData = reader.Read();
+
+	ASSERT_EQ(reader.GetRowCount(), inputs.rows);
+	ASSERT_EQ(trainData->GetInputs().rows, inputs.rows);
+	ASSERT_EQ(trainData->GetInputs().cols, inputs.cols);
+	ASSERT_EQ(trainData->GetOutputs().rows, outputs.rows);
+
+	auto expectedInput = (float *) inputs.data; auto actualInput = (float *) trainData->GetInputs().data;
+	for (auto i = 0; i < inputs.rows * inputs.cols; i++) ASSERT_EQ(actualInput[i], expectedInput[i]);
+
+	auto expectedOutput = (float *) outputs.data; auto actualOutput = (float *) trainData->GetOutputs().data;
+	for (auto i = 0; i < outputs.rows; i++) ASSERT_EQ(actualOutput[i], expectedOutput[i]);
+
+	delete trainData;
+}
@@ -0,0 +1,92 @@
+//--------------------------------------------------
+// Unit Tests for ArffWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/ArffWriter.h>
+#include <NeuralMLPLib/ArffReader.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * RoundTrip(Mat& data, int threadCount);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that double data written over several blocks and threads reads back in order
+ */
+TEST(ArffWriter_Test, double_round_trip)
+{
+	// Create some test data
+	Mat data = Mat_<double>(10000, 4); randu(data, -1e4, 1e4);
+
+	// Write it out and read it back
+	auto trainData = RoundTrip(data, 3);
+
+	// Confirm that the values match what LoadData would have produced from the original
+	ASSERT_EQ(trainData->GetInputs().rows, data.rows);
+	for (auto row = 0; row < data.rows; row++)
+	{
+		for (auto column = 0; column < 3; column++) ASSERT_EQ(trainData->GetInputs().at<float>(row, column), (float) data.at<double>(row, column));
+		ASSERT_EQ(trainData->GetOutputs().at<float>(row), (float) data.at<double>(row, 3));
+	}
+
+	// Free working variables
+	delete trainData;
+}
+
+/**
+ * @brief Confirm that float data reads back exactly, including values whose shortest text does not
+ */
+TEST(ArffWriter_Test, float_round_trip)
+{
+	// Create some test data, including a value that needs to be written in full
+	Mat data = Mat_<float>(500, 2); randu(data, -1e3, 1e3);
+	data.at<float>(0, 0) = -7.038531e-26f; data.at<float>(0, 1) = 1e-30f;
+
+	// Write it out and read it back
+	auto trainData = RoundTrip(data, 1);
+
+	// Confirm that the values are identical
+	for (auto row = 0; row < data.rows; row++)
+	{
+		ASSERT_EQ(trainData->GetInputs().at<float>(row, 0), data.at<float>(row, 0));
+		ASSERT_EQ(trainData->GetOutputs().at<float>(row), data.at<float>(row, 1));
+	}
+
+	// Free working variables
+	delete trainData;
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Write the given data to disk and read it back again
+ * @param data The data that we are writing
+ * @param threadCount The number of threads used by the writer
+ * @return NVL_AI::TrainData * The data that was read back
+ */
+NVL_AI::TrainData * RoundTrip(Mat& data, int threadCount)
+{
+	if (NVLib::FileUtils::Exists("writer.arff")) NVLib::FileUtils::Remove("writer.arff");
+
+	auto writer = NVL_AI::ArffWriter("writer.arff", threadCount);
+	writer.WriteHeader("writer", "Unit test writer file", data.cols - 1);
+	writer.WriteRows(data);
+	writer.Close();
+
+	return NVL_AI::ArffReader("writer.arff").Read();
+}
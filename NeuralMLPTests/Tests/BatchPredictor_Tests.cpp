@@ -0,0 +1,87 @@
+//--------------------------------------------------
+// Unit Tests for BatchPredictor
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/ArffReader.h>
+#include <NeuralMLPLib/NativeNetwork.h>
+#include <NeuralMLPLib/BatchPredictor.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+void WriteUnlabelledData(const string& path, Mat& inputs);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that streaming unlabelled records in small batches gives the same predictions as one big predict
+ */
+TEST(BatchPredictor_Test, batches_match_predict)
+{
+	// Setup
+	auto model = NVL_AI::ModelData(vector<int> { 2, 5, 1 }, 0.1);
+	for (auto i = 0; i < model.GetLayerCount() + 2; i++) randu(model.GetWeights(i), -1, 1);
+	auto network = Ptr<NVL_AI::Network>(new NVL_AI::NativeNetwork(model));
+
+	Mat inputs = Mat_<float>(10, 2); randu(inputs, -10, 10);
+	WriteUnlabelledData("unlabelled.arff", inputs);
+	Mat expected; network->Predict(inputs, expected);
+
+	// Execute
+	auto predictor = NVL_AI::BatchPredictor(network, 3, 2);
+	auto stats = predictor.Run("unlabelled.arff", "predicted.arff");
+
+	// Confirm
+	ASSERT_EQ(stats.Rows, 10); ASSERT_EQ(stats.Batches, 4);
+	ASSERT_LE(stats.LatencyP50, stats.LatencyMax);
+
+	auto actual = NVL_AI::ArffReader("predicted.arff").Read();
+	ASSERT_EQ(actual->GetInputs().rows, 10);
+	for (auto row = 0; row < 10; row++) ASSERT_NEAR(actual->GetOutputs().at<float>(row, 0), expected.at<float>(row, 0), 1e-4);
+
+	// Teardown
+	delete actual;
+}
+
+/**
+ * @brief Confirm that percentiles use the nearest rank
+ */
+TEST(BatchPredictor_Test, percentiles)
+{
+	auto values = vector<double> { 5, 1, 4, 2, 3, 10, 9, 8, 7, 6 };
+
+	ASSERT_EQ(NVL_AI::BatchPredictor::GetPercentile(values, 0.5), 5);
+	ASSERT_EQ(NVL_AI::BatchPredictor::GetPercentile(values, 0.9), 9);
+	ASSERT_EQ(NVL_AI::BatchPredictor::GetPercentile(values, 1.0), 10);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Write an ARFF file where every class is missing ("?")
+ * @param path The path to the file
+ * @param inputs The inputs that are written
+ */
+void WriteUnlabelledData(const string& path, Mat& inputs)
+{
+	auto writer = ofstream(path);
+	writer << "@ATTRIBUTE p[0] REAL" << endl << "@ATTRIBUTE p[1] REAL" << endl << "@ATTRIBUTE class REAL" << endl << endl << "@DATA" << endl;
+
+	for (auto row = 0; row < inputs.rows; row++)
+	{
+		writer << setprecision(9) << inputs.at<float>(row, 0) << "," << inputs.at<float>(row, 1) << ",?" << endl;
+	}
+}
@@ -0,0 +1,155 @@
+//--------------------------------------------------
+// Unit Tests for CheckpointWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/CheckpointWriter.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+Ptr<NVL_AI::ModelData> CreateSnapshot();
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a burst of snapshots is either written or counted as skipped, and that a complete
+ * checkpoint ends up in place
+ */
+TEST(CheckpointWriter_Test, burst_is_coalesced)
+{
+	// Setup
+	if (NVLib::FileUtils::Exists("checkpoint.xml")) NVLib::FileUtils::Remove("checkpoint.xml");
+	auto writer = NVL_AI::CheckpointWriter("checkpoint.xml");
+
+	// Execute
+	for (auto i = 0; i < 50; i++) writer.Submit(CreateSnapshot());
+	writer.Flush();
+
+	// Confirm
+	ASSERT_GE(writer.GetWriteCount(), 1);
+	ASSERT_EQ(writer.GetWriteCount() + writer.GetSkipCount(), 50);
+	ASSERT_TRUE(NVLib::FileUtils::Exists("checkpoint.xml"));
+	ASSERT_FALSE(NVLib::FileUtils::Exists("checkpoint.xml.tmp"));
+}
+
+/**
+ * @brief Confirm that a snapshot that is still waiting when the writer is destroyed gets written
+ */
+TEST(CheckpointWriter_Test, pending_written_on_close)
+{
+	// Setup
+	if (NVLib::FileUtils::Exists("checkpoint_close.xml")) NVLib::FileUtils::Remove("checkpoint_close.xml");
+
+	// Execute
+	{
+		auto writer = NVL_AI::CheckpointWriter("checkpoint_close.xml");
+		writer.Submit(CreateSnapshot());
+	}
+
+	// Confirm
+	ASSERT_TRUE(NVLib::FileUtils::Exists("checkpoint_close.xml"));
+}
+
+/**
+ * @brief Confirm that the training state is saved beside the checkpoint and read back, and that a damaged or incomplete
+ * state counts as none
+ */
+TEST(CheckpointWriter_Test, state_round_trip)
+{
+	// Execute
+	{
+		auto writer = NVL_AI::CheckpointWriter("checkpoint_state.xml");
+		writer.SetRun("rmse", "Input/my problem.arff", 800);
+		writer.Submit(CreateSnapshot(), 41, 40, 0.123456789012345);
+		writer.Flush();
+	}
+
+	auto result = NVL_AI::CheckpointState();
+	auto found = NVL_AI::CheckpointWriter::ReadState(NVL_AI::CheckpointWriter::GetStatePath("checkpoint_state.xml"), result);
+
+	// Confirm
+	ASSERT_TRUE(found);
+	ASSERT_EQ(result.Iteration, 41); ASSERT_EQ(result.BestIteration, 40); ASSERT_EQ(result.Score, 0.123456789012345); ASSERT_EQ(result.Metric, "rmse");
+	ASSERT_EQ(result.Data, "Input/my problem.arff"); ASSERT_EQ(result.Rows, 800);
+
+	ofstream("checkpoint_damaged.state") << "iteration x" << endl;
+	ASSERT_FALSE(NVL_AI::CheckpointWriter::ReadState("checkpoint_damaged.state", result));
+	ofstream("checkpoint_partial.state") << "iteration 41" << endl << "score 0.5" << endl << "metric rmse" << endl << "data a.arff" << endl << "rows 800" << endl;
+	ASSERT_FALSE(NVL_AI::CheckpointWriter::ReadState("checkpoint_partial.state", result));
+	ASSERT_FALSE(NVL_AI::CheckpointWriter::ReadState("checkpoint_missing.state", result));
+}
+
+/**
+ * @brief Confirm that state updates after the last snapshot record the last completed iteration apart from the best
+ * one, without writing the model again, and that they are ignored until there is a snapshot
+ */
+TEST(CheckpointWriter_Test, state_follows_updates)
+{
+	// Setup
+	auto statePath = NVL_AI::CheckpointWriter::GetStatePath("checkpoint_update.xml");
+	if (NVLib::FileUtils::Exists(statePath)) NVLib::FileUtils::Remove(statePath);
+	auto writer = NVL_AI::CheckpointWriter("checkpoint_update.xml");
+	writer.SetRun("total", "problem.arff", 10);
+
+	// Execute
+	writer.Update(3, 3, 0.5); writer.Flush();
+	auto early = NVLib::FileUtils::Exists(statePath);
+
+	writer.Submit(CreateSnapshot(), 3, 3, 0.5);
+	for (auto i = 4; i < 8; i++) writer.Update(i, 3, 0.5);
+	writer.Flush();
+
+	auto result = NVL_AI::CheckpointState();
+	auto found = NVL_AI::CheckpointWriter::ReadState(statePath, result);
+
+	// Confirm
+	ASSERT_FALSE(early);
+	ASSERT_TRUE(found);
+	ASSERT_EQ(result.Iteration, 7); ASSERT_EQ(result.BestIteration, 3); ASSERT_EQ(result.Score, 0.5);
+	ASSERT_EQ(result.Data, "problem.arff"); ASSERT_EQ(result.Rows, 10);
+	ASSERT_EQ(writer.GetWriteCount(), 1);
+}
+
+/**
+ * @brief Confirm that handing a newer state to the writer (as the engine does on every iteration) makes no heap allocations
+ */
+TEST(CheckpointWriter_Test, update_does_not_allocate)
+{
+	// Setup
+	auto writer = NVL_AI::CheckpointWriter("checkpoint_allocations.xml");
+	writer.SetRun("total", "a path that is too long to fit in the small string buffer.arff", 10);
+	writer.Submit(CreateSnapshot(), 0, 0, 0.5); writer.Flush();
+
+	// Execute
+	auto start = NVL_AI::AllocationCounter::GetStats();
+	for (auto i = 1; i < 100; i++) writer.Update(i, 0, 0.5);
+	auto change = NVL_AI::AllocationCounter::GetChange(start);
+	writer.Flush();
+
+	// Confirm
+	ASSERT_EQ(change.Count, 0);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a small model snapshot
+ * @return Ptr<NVL_AI::ModelData> The resultant snapshot
+ */
+Ptr<NVL_AI::ModelData> CreateSnapshot()
+{
+	return Ptr<NVL_AI::ModelData>(new NVL_AI::ModelData(vector<int> { 2, 5, 1 }, 0.1));
+}
@@ -0,0 +1,87 @@
+//--------------------------------------------------
+// Unit Tests for CodeGenerator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/CodeGenerator.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+Ptr<NVL_AI::ModelData> BuildGeneratorModel();
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the predictor fixes the topology at compile time and chains the layers through the two buffers
+ */
+TEST(CodeGenerator_Test, topology_is_constexpr)
+{
+	// Setup
+	auto generator = NVL_AI::CodeGenerator(BuildGeneratorModel(), "TinyPredictor", "Deployed");
+
+	// Execute
+	auto text = generator.Generate("tiny.xml");
+
+	// Confirm
+	ASSERT_NE(text.find("from tiny.xml"), string::npos);
+	ASSERT_NE(text.find("namespace Deployed"), string::npos);
+	ASSERT_NE(text.find("class TinyPredictor"), string::npos);
+	ASSERT_NE(text.find("LayerSizes = {{ 2, 3, 1 }}"), string::npos);
+	ASSERT_NE(text.find("Layer<2, 3>(Weights1, first.data(), second.data());"), string::npos);
+	ASSERT_NE(text.find("Layer<3, 1>(Weights2, second.data(), first.data());"), string::npos);
+	ASSERT_NE(text.find("outputs[j] = first[j]"), string::npos);
+	ASSERT_NE(text.find("std::array<float, 9> Weights1"), string::npos);
+	ASSERT_NE(text.find("std::array<float, 4> Weights2"), string::npos);
+	ASSERT_EQ(text.find("new "), string::npos);
+}
+
+/**
+ * @brief Confirm that the weights are written as literals that read back to the same floats
+ */
+TEST(CodeGenerator_Test, weights_round_trip)
+{
+	// Setup
+	auto model = BuildGeneratorModel();
+	auto generator = NVL_AI::CodeGenerator(model, "TinyPredictor");
+
+	// Execute
+	auto text = generator.Generate();
+	auto start = text.find("Weights1 = {{"); auto end = text.find("}};", start);
+	auto values = vector<float>(); auto reader = stringstream(text.substr(start + 13, end - start - 13)); auto item = string();
+	while (getline(reader, item, ',')) values.push_back(stof(item));
+
+	// Confirm
+	ASSERT_EQ(values.size(), 9);
+	for (auto i = 0; i < 9; i++) ASSERT_EQ(values[i], (float) model->GetWeights(1).at<double>(i / 3, i % 3));
+	ASSERT_THROW(NVL_AI::CodeGenerator(model, "2Predictor"), runtime_error);
+	ASSERT_THROW(NVL_AI::CodeGenerator(model, "Predictor", "NVL::AI"), runtime_error);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a 2-3-1 model with weights that are awkward to write as decimals
+ * @return Ptr<NVL_AI::ModelData> The resultant model
+ */
+Ptr<NVL_AI::ModelData> BuildGeneratorModel()
+{
+	auto result = Ptr<NVL_AI::ModelData>(new NVL_AI::ModelData(vector<int> { 2, 3, 1 }, 0.01));
+
+	auto& first = result->GetWeights(1); for (auto i = 0; i < 9; i++) first.at<double>(i / 3, i % 3) = 1.0 / (i + 3) - 0.25;
+	auto& second = result->GetWeights(2); for (auto i = 0; i < 4; i++) second.at<double>(i, 0) = -1.0 / (i + 7);
+	for (auto i = 0; i < 4; i++) result->GetInputScale().at<double>(0, i) = i % 2 == 0 ? 0.1 : -3.0;
+	for (auto i = 0; i < 2; i++) result->GetOutputScale().at<double>(0, i) = i == 0 ? 1000.0 : 3589.0;
+
+	return result;
+}
@@ -0,0 +1,134 @@
+//--------------------------------------------------
+// Unit Tests for CrossValidator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/CrossValidator.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateFoldData(int rows);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that every row is held out by exactly one fold, and that each fold trains on the rest
+ */
+TEST(CrossValidator_Test, folds_partition_rows)
+{
+	// Setup
+	auto data = CreateFoldData(50);
+	auto settings = NVL_AI::NetworkSettings(); settings.Backend = "native"; settings.Structure = "3";
+
+	// Execute
+	auto validator = NVL_AI::CrossValidator(data, settings, 4, 1);
+
+	// Confirm
+	auto counts = vector<int>(50, 0);
+	for (auto fold = 0; fold < validator.GetFoldCount(); fold++)
+	{
+		auto testView = validator.GetTestView(fold); auto trainView = validator.GetTrainView(fold);
+		ASSERT_TRUE(testView->IsView()); ASSERT_TRUE(trainView->IsView());
+		ASSERT_EQ(testView->GetRowCount() + trainView->GetRowCount(), 50);
+		ASSERT_GE(testView->GetRowCount(), 12); ASSERT_LE(testView->GetRowCount(), 13);
+		ASSERT_EQ(testView->GetInputs().data, data->GetInputs().data);
+		for (auto row : testView->GetRows()) counts[row]++;
+	}
+	for (auto count : counts) ASSERT_EQ(count, 1);
+
+	// Teardown
+	delete data;
+}
+
+/**
+ * @brief Confirm that training on a view gives the same network as training on a copy of its rows
+ */
+TEST(CrossValidator_Test, view_training_matches_copy)
+{
+	// Setup
+	auto data = CreateFoldData(40);
+	auto rows = vector<int>(); for (auto row = 0; row < 40; row += 2) rows.push_back(row);
+	auto view = NVL_AI::TrainData(data, rows);
+
+	Mat inputs = Mat_<float>(20, 2); Mat outputs = Mat_<float>(20, 1);
+	for (auto i = 0; i < 20; i++)
+	{
+		inputs.at<float>(i, 0) = data->GetInputs().at<float>(rows[i], 0); inputs.at<float>(i, 1) = data->GetInputs().at<float>(rows[i], 1);
+		outputs.at<float>(i, 0) = data->GetOutputs().at<float>(rows[i], 0);
+	}
+	auto copy = NVL_AI::TrainData(inputs, outputs);
+
+	auto settings = NVL_AI::NetworkSettings(); settings.Backend = "native"; settings.Structure = "3"; settings.Epochs = 5;
+	auto viewNetwork = NVL_AI::NetworkFactory::Create(settings, 2, 1);
+	auto copyNetwork = NVL_AI::NetworkFactory::Create(settings, 2, 1);
+
+	// Execute
+	viewNetwork->Train(&view, false); viewNetwork->Train(&view, true);
+	copyNetwork->Train(&copy, false); copyNetwork->Train(&copy, true);
+	auto viewScore = NVL_AI::Scorer(&view, 1).Evaluate(viewNetwork);
+	auto copyScore = NVL_AI::Scorer(&copy, 1).Evaluate(copyNetwork);
+
+	// Confirm
+	ASSERT_DOUBLE_EQ(viewScore.Total, copyScore.Total);
+	ASSERT_DOUBLE_EQ(viewScore.MaxError, copyScore.MaxError);
+
+	// Teardown
+	delete data;
+}
+
+/**
+ * @brief Confirm that running the folds side by side gives a result for each fold and a mean across them
+ */
+TEST(CrossValidator_Test, run_reports_every_fold)
+{
+	// Setup
+	auto data = CreateFoldData(60);
+	auto settings = NVL_AI::NetworkSettings(); settings.Backend = "native"; settings.Structure = "4"; settings.Epochs = 5;
+
+	// Execute
+	auto validator = NVL_AI::CrossValidator(data, settings, 3, 2, 2);
+	auto results = validator.Run();
+	auto mean = NVL_AI::CrossValidator::GetMean(results);
+	auto deviation = NVL_AI::CrossValidator::GetDeviation(results);
+
+	// Confirm
+	ASSERT_EQ(results.size(), 3);
+	auto total = 0.0;
+	for (auto i = 0; i < 3; i++)
+	{
+		ASSERT_EQ(results[i].Fold, i); ASSERT_EQ(results[i].TestRows, 20); ASSERT_EQ(results[i].TrainRows, 40);
+		total += results[i].TestScore.MAE;
+	}
+	ASSERT_NEAR(mean.MAE, total / 3, 1e-12);
+	ASSERT_GE(deviation.MAE, 0);
+
+	// Teardown
+	delete data;
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a dataset where the class is the sum of the inputs
+ * @param rows The number of rows in the dataset
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateFoldData(int rows)
+{
+	Mat inputs = Mat_<float>(rows, 2); randu(inputs, -1, 1);
+	Mat outputs = Mat_<float>(rows, 1);
+	for (auto row = 0; row < rows; row++) outputs.at<float>(row, 0) = 0.5f * (inputs.at<float>(row, 0) + inputs.at<float>(row, 1));
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
@@ -0,0 +1,136 @@
+//--------------------------------------------------
+// Unit Tests for DataCache
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/DataCache.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+void WriteCacheSource(const string& path, int rows);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the first load builds the cache and the second one maps it with the same values
+ */
+TEST(DataCache_Test, second_load_maps_cache)
+{
+	// Setup a fresh source file
+	if (NVLib::FileUtils::Exists("cache.arff.cache")) NVLib::FileUtils::Remove("cache.arff.cache");
+	WriteCacheSource("cache.arff", 5);
+
+	// First load parses the ARFF file
+	auto first = NVL_AI::DataCache("cache.arff");
+	auto expected = first.Load();
+	ASSERT_FALSE(first.IsHit());
+	ASSERT_TRUE(NVLib::FileUtils::Exists("cache.arff.cache"));
+
+	// Second load maps the cache
+	auto second = NVL_AI::DataCache("cache.arff");
+	auto actual = second.Load();
+	ASSERT_TRUE(second.IsHit());
+	ASSERT_EQ(second.GetFieldNames().size(), 2);
+	ASSERT_EQ(second.GetFieldNames()[1], "p[1]");
+
+	// Confirm that the values match
+	ASSERT_EQ(actual->GetInputs().rows, 5); ASSERT_EQ(actual->GetInputs().cols, 2);
+	ASSERT_EQ(actual->GetOutputs().rows, 5); ASSERT_EQ(actual->GetOutputs().cols, 1);
+	ASSERT_EQ((size_t) actual->GetInputs().data % 64, 0);
+	for (auto row = 0; row < 5; row++)
+	{
+		ASSERT_EQ(actual->GetInputs().at<float>(row, 0), expected->GetInputs().at<float>(row, 0));
+		ASSERT_EQ(actual->GetInputs().at<float>(row, 1), expected->GetInputs().at<float>(row, 1));
+		ASSERT_EQ(actual->GetOutputs().at<float>(row), expected->GetOutputs().at<float>(row));
+	}
+
+	// Free working variables
+	delete expected; delete actual;
+}
+
+/**
+ * @brief Confirm that changing the source file invalidates the cache
+ */
+TEST(DataCache_Test, changed_source_invalidates_cache)
+{
+	// Build the cache from the first version of the file
+	WriteCacheSource("cache.arff", 5);
+	delete NVL_AI::DataCache("cache.arff").Load();
+
+	// Change the source and confirm that it is parsed again
+	WriteCacheSource("cache.arff", 7);
+	auto cache = NVL_AI::DataCache("cache.arff");
+	auto data = cache.Load();
+	ASSERT_FALSE(cache.IsHit());
+	ASSERT_EQ(data->GetInputs().rows, 7);
+
+	// Free working variables
+	delete data;
+}
+
+/**
+ * @brief Confirm that streaming the source into its cache (a few rows at a time) gives the cache that a load would map
+ */
+TEST(DataCache_Test, stream_builds_cache)
+{
+	// Stream a fresh source file into its cache
+	if (NVLib::FileUtils::Exists("stream.arff.cache")) NVLib::FileUtils::Remove("stream.arff.cache");
+	WriteCacheSource("stream.arff", 7);
+	auto cache = NVL_AI::DataCache("stream.arff");
+	cache.Stream(3);
+	ASSERT_FALSE(cache.IsHit());
+	ASSERT_TRUE(NVLib::FileUtils::Exists("stream.arff.cache"));
+
+	// Confirm that a load maps the streamed cache, with the values of the source
+	auto loaded = NVL_AI::DataCache("stream.arff");
+	auto actual = loaded.Load();
+	ASSERT_TRUE(loaded.IsHit());
+	ASSERT_EQ(actual->GetInputs().rows, 7); ASSERT_EQ(actual->GetInputs().cols, 2);
+	for (auto row = 0; row < 7; row++)
+	{
+		ASSERT_EQ(actual->GetInputs().at<float>(row, 0), row * 0.5f);
+		ASSERT_EQ(actual->GetInputs().at<float>(row, 1), (float) -row);
+		ASSERT_EQ(actual->GetOutputs().at<float>(row), (float) (row * row));
+	}
+
+	// A second stream finds the cache up to date
+	auto second = NVL_AI::DataCache("stream.arff");
+	second.Stream(3);
+	ASSERT_TRUE(second.IsHit());
+
+	// Free working variables
+	delete actual;
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Write a small source dataset to disk
+ * @param path The path that we are writing to
+ * @param rows The number of rows that we are writing
+ */
+void WriteCacheSource(const string& path, int rows)
+{
+	Mat data = Mat_<double>::zeros(rows, 3);
+	for (auto row = 0; row < rows; row++)
+	{
+		data.at<double>(row, 0) = row * 0.5; data.at<double>(row, 1) = -row; data.at<double>(row, 2) = row * row;
+	}
+
+	if (NVLib::FileUtils::Exists(path)) NVLib::FileUtils::Remove(path);
+	NVL_AI::NeuralUtils::WriteData(path, "cache", "Unit test dataset cache file", data);
+}
@@ -0,0 +1,114 @@
+//--------------------------------------------------
+// Unit Tests for DataGenerator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/ArffReader.h>
+#include <NeuralMLPLib/DataGenerator.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::GeneratorSettings GetGeneratorSettings(int rows, int blockRows, int threadCount);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a generated ARFF file reads back with the class given by the expression
+ */
+TEST(DataGenerator_Test, arff_matches_expression)
+{
+	// Setup
+	auto generator = NVL_AI::DataGenerator(GetGeneratorSettings(1000, 128, 2));
+
+	// Execute
+	auto stats = generator.Run("generated_test.arff");
+	auto data = NVL_AI::ArffReader("generated_test.arff").Read();
+
+	// Confirm
+	ASSERT_EQ(stats.Rows, 1000);
+	ASSERT_EQ(data->GetInputs().rows, 1000); ASSERT_EQ(data->GetInputs().cols, 3);
+	for (auto row = 0; row < 1000; row++)
+	{
+		auto p = data->GetInputs().ptr<float>(row);
+		ASSERT_GE(p[0], 0); ASSERT_LT(p[0], 100);
+		ASSERT_NEAR(data->GetOutputs().at<float>(row, 0), (p[0] * p[1]) - p[2], 1e-2);
+	}
+
+	// Teardown
+	delete data;
+	NVLib::FileUtils::Remove("generated_test.arff");
+}
+
+/**
+ * @brief Confirm that the rows are the same whatever the block size and thread count, and that a binary
+ * dataset holds the same values as the ARFF one
+ */
+TEST(DataGenerator_Test, binary_is_deterministic)
+{
+	// Setup
+	auto first = NVL_AI::DataGenerator(GetGeneratorSettings(1000, 1000, 1));
+	auto second = NVL_AI::DataGenerator(GetGeneratorSettings(1000, 77, 3));
+
+	// Execute
+	first.Run("generated_test.arff");
+	second.Run("generated_test.nmld");
+	auto text = NVL_AI::ArffReader("generated_test.arff").Read();
+	auto binary = NVL_AI::DataCache::LoadBinary("generated_test.nmld");
+
+	// Confirm
+	ASSERT_EQ(binary->GetInputs().rows, 1000); ASSERT_EQ(binary->GetOutputs().cols, 1);
+	for (auto row = 0; row < 1000; row++)
+	{
+		for (auto column = 0; column < 3; column++) ASSERT_EQ(binary->GetInputs().at<float>(row, column), text->GetInputs().at<float>(row, column));
+		ASSERT_EQ(binary->GetOutputs().at<float>(row, 0), text->GetOutputs().at<float>(row, 0));
+	}
+
+	// Teardown
+	delete text; delete binary;
+	NVLib::FileUtils::Remove("generated_test.arff"); NVLib::FileUtils::Remove("generated_test.nmld");
+}
+
+/**
+ * @brief Confirm that ranges are parsed, and that a range is needed for each variable (or one for them all)
+ */
+TEST(DataGenerator_Test, parse_ranges)
+{
+	auto low = vector<double>(); auto high = vector<double>();
+	NVL_AI::DataGenerator::ParseRanges("0:1;-5:5", low, high);
+	ASSERT_EQ(low.size(), 2); ASSERT_EQ(low[1], -5); ASSERT_EQ(high[1], 5);
+
+	auto settings = GetGeneratorSettings(10, 10, 1);
+	NVL_AI::DataGenerator::ParseRanges("0:1;0:2", settings.Low, settings.High);
+	ASSERT_THROW(NVL_AI::DataGenerator generator(settings), runtime_error);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Settings for the problem.arff expression over [0, 100)
+ * @param rows The number of rows to generate
+ * @param blockRows The number of rows in each block
+ * @param threadCount The number of threads
+ * @return NVL_AI::GeneratorSettings The resultant settings
+ */
+NVL_AI::GeneratorSettings GetGeneratorSettings(int rows, int blockRows, int threadCount)
+{
+	auto result = NVL_AI::GeneratorSettings();
+	result.Expression = "(p[0] * p[1]) - p[2]";
+	result.Low = vector<double> { 0 }; result.High = vector<double> { 100 };
+	result.RowCount = rows; result.Seed = 42; result.BlockRows = blockRows; result.ThreadCount = threadCount;
+	return result;
+}
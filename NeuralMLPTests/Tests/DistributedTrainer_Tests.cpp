@@ -0,0 +1,155 @@
+//--------------------------------------------------
+// Unit Tests for DistributedTrainer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/ParallelUtils.h>
+#include <NeuralMLPLib/DatasetWriter.h>
+#include <NeuralMLPLib/DistributedTrainer.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+string GetTestAddress(const string& type);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that every transport leaves each worker with the mean of the workers' weights, and agrees on stopping
+ */
+TEST(DistributedTrainer_Test, averages_weights)
+{
+	for (auto type : { "shm", "tcp" })
+	{
+		// Setup
+		auto errors = vector<float>(3); auto stops = vector<int>(3); auto runs = vector<int>(3);
+
+		// Execute: each worker stands in for a process and starts from weights set to its rank plus one
+		NVL_AI::ParallelUtils::Run(3, [&](int rank)
+		{
+			auto trainer = NVL_AI::DistributedTrainer(NVL_AI::Transport::Create(type, GetTestAddress(type), rank, 3, 10));
+			auto network = NVL_AI::NativeNetwork(vector<int> { 2, 3, 1 }, 0.1);
+			for (auto i = 1; i < 3; i++) network.GetWeights()[i].setTo(rank + 1);
+
+			trainer.Average(network);
+
+			for (auto i = 1; i < 3; i++)
+			{
+				auto& weights = network.GetWeights()[i];
+				for (auto j = 0; j < (int) weights.total(); j++) errors[rank] = max(errors[rank], abs(((float *) weights.data)[j] - 2.0f));
+			}
+			stops[rank] = trainer.Agree(rank == 1) ? 1 : 0;
+			runs[rank] = trainer.Agree(false) ? 0 : 1;
+		});
+
+		// Confirm
+		for (auto rank = 0; rank < 3; rank++)
+		{
+			ASSERT_EQ(errors[rank], 0.0f) << type; ASSERT_EQ(stops[rank], 1) << type; ASSERT_EQ(runs[rank], 1) << type;
+		}
+	}
+
+	ASSERT_THROW(NVL_AI::Transport::Create("udp", "", 0, 1), runtime_error);
+}
+
+/**
+ * @brief Confirm that a shared memory worker does not join a segment of the same name that was made for another job
+ */
+TEST(DistributedTrainer_Test, shm_ignores_other_jobs)
+{
+	// Setup
+	auto failures = vector<int>(2);
+
+	// Execute: the first worker creates the segment for job 1, while the second worker belongs to job 2
+	NVL_AI::ParallelUtils::Run(2, [&](int rank)
+	{
+		try { NVL_AI::Transport::Create("shm", GetTestAddress("shm") + "_job", rank, 2, 1, rank + 1); }
+		catch (runtime_error&) { failures[rank] = 1; }
+	});
+
+	// Confirm that neither worker joined, and that the first one removed its segment on the way out
+	ASSERT_EQ(failures, (vector<int> { 1, 1 }));
+	ASSERT_LT(shm_open((GetTestAddress("shm") + "_job").c_str(), O_RDWR, 0600), 0);
+}
+
+/**
+ * @brief Confirm that the partitions cover the rows between them and carry the statistics of the whole dataset
+ */
+TEST(DistributedTrainer_Test, partitions_share_stats)
+{
+	// Setup
+	Mat inputs = Mat_<float>(10, 2); Mat outputs = Mat_<float>(10, 1);
+	for (auto row = 0; row < 10; row++) { inputs.at<float>(row, 0) = (float) row; inputs.at<float>(row, 1) = (float) (row * row); outputs.at<float>(row) = (float) -row; }
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	auto expected = NVL_AI::Normalizer::GetStats(inputs, vector<int>());
+	auto rows = vector<int>(3); auto errors = vector<double>(3);
+
+	// Execute
+	NVL_AI::ParallelUtils::Run(3, [&](int rank)
+	{
+		auto trainer = NVL_AI::DistributedTrainer(NVL_AI::Transport::Create("shm", GetTestAddress("shm") + "_stats", rank, 3, 10));
+		auto partition = Ptr<NVL_AI::TrainData>(trainer.GetPartition(&data));
+
+		rows[rank] = partition->GetRowCount();
+		auto& stats = partition->GetInputStats();
+		for (auto i = 0; i < (int) stats.total(); i++) errors[rank] = max(errors[rank], abs(((double *) stats.data)[i] - ((double *) expected.data)[i]));
+	});
+
+	// Confirm
+	ASSERT_EQ(rows, (vector<int> { 3, 3, 4 }));
+	for (auto error : errors) ASSERT_LT(error, 1e-9);
+}
+
+/**
+ * @brief Confirm that each worker loads its own block of rows from a binary dataset, which outlives the dataset it came from
+ */
+TEST(DistributedTrainer_Test, partitions_load_from_file)
+{
+	// Setup
+	Mat inputs = Mat_<float>(10, 2); Mat outputs = Mat_<float>(10, 1);
+	for (auto row = 0; row < 10; row++) { inputs.at<float>(row, 0) = (float) row; inputs.at<float>(row, 1) = (float) (row * row); outputs.at<float>(row) = (float) -row; }
+	{
+		auto writer = NVL_AI::DatasetWriter("partition.nmld", "partition", "Unit test dataset", 10, 2);
+		writer.WriteRows(inputs, outputs); writer.Close();
+	}
+	auto firsts = vector<float>(3); auto rows = vector<int>(3);
+
+	// Execute
+	NVL_AI::ParallelUtils::Run(3, [&](int rank)
+	{
+		auto trainer = NVL_AI::DistributedTrainer(NVL_AI::Transport::Create("shm", GetTestAddress("shm") + "_load", rank, 3, 10));
+		auto partition = Ptr<NVL_AI::TrainData>(trainer.LoadPartition("partition.nmld"));
+		rows[rank] = partition->GetRowCount(); firsts[rank] = partition->GetOutputs().at<float>(0);
+	});
+
+	// Confirm
+	ASSERT_EQ(rows, (vector<int> { 3, 3, 4 }));
+	ASSERT_EQ(firsts, (vector<float> { 0.0f, -3.0f, -6.0f }));
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build an address that is unique to this test run, so that runs side by side do not meet
+ * @param type The type of transport
+ * @return string The resultant address
+ */
+string GetTestAddress(const string& type)
+{
+	if (type == "tcp") return NVLib::Formatter() << "127.0.0.1:" << (20000 + getpid() % 20000);
+	return NVLib::Formatter() << "/neuralmlp_test_" << getpid();
+}
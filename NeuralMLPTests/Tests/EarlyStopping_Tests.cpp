@@ -0,0 +1,66 @@
+//--------------------------------------------------
+// Unit Tests for EarlyStopping
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/EarlyStopping.h>
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that training stops once the patience runs out, keeping track of the best iteration
+ */
+TEST(EarlyStopping_Test, patience_runs_out)
+{
+	// Setup
+	auto stopping = NVL_AI::EarlyStopping(2, 0, 0);
+
+	// Execute and Confirm
+	ASSERT_TRUE(stopping.Update(0, 5.0));
+	ASSERT_TRUE(stopping.Update(1, 4.0));
+	ASSERT_FALSE(stopping.Update(2, 4.5)); ASSERT_FALSE(stopping.IsStopped());
+	ASSERT_FALSE(stopping.Update(3, 4.0)); ASSERT_TRUE(stopping.IsStopped());
+	ASSERT_EQ(stopping.GetBestScore(), 4.0); ASSERT_EQ(stopping.GetBestIteration(), 1);
+}
+
+/**
+ * @brief Confirm that small gains are kept as new bests but do not reset the patience
+ */
+TEST(EarlyStopping_Test, small_gains_use_patience)
+{
+	// Setup
+	auto stopping = NVL_AI::EarlyStopping(3, 0.5, 0);
+
+	// Execute
+	stopping.Update(0, 10.0);
+	auto first = stopping.Update(1, 9.9);
+	auto second = stopping.Update(2, 9.8);
+	auto third = stopping.Update(3, 9.7);
+
+	// Confirm
+	ASSERT_TRUE(first); ASSERT_TRUE(second); ASSERT_TRUE(third);
+	ASSERT_TRUE(stopping.IsStopped()); ASSERT_EQ(stopping.GetBestIteration(), 3);
+}
+
+/**
+ * @brief Confirm that reaching the target score stops training straight away, and that no patience means no limit
+ */
+TEST(EarlyStopping_Test, target_score_stops)
+{
+	// Setup
+	auto stopping = NVL_AI::EarlyStopping(0, 0, 1e-4);
+
+	// Execute and Confirm
+	for (auto i = 0; i < 100; i++) stopping.Update(i, 1.0);
+	ASSERT_FALSE(stopping.IsStopped());
+
+	stopping.Update(100, 5e-5);
+	ASSERT_TRUE(stopping.IsStopped()); ASSERT_EQ(stopping.GetReason(), "target score reached");
+}
@@ -0,0 +1,185 @@
+//--------------------------------------------------
+// Unit Tests for the training Engine and resuming a run from its checkpoint
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/CheckpointWriter.h>
+#include <NeuralMLPLib/Scorer.h>
+
+#include <NeuralMLP/Engine.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateResumeData();
+void WriteEngineData(const string& path, int rows);
+NVLib::Parameters * CreateEngineParameters(const string& dataPath, const string& outputPath, int iterations);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that once the first iteration has sized the buffers, the engine's training loop (training, scoring
+ * and handing the checkpoint state over to the writer) makes no heap allocations
+ */
+TEST(Engine_Test, training_loop_is_allocation_free)
+{
+	// Setup
+	WriteEngineData("engine.arff", 200);
+	if (NVLib::FileUtils::Exists("engine_model.nmlp")) NVLib::FileUtils::Remove("engine_model.nmlp");
+	auto logger = NVLib::Logger(2);
+	auto engine = NVL_App::Engine(&logger, CreateEngineParameters("engine.arff", "engine_model.nmlp", 8));
+
+	// Execute
+	engine.Run();
+
+	// Confirm
+	ASSERT_EQ(engine.GetLoopAllocations().Count, 0); ASSERT_EQ(engine.GetLoopAllocations().Bytes, 0);
+	ASSERT_TRUE(NVLib::FileUtils::Exists("engine_model.nmlp"));
+}
+
+/**
+ * @brief Confirm that a saved network loads with its weights and scaling intact and carries on training from them
+ */
+TEST(Engine_Test, resume_from_saved_model)
+{
+	// Setup a trained network and save it
+	auto data = CreateResumeData();
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "native"; settings.Structure = "10"; settings.LearnRate = 0.1; settings.Epochs = 50;
+	auto network = NVL_AI::NetworkFactory::Create(settings, 2);
+	network->Train(data, false);
+	NVL_AI::NeuralUtils::SaveModel("resume_model.nmlp", *network->GetModel(), true);
+
+	// Execute
+	auto resumed = NVL_AI::NetworkFactory::Load(settings, "resume_model.nmlp");
+	Mat expected; network->Predict(data->GetInputs(), expected);
+	Mat actual; resumed->Predict(data->GetInputs(), actual);
+
+	auto before = NVL_AI::NeuralUtils::GetScore(data, resumed);
+	for (auto i = 0; i < 5; i++) resumed->Train(data, true);
+	auto after = NVL_AI::NeuralUtils::GetScore(data, resumed);
+
+	// Confirm that the loaded network starts where the original was and carries on improving
+	for (auto row = 0; row < 4; row++) ASSERT_EQ(actual.at<float>(row), expected.at<float>(row));
+	ASSERT_LT(after, before);
+	ASSERT_EQ(resumed->GetModel()->GetLayerSizes(), (vector<int> { 2, 10, 1 }));
+
+	// Free working variables
+	delete data;
+}
+
+/**
+ * @brief Confirm that a saved model resumes under the OpenCV backend without a state file, which scores the loaded
+ * network before training it any further
+ */
+TEST(Engine_Test, resume_opencv_without_state)
+{
+	// Setup a trained network, saved without a state file
+	auto data = CreateResumeData();
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "native"; settings.Structure = "10"; settings.LearnRate = 0.1; settings.Epochs = 50;
+	auto network = NVL_AI::NetworkFactory::Create(settings, 2);
+	network->Train(data, false);
+	NVL_AI::NeuralUtils::SaveModel("resume_opencv.nmlp", *network->GetModel(), true);
+	remove(NVL_AI::CheckpointWriter::GetStatePath("resume_opencv.nmlp").c_str());
+
+	// Execute
+	settings.Backend = "opencv";
+	auto resumed = NVL_AI::NetworkFactory::Load(settings, "resume_opencv.nmlp");
+	auto state = NVL_AI::CheckpointState();
+	auto hasState = NVL_AI::CheckpointWriter::ReadState(NVL_AI::CheckpointWriter::GetStatePath("resume_opencv.nmlp"), state);
+	auto score = NVL_AI::Scorer(data, 1).Evaluate(resumed).Total;
+	Mat expected; network->Predict(data->GetInputs(), expected);
+	Mat actual; resumed->Predict(data->GetInputs(), actual);
+	resumed->Train(data, true);
+
+	// Confirm
+	ASSERT_FALSE(hasState);
+	ASSERT_NEAR(score, NVL_AI::NeuralUtils::GetScore(data, network), 1e-4);
+	for (auto row = 0; row < 4; row++) ASSERT_NEAR(actual.at<float>(row), expected.at<float>(row), 1e-4);
+
+	// Free working variables
+	delete data;
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create the XOR training set that the resume tests train on
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateResumeData()
+{
+	Mat inputs = Mat_<float>(4, 2); Mat outputs = Mat_<float>(4, 1);
+
+	for (auto row = 0; row < 4; row++)
+	{
+		inputs.at<float>(row, 0) = (float) (row / 2); inputs.at<float>(row, 1) = (float) (row % 2);
+		outputs.at<float>(row) = (float) ((row / 2) ^ (row % 2));
+	}
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
+
+/**
+ * @brief Write a small dataset with a smooth relationship between two inputs and the class
+ * @param path The path that we are writing to
+ * @param rows The number of rows
+ */
+void WriteEngineData(const string& path, int rows)
+{
+	Mat data = Mat_<double>::zeros(rows, 3);
+	for (auto row = 0; row < rows; row++)
+	{
+		auto x = (row % 17) / 17.0; auto y = (row % 11) / 11.0;
+		data.at<double>(row, 0) = x; data.at<double>(row, 1) = y; data.at<double>(row, 2) = x * 2 - y;
+	}
+
+	if (NVLib::FileUtils::Exists(path)) NVLib::FileUtils::Remove(path);
+	NVL_AI::NeuralUtils::WriteData(path, "engine", "Unit test dataset for the engine", data);
+}
+
+/**
+ * @brief Write a configuration that trains a small native network on a dataset, and load it
+ * @param dataPath The path to the dataset
+ * @param outputPath The path that the model is saved to
+ * @param iterations The number of iterations
+ * @return NVLib::Parameters * The loaded parameters (which the engine takes over)
+ */
+NVLib::Parameters * CreateEngineParameters(const string& dataPath, const string& outputPath, int iterations)
+{
+	auto configPath = string("engine_config.xml");
+
+	{
+		auto writer = ofstream(configPath);
+		writer << "<?xml version=\"1.0\"?>" << endl << "<opencv_storage>" << endl;
+		writer << "    <input>\"" << dataPath << "\"</input>" << endl;
+		writer << "    <data_cache>\"false\"</data_cache>" << endl;
+		writer << "    <backend>\"native\"</backend>" << endl;
+		writer << "    <ann_config>\"8,8\"</ann_config>" << endl;
+		writer << "    <iterations>\"" << iterations << "\"</iterations>" << endl;
+		writer << "    <output>\"" << outputPath << "\"</output>" << endl;
+		writer << "    <learn_rate>\"0.01\"</learn_rate>" << endl;
+		writer << "    <optimizer>\"adam\"</optimizer>" << endl;
+		writer << "    <batch_size>\"8\"</batch_size>" << endl;
+		writer << "    <epochs>\"2\"</epochs>" << endl;
+		writer << "    <target_score>\"0\"</target_score>" << endl;
+		writer << "</opencv_storage>" << endl;
+	}
+
+	return NVLib::ParameterLoader::Load(configPath);
+}
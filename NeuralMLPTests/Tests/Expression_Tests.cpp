@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// Unit Tests for Expression
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/Expression.h>
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the expression behind problem.arff evaluates correctly
+ */
+TEST(Expression_Test, problem_expression)
+{
+	// Setup
+	auto expression = NVL_AI::Expression("(p[0] * p[1]) - p[2]");
+	float values[] = { 3, 4, 5 };
+
+	// Execute
+	auto result = expression.Evaluate(values);
+
+	// Confirm
+	ASSERT_EQ(expression.GetVariableCount(), 3);
+	ASSERT_DOUBLE_EQ(result, 7);
+}
+
+/**
+ * @brief Confirm operator precedence, unary minus, powers and functions
+ */
+TEST(Expression_Test, precedence_and_functions)
+{
+	float values[] = { 2, 9 };
+
+	ASSERT_DOUBLE_EQ(NVL_AI::Expression("1 + 2 * 3").Evaluate(values), 7);
+	ASSERT_DOUBLE_EQ(NVL_AI::Expression("10 - 4 - 3").Evaluate(values), 3);
+	ASSERT_DOUBLE_EQ(NVL_AI::Expression("2 ^ 3 ^ 2").Evaluate(values), 512);
+	ASSERT_DOUBLE_EQ(NVL_AI::Expression("-p[0] ^ 2").Evaluate(values), -4);
+	ASSERT_DOUBLE_EQ(NVL_AI::Expression("sqrt(p[1]) + abs(-1.5e1)").Evaluate(values), 18);
+	ASSERT_NEAR(NVL_AI::Expression("sin(p[0]) * cos(p[0])").Evaluate(values), sin(2.0) * cos(2.0), 1e-12);
+}
+
+/**
+ * @brief Confirm that broken expressions are rejected
+ */
+TEST(Expression_Test, reject_bad_syntax)
+{
+	ASSERT_THROW(NVL_AI::Expression("p[0] +"), runtime_error);
+	ASSERT_THROW(NVL_AI::Expression("(p[0]"), runtime_error);
+	ASSERT_THROW(NVL_AI::Expression("q[0]"), runtime_error);
+	ASSERT_THROW(NVL_AI::Expression("p[0] p[1]"), runtime_error);
+}
@@ -0,0 +1,196 @@
+//--------------------------------------------------
+// Unit Tests for MathKernels
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NeuralMLPLib/MathKernels.h>
+#include <NeuralMLPLib/MathKernelTable.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+Mat CreateMatrix(int rows, int cols);
+double ReferenceProduct(Mat& a, Mat& b, int row, int column, bool transA, bool transB);
+vector<NVL_AI::MathKernelTable> GetSupportedKernels();
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the blocked products match a plain triple loop, including ragged tiles and the k blocking
+ */
+TEST(MathKernels_Test, products_match_reference)
+{
+	for (auto m : { 1, 4, 7 }) for (auto n : { 1, 13, 60, 300 }) for (auto k : { 3, 61, 200 })
+	{
+		Mat a = CreateMatrix(m, k); Mat at = a.t(); Mat b = CreateMatrix(k, n); Mat bt = b.t();
+		Mat c1 = CreateMatrix(m, n); Mat c2 = c1.clone(); Mat c3 = c1.clone(); Mat initial = c1.clone();
+
+		NVL_AI::MathKernels::Multiply((float *) a.data, k, (float *) b.data, n, (float *) c1.data, n, m, n, k, true);
+		NVL_AI::MathKernels::MultiplyTransA((float *) at.data, m, (float *) b.data, n, (float *) c2.data, n, m, n, k, false);
+		NVL_AI::MathKernels::MultiplyTransB((float *) a.data, k, (float *) bt.data, k, (float *) c3.data, n, m, n, k);
+
+		for (auto row = 0; row < m; row++) for (auto column = 0; column < n; column++)
+		{
+			auto expected = ReferenceProduct(a, b, row, column, false, false);
+			ASSERT_NEAR(c1.at<float>(row, column), expected + initial.at<float>(row, column), 1e-3);
+			ASSERT_NEAR(c2.at<float>(row, column), ReferenceProduct(at, b, row, column, true, false), 1e-3);
+			ASSERT_NEAR(c3.at<float>(row, column), ReferenceProduct(a, bt, row, column, false, true), 1e-3);
+		}
+	}
+}
+
+/**
+ * @brief Confirm that the fused bias and sigmoid matches the closed form, including saturated inputs
+ */
+TEST(MathKernels_Test, sigmoid_matches_reference)
+{
+	const float alpha = 2.0f / 3.0f, beta = 1.7159f;
+
+	Mat data = Mat_<float>(3, 37); randu(data, -200, 200); Mat bias = CreateMatrix(1, 37);
+	Mat expected = data.clone();
+	NVL_AI::MathKernels::SigmoidSym((float *) data.data, 37, (float *) bias.data, 3, 37, alpha, beta);
+
+	for (auto row = 0; row < 3; row++) for (auto column = 0; column < 37; column++)
+	{
+		auto e = exp(-alpha * ((double) expected.at<float>(row, column) + bias.at<float>(0, column)));
+		auto value = isinf(e) ? -beta : beta * (1 - e) / (1 + e);
+		ASSERT_NEAR(data.at<float>(row, column), value, 1e-5);
+	}
+}
+
+/**
+ * @brief Confirm that the kernels picked at run time are the widest set that this CPU supports
+ */
+TEST(MathKernels_Test, dispatch_picks_widest_supported)
+{
+	// Execute
+	auto name = NVL_AI::MathKernels::GetInstructionSet();
+
+	// Confirm
+	ASSERT_EQ(name, string(GetSupportedKernels().back().Name));
+	ASSERT_EQ(NVL_AI::MathKernels::GetInt8InstructionSet(), string(GetSupportedKernels().back().Int8Name));
+}
+
+/**
+ * @brief Confirm that every instruction set this CPU can run gives the same results as the scalar kernels
+ */
+TEST(MathKernels_Test, instruction_sets_match_scalar)
+{
+	auto scalar = NVL_AI::GetScalarKernels();
+	Mat a = CreateMatrix(7, 61); Mat b = CreateMatrix(61, 60); Mat bias = CreateMatrix(1, 60);
+
+	Mat expected = Mat_<float>(7, 60);
+	scalar.Multiply((float *) a.data, 61, (float *) b.data, 60, (float *) expected.data, 60, 7, 60, 61, false);
+	scalar.SigmoidSym((float *) expected.data, 60, (float *) bias.data, 7, 60, 2.0f / 3.0f, 1.7159f);
+
+	for (auto& kernels : GetSupportedKernels())
+	{
+		Mat actual = Mat_<float>(7, 60);
+		kernels.Multiply((float *) a.data, 61, (float *) b.data, 60, (float *) actual.data, 60, 7, 60, 61, false);
+		kernels.SigmoidSym((float *) actual.data, 60, (float *) bias.data, 7, 60, 2.0f / 3.0f, 1.7159f);
+
+		for (auto row = 0; row < 7; row++) for (auto column = 0; column < 60; column++)
+		{
+			ASSERT_NEAR(actual.at<float>(row, column), expected.at<float>(row, column), 1e-4) << kernels.Name;
+		}
+	}
+}
+
+/**
+ * @brief Confirm that the packed INT8 product is exact for every instruction set this CPU can run, including the ragged
+ * column blocks and input groups
+ */
+TEST(MathKernels_Test, int8_product_is_exact)
+{
+	auto random = mt19937(7); auto bytes = uniform_int_distribution<int>(0, 255); auto weights = uniform_int_distribution<int>(-127, 127);
+
+	for (auto m : { 1, 5 }) for (auto n : { 1, 16, 37 }) for (auto k : { 3, 64, 130 })
+	{
+		auto stride = (k + 3) / 4 * 4;
+		auto a = vector<uint8_t>(m * stride); for (auto& value : a) value = (uint8_t) bytes(random);
+		auto b = vector<int8_t>(k * n); for (auto& value : b) value = (int8_t) weights(random);
+		auto packed = vector<int8_t>(NVL_AI::MathKernels::GetPackedInt8Size(n, k));
+		auto c = vector<int32_t>(m * n);
+
+		NVL_AI::MathKernels::PackInt8(b.data(), n, n, k, packed.data());
+
+		for (auto& kernels : GetSupportedKernels())
+		{
+			kernels.MultiplyInt8(a.data(), stride, packed.data(), c.data(), n, m, n, k);
+
+			for (auto row = 0; row < m; row++) for (auto column = 0; column < n; column++)
+			{
+				auto expected = 0; for (auto p = 0; p < k; p++) expected += a[row * stride + p] * b[p * n + column];
+				ASSERT_EQ(c[row * n + column], expected) << kernels.Int8Name;
+			}
+		}
+	}
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a random float matrix
+ * @param rows The number of rows
+ * @param cols The number of columns
+ * @return Mat The resultant matrix
+ */
+Mat CreateMatrix(int rows, int cols)
+{
+	Mat result = Mat_<float>(rows, cols); randu(result, -1, 1);
+	return result;
+}
+
+/**
+ * @brief Find an element of a matrix product with a plain loop
+ * @param a The left-hand matrix
+ * @param b The right-hand matrix
+ * @param row The row of the element
+ * @param column The column of the element
+ * @param transA Whether the left-hand matrix is used transposed
+ * @param transB Whether the right-hand matrix is used transposed
+ * @return double The element
+ */
+double ReferenceProduct(Mat& a, Mat& b, int row, int column, bool transA, bool transB)
+{
+	auto result = 0.0; auto k = transA ? a.rows : a.cols;
+
+	for (auto p = 0; p < k; p++)
+	{
+		auto left = transA ? a.at<float>(p, row) : a.at<float>(row, p);
+		auto right = transB ? b.at<float>(column, p) : b.at<float>(p, column);
+		result += (double) left * right;
+	}
+
+	return result;
+}
+
+/**
+ * @brief Retrieve the kernels of every instruction set that this CPU can run, from the narrowest to the widest
+ * @return vector<NVL_AI::MathKernelTable> The kernels
+ */
+vector<NVL_AI::MathKernelTable> GetSupportedKernels()
+{
+	auto result = vector<NVL_AI::MathKernelTable> { NVL_AI::GetScalarKernels() };
+
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) result.push_back(NVL_AI::GetAVX2Kernels());
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma")) result.push_back(NVL_AI::GetAVX512Kernels());
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("fma")) result.push_back(NVL_AI::GetVNNIKernels());
+
+	return result;
+}
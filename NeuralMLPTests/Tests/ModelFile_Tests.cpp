@@ -0,0 +1,147 @@
+//--------------------------------------------------
+// Unit Tests for ModelFile
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/ModelFile.h>
+#include <NeuralMLPLib/NativeNetwork.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+Ptr<NVL_AI::ModelData> CreateRandomModel();
+void CompareModels(NVL_AI::ModelData& expected, NVL_AI::ModelData& actual);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a model written in the binary format maps back with exactly the same values
+ */
+TEST(ModelFile_Test, binary_round_trip)
+{
+	// Setup
+	auto expected = CreateRandomModel();
+
+	// Execute
+	NVL_AI::ModelFile::Write("model_test.nmlp", *expected);
+	auto file = NVL_AI::ModelFile("model_test.nmlp");
+
+	// Confirm
+	ASSERT_TRUE(NVL_AI::ModelFile::IsModelFile("model_test.nmlp"));
+	ASSERT_TRUE(NVL_AI::ModelFile::IsBinaryPath("model_test.nmlp"));
+	ASSERT_FALSE(NVL_AI::ModelFile::IsBinaryPath("model_test.xml"));
+	ASSERT_EQ(file.GetLayerSizes(), expected->GetLayerSizes());
+	ASSERT_EQ((uintptr_t) file.GetInferenceWeights(1).data % 64, 0);
+	CompareModels(*expected, *file.GetModel());
+}
+
+/**
+ * @brief Confirm that a native network running from the mapped weights predicts the same as one built from the model
+ */
+TEST(ModelFile_Test, native_runs_from_mapped_weights)
+{
+	// Setup
+	auto model = CreateRandomModel();
+	NVL_AI::ModelFile::Write("model_native.nmlp", *model);
+	Mat inputs = Mat_<float>(10, 3); randu(inputs, -1, 1);
+
+	// Execute
+	auto loaded = NVL_AI::NativeNetwork(*model);
+	auto mapped = NVL_AI::NativeNetwork(Ptr<NVL_AI::ModelFile>(new NVL_AI::ModelFile("model_native.nmlp")));
+	Mat expected; loaded.Predict(inputs, expected);
+	Mat actual; mapped.Predict(inputs, actual);
+
+	// Confirm
+	for (auto row = 0; row < inputs.rows; row++) ASSERT_EQ(actual.at<float>(row, 0), expected.at<float>(row, 0));
+}
+
+/**
+ * @brief Confirm that converting to XML and back to binary gives back exactly the same weights
+ */
+TEST(ModelFile_Test, xml_conversion_is_lossless)
+{
+	// Setup
+	auto expected = CreateRandomModel();
+	NVL_AI::ModelFile::Write("model_convert.nmlp", *expected);
+
+	// Execute
+	NVL_AI::NeuralUtils::ConvertModel("model_convert.nmlp", "model_convert.xml");
+	NVL_AI::NeuralUtils::ConvertModel("model_convert.xml", "model_convert_back.nmlp");
+
+	// Confirm
+	ASSERT_FALSE(NVL_AI::ModelFile::IsModelFile("model_convert.xml"));
+	auto file = NVL_AI::ModelFile("model_convert_back.nmlp");
+	CompareModels(*expected, *file.GetModel());
+}
+
+/**
+ * @brief Confirm that a model loaded into the OpenCV backend from either format can predict straight away
+ */
+TEST(ModelFile_Test, opencv_loads_and_predicts)
+{
+	// Setup
+	auto model = CreateRandomModel();
+	NVL_AI::ModelFile::Write("model_opencv.nmlp", *model);
+	NVL_AI::NeuralUtils::SaveModel("model_opencv.xml", *model, false);
+	Mat inputs = Mat_<float>(10, 3); randu(inputs, -1, 1);
+	auto reference = NVL_AI::NativeNetwork(*model);
+	Mat expected; reference.Predict(inputs, expected);
+
+	// Execute
+	auto binary = NVL_AI::NetworkFactory::Load("opencv", "model_opencv.nmlp");
+	auto xml = NVL_AI::NetworkFactory::Load("opencv", "model_opencv.xml");
+	Mat binaryOutput; binary->Predict(inputs, binaryOutput);
+	Mat xmlOutput; xml->Predict(inputs, xmlOutput);
+
+	// Confirm
+	for (auto row = 0; row < inputs.rows; row++)
+	{
+		ASSERT_NEAR(binaryOutput.at<float>(row, 0), expected.at<float>(row, 0), 1e-4);
+		ASSERT_NEAR(xmlOutput.at<float>(row, 0), expected.at<float>(row, 0), 1e-4);
+	}
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a 3-5-4-1 model filled with random weights
+ * @return Ptr<NVL_AI::ModelData> The resultant model
+ */
+Ptr<NVL_AI::ModelData> CreateRandomModel()
+{
+	auto result = Ptr<NVL_AI::ModelData>(new NVL_AI::ModelData(vector<int> { 3, 5, 4, 1 }, 0.1));
+	for (auto i = 0; i < result->GetLayerCount() + 2; i++) randu(result->GetWeights(i), -1, 1);
+	return result;
+}
+
+/**
+ * @brief Confirm that two models hold exactly the same settings and weights
+ * @param expected The model that we expect
+ * @param actual The model that we got
+ */
+void CompareModels(NVL_AI::ModelData& expected, NVL_AI::ModelData& actual)
+{
+	ASSERT_EQ(actual.GetLayerSizes(), expected.GetLayerSizes());
+	ASSERT_EQ(actual.GetLearnRate(), expected.GetLearnRate());
+	ASSERT_EQ(actual.GetAlpha(), expected.GetAlpha());
+	ASSERT_EQ(actual.GetBeta(), expected.GetBeta());
+
+	for (auto i = 0; i < expected.GetLayerCount() + 2; i++)
+	{
+		auto& left = expected.GetWeights(i); auto& right = actual.GetWeights(i);
+		ASSERT_EQ(right.rows, left.rows); ASSERT_EQ(right.cols, left.cols);
+		for (auto row = 0; row < left.rows; row++) for (auto column = 0; column < left.cols; column++) ASSERT_EQ(right.at<double>(row, column), left.at<double>(row, column)) << "Block " << i;
+	}
+}
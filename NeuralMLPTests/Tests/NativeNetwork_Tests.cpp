@@ -0,0 +1,179 @@
+//--------------------------------------------------
+// Unit Tests for NativeNetwork
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/NativeNetwork.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateXorData();
+void RandomizeWeights(Ptr<ml::ANN_MLP>& network);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the native backend predicts the same values as ANN_MLP when given the same weights
+ */
+TEST(NativeNetwork_Test, predict_matches_opencv)
+{
+	// Setup an OpenCV network with some arbitrary weights and scaling
+	auto network = NVL_AI::NeuralUtils::CreateNetwork("60,60,60", 1e-2, 3);
+	RandomizeWeights(network);
+
+	// Load the same weights into the native backend, and read them back into ANN_MLP (which only predicts once read or trained)
+	auto model = NVL_AI::ModelData(network);
+	auto native = NVL_AI::NativeNetwork(model, 2);
+	auto reference = NVL_AI::NeuralUtils::ReadNetwork(model);
+
+	// Predict with both
+	Mat inputs = Mat_<float>(1000, 3); randu(inputs, -10, 10);
+	Mat expected; reference->predict(inputs, expected);
+	Mat actual; native.Predict(inputs, actual);
+
+	// Confirm that the outputs agree
+	ASSERT_EQ(actual.rows, expected.rows);
+	for (auto row = 0; row < actual.rows; row++) ASSERT_NEAR(actual.at<float>(row), expected.at<float>(row), 1e-4 * max(1.0f, abs(expected.at<float>(row))));
+}
+
+/**
+ * @brief Confirm that a model snapshot carries the weights and scaling across unchanged
+ */
+TEST(NativeNetwork_Test, model_round_trip)
+{
+	// Create and train a network
+	auto data = CreateXorData();
+	auto network = NVL_AI::NativeNetwork(vector<int> { 2, 5, 1 }, 1e-1);
+	network.Train(data, false);
+
+	// Take a snapshot and load it into a second network
+	auto model = network.GetModel();
+	auto copy = NVL_AI::NativeNetwork(*model);
+
+	// Confirm that the snapshot holds the ANN_MLP layout and that both networks agree
+	ASSERT_EQ(model->GetWeights(1).rows, 3); ASSERT_EQ(model->GetWeights(1).cols, 5);
+	ASSERT_EQ(model->GetInputScale().cols, 4); ASSERT_EQ(model->GetOutputScale().cols, 2);
+
+	Mat expected; network.Predict(data->GetInputs(), expected);
+	Mat actual; copy.Predict(data->GetInputs(), actual);
+	for (auto row = 0; row < 4; row++) ASSERT_EQ(actual.at<float>(row), expected.at<float>(row));
+
+	// Free working variables
+	delete data;
+}
+
+/**
+ * @brief Confirm that the native backend learns the XOR problem used by the NeuralUtils tests
+ */
+TEST(NativeNetwork_Test, learns_xor)
+{
+	// Create the network through the factory, as the engine does
+	auto data = CreateXorData();
+	auto network = NVL_AI::NetworkFactory::Create("native", "10,10", 1e-1, 2);
+
+	// Train until the network has settled
+	network->Train(data, false);
+	for (auto i = 0; i < 100; i++) network->Train(data, true);
+
+	// Validate
+	auto score = NVL_AI::NeuralUtils::GetScore(data, network);
+	ASSERT_NEAR(score, 0, 1e-1);
+
+	// Free working variables
+	delete data;
+}
+
+/**
+ * @brief Confirm that each optimizer learns the XOR problem with mini-batches
+ */
+TEST(NativeNetwork_Test, optimizers_learn_xor)
+{
+	auto data = CreateXorData();
+
+	for (auto optimizer : { "momentum", "adam", "rmsprop" })
+	{
+		// Create the network with a batch that covers the whole dataset
+		auto settings = NVL_AI::NetworkSettings();
+		settings.Backend = "native"; settings.Structure = "10,10"; settings.LearnRate = 0.05;
+		settings.Optimizer = optimizer; settings.BatchSize = 4; settings.Epochs = 200;
+		auto network = NVL_AI::NetworkFactory::Create(settings, 2);
+
+		// Train
+		network->Train(data, false);
+		for (auto i = 0; i < 20; i++) network->Train(data, true);
+
+		// Validate
+		ASSERT_LT(NVL_AI::NeuralUtils::GetScore(data, network), 0.2) << optimizer;
+	}
+
+	// Free working variables
+	delete data;
+}
+
+/**
+ * @brief Confirm that only the BACKPROP style optimizers have their learning rate bounded, and that the rate given to
+ * an adaptive optimizer is the one saved with the model
+ */
+TEST(NativeNetwork_Test, learn_rate_bounds_follow_optimizer)
+{
+	// Setup
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "native"; settings.Structure = "4"; settings.LearnRate = 1e-4;
+
+	// Execute
+	settings.Optimizer = "backprop"; auto backprop = NVL_AI::NetworkFactory::Create(settings, 2);
+	settings.Optimizer = "adam"; auto adam = NVL_AI::NetworkFactory::Create(settings, 2);
+	settings.Optimizer = "rmsprop"; auto rmsprop = NVL_AI::NetworkFactory::Create(settings, 2);
+
+	// Confirm
+	ASSERT_EQ(backprop->GetModel()->GetLearnRate(), 1e-3);
+	ASSERT_EQ(adam->GetModel()->GetLearnRate(), 1e-4);
+	ASSERT_EQ(rmsprop->GetModel()->GetLearnRate(), 1e-4);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create the XOR training set
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateXorData()
+{
+	Mat inputs = Mat_<float>(4, 2); Mat outputs = Mat_<float>(4, 1);
+
+	for (auto row = 0; row < 4; row++)
+	{
+		inputs.at<float>(row, 0) = (float) (row / 2); inputs.at<float>(row, 1) = (float) (row % 2);
+		outputs.at<float>(row) = (float) ((row / 2) ^ (row % 2));
+	}
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
+
+/**
+ * @brief Fill every weight block of a network (including the scaling) with random values
+ * @param network The network that we are updating
+ */
+void RandomizeWeights(Ptr<ml::ANN_MLP>& network)
+{
+	auto layerCount = network->getLayerSizes().rows;
+
+	for (auto i = 0; i < layerCount + 2; i++)
+	{
+		Mat weights = network->getWeights(i);
+		randu(weights, -0.5, 0.5);
+	}
+}
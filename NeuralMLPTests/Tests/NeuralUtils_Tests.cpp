@@ -154,6 +154,29 @@ TEST(NeuralUtils_Test, test_training)
 	delete trainData;
 }
 
+/**
+ * Confirm that a validation split holds out the given share of rows, with no row on both sides
+ */
+TEST(NeuralUtils_Test, split_data)
+{
+	// Setup
+	Mat inputs = Mat_<float>(100, 2); randu(inputs, 0, 1);
+	Mat outputs = Mat_<float>(100, 1); randu(outputs, 0, 1);
+	auto data = NVL_AI::TrainData(inputs, outputs);
+
+	// Execute
+	Ptr<NVL_AI::TrainData> trainData, validationData;
+	NVL_AI::NeuralUtils::SplitData(&data, 0.2, 7, trainData, validationData);
+
+	// Confirm
+	ASSERT_EQ(validationData->GetRowCount(), 20); ASSERT_EQ(trainData->GetRowCount(), 80);
+	auto counts = vector<int>(100, 0);
+	for (auto row : trainData->GetRows()) counts[row]++;
+	for (auto row : validationData->GetRows()) counts[row]++;
+	for (auto count : counts) ASSERT_EQ(count, 1);
+	ASSERT_THROW(NVL_AI::NeuralUtils::SplitData(&data, 0, 7, trainData, validationData), runtime_error);
+}
+
 //--------------------------------------------------
 // Helper Methods
 //--------------------------------------------------
@@ -0,0 +1,155 @@
+//--------------------------------------------------
+// Unit Tests for Normalizer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/Normalizer.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/AllocationCounter.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+Mat BuildColumns(int rows);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the statistics gathered across threads match the ones worked out by hand
+ */
+TEST(Normalizer_Test, parallel_stats_match)
+{
+	// Setup
+	auto data = BuildColumns(20000);
+
+	// Execute
+	auto serial = NVL_AI::Normalizer::GetStats(data, vector<int>(), 1);
+	auto parallel = NVL_AI::Normalizer::GetStats(data, vector<int>(), 4);
+
+	// Confirm
+	ASSERT_NEAR(parallel.at<double>(0, 0), 9999.5, 1e-6);
+	ASSERT_NEAR(parallel.at<double>(0, 1), 3589.0, 1e-6);
+	ASSERT_NEAR(parallel.at<double>(1, 1), 0.0, 1e-6);
+	ASSERT_EQ(parallel.at<double>(2, 0), 0.0); ASSERT_EQ(parallel.at<double>(3, 0), 19999.0);
+	for (auto row = 0; row < 4; row++) for (auto column = 0; column < 2; column++) ASSERT_NEAR(parallel.at<double>(row, column), serial.at<double>(row, column), 1e-6);
+}
+
+/**
+ * @brief Confirm that the outputs are mapped onto [-0.95, 0.95] and restored again, and the inputs are standardized
+ */
+TEST(Normalizer_Test, outputs_round_trip)
+{
+	// Setup
+	Mat inputs = BuildColumns(100); Mat outputs = inputs.col(0).clone();
+	for (auto row = 0; row < 100; row++) outputs.at<float>(row, 0) += 3000;
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	auto normalizer = NVL_AI::Normalizer();
+
+	// Execute
+	normalizer.Fit(&data);
+	Mat scaledInputs; normalizer.TransformInputs(inputs, vector<int>(), scaledInputs);
+	Mat scaledOutputs; normalizer.TransformOutputs(outputs, vector<int>(), scaledOutputs);
+	Mat restored = scaledOutputs.clone(); normalizer.RestoreOutputs(restored);
+
+	// Confirm
+	auto stats = NVL_AI::Normalizer::GetStats(scaledInputs, vector<int>());
+	ASSERT_NEAR(stats.at<double>(0, 0), 0, 1e-4); ASSERT_NEAR(stats.at<double>(1, 0), 1, 1e-4);
+	ASSERT_NEAR(scaledInputs.at<float>(50, 1), 0, 1e-4);
+	ASSERT_NEAR(scaledOutputs.at<float>(0, 0), -0.95, 1e-5); ASSERT_NEAR(scaledOutputs.at<float>(99, 0), 0.95, 1e-5);
+	for (auto row = 0; row < 100; row++) ASSERT_NEAR(restored.at<float>(row, 0), outputs.at<float>(row, 0), 1e-3);
+}
+
+/**
+ * @brief Confirm that a view is scaled from its own rows, and that cached statistics are used instead of a pass
+ */
+TEST(Normalizer_Test, views_and_cached_stats)
+{
+	// Setup
+	Mat inputs = BuildColumns(100); Mat outputs = inputs.col(0).clone();
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	auto view = NVL_AI::TrainData(&data, vector<int> { 10, 20 });
+	auto normalizer = NVL_AI::Normalizer("minmax", "minmax");
+
+	// Execute
+	normalizer.Fit(&view);
+	Mat scaled; normalizer.TransformInputs(inputs, view.GetRows(), scaled);
+
+	Mat cached = NVL_AI::Normalizer::GetStats(outputs, vector<int>()); cached.at<double>(2, 0) = -100; cached.at<double>(3, 0) = 100;
+	data.SetStats(cached, cached);
+	auto other = NVL_AI::Normalizer("none", "minmax");
+	other.Fit(&data);
+
+	// Confirm
+	ASSERT_EQ(scaled.rows, 2);
+	ASSERT_NEAR(scaled.at<float>(0, 0), -1, 1e-5); ASSERT_NEAR(scaled.at<float>(1, 0), 1, 1e-5);
+	ASSERT_FALSE(view.HasStats()); ASSERT_TRUE(data.HasStats());
+	ASSERT_NEAR(other.GetInverseOutputScale().at<double>(0, 0), 1.9 / 200, 1e-9);
+	ASSERT_EQ(other.GetInputScale().at<double>(0, 0), 1.0);
+	ASSERT_THROW(NVL_AI::Normalizer("zscore", "minmax"), runtime_error);
+}
+
+/**
+ * @brief Confirm that once the buffers are sized, scaling inputs and restoring outputs make no heap allocations
+ */
+TEST(Normalizer_Test, transforms_do_not_allocate)
+{
+	// Setup
+	Mat inputs = BuildColumns(100); Mat outputs = inputs.col(0).clone();
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	auto normalizer = NVL_AI::Normalizer("standard", "minmax");
+	normalizer.Fit(&data);
+	Mat scaled; normalizer.TransformInputs(inputs, vector<int>(), scaled);
+	Mat restored = outputs.clone();
+
+	// Execute
+	auto start = NVL_AI::AllocationCounter::GetStats();
+	for (auto i = 0; i < 10; i++) { normalizer.TransformInputs(inputs, vector<int>(), scaled); normalizer.RestoreOutputs(restored); }
+	auto change = NVL_AI::AllocationCounter::GetChange(start);
+
+	// Confirm
+	ASSERT_EQ(change.Count, 0);
+}
+
+/**
+ * @brief Confirm that the OpenCV backend trains on a scaled copy, leaving the rows as they were and reporting the size of the copy
+ */
+TEST(Normalizer_Test, opencv_trains_on_a_copy)
+{
+	// Setup
+	Mat inputs = BuildColumns(100); Mat outputs = inputs.col(0).clone();
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "opencv"; settings.Structure = "4"; settings.Epochs = 1;
+	auto network = NVL_AI::NetworkFactory::Create(settings, 2);
+
+	// Execute
+	network->Train(&data, false);
+
+	// Confirm
+	ASSERT_EQ(inputs.at<float>(99, 0), 99.0f); ASSERT_EQ(inputs.at<float>(99, 1), 3589.0f);
+	ASSERT_EQ(network->GetCopyBytes(), (size_t) (100 * 3 * sizeof(float)));
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a float matrix with a counting column and a constant column (which sits at the scale of problem.arff)
+ * @param rows The number of rows
+ * @return Mat The resultant matrix
+ */
+Mat BuildColumns(int rows)
+{
+	Mat result = Mat_<float>::zeros(rows, 2);
+	for (auto row = 0; row < rows; row++) { result.at<float>(row, 0) = (float) row; result.at<float>(row, 1) = 3589.0f; }
+	return result;
+}
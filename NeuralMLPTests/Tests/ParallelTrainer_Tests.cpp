@@ -0,0 +1,132 @@
+//--------------------------------------------------
+// Unit Tests for ParallelTrainer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/NeuralUtils.h>
+#include <NeuralMLPLib/NativeNetwork.h>
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/ParallelTrainer.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateParallelData(int rows);
+NVL_AI::NativeNetwork * CreateParallelNetwork(int batchSize);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that splitting each batch between threads gives the same updates as training on one thread
+ */
+TEST(ParallelTrainer_Test, sync_matches_serial)
+{
+	// Setup two identical networks, one of which trains across threads
+	auto data = CreateParallelData(203);
+	auto serial = CreateParallelNetwork(16); auto parallel = CreateParallelNetwork(16);
+	parallel->SetTrainer(Ptr<NVL_AI::ParallelTrainer>(new NVL_AI::ParallelTrainer(4, "sync")));
+
+	// Execute
+	serial->Train(data, false); parallel->Train(data, false);
+	for (auto i = 0; i < 5; i++) { serial->Train(data, true); parallel->Train(data, true); }
+
+	// Confirm that the weights agree (to the rounding of the different summation order)
+	auto& expected = serial->GetWeights(); auto& actual = parallel->GetWeights();
+	for (auto layer = 1; layer < (int) expected.size(); layer++)
+	{
+		for (auto i = 0; i < (int) expected[layer].total(); i++) ASSERT_NEAR(((float *) actual[layer].data)[i], ((float *) expected[layer].data)[i], 1e-4);
+	}
+
+	ASSERT_EQ(parallel->GetTrainer()->GetThreadCount(), 4);
+
+	// Free working variables
+	delete serial; delete parallel; delete data;
+}
+
+/**
+ * @brief Confirm that the lock-free mode still learns, through the factory as the engine sets it up
+ */
+TEST(ParallelTrainer_Test, hogwild_learns)
+{
+	// Setup
+	auto data = CreateParallelData(400);
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "native"; settings.Structure = "10"; settings.LearnRate = 0.1;
+	settings.BatchSize = 4; settings.Epochs = 100; settings.TrainThreads = 4; settings.TrainMode = "hogwild";
+	auto network = NVL_AI::NetworkFactory::Create(settings, 2);
+
+	// Execute
+	network->Train(data, false);
+	auto before = NVL_AI::NeuralUtils::GetScore(data, network);
+	for (auto i = 0; i < 5; i++) network->Train(data, true);
+	auto after = NVL_AI::NeuralUtils::GetScore(data, network);
+
+	// Confirm
+	ASSERT_LT(after, before);
+	ASSERT_THROW(NVL_AI::ParallelTrainer(2, "async"), runtime_error);
+
+	// Free working variables
+	delete data;
+}
+
+/**
+ * @brief Confirm that a sync batch is never split between more threads than it has rows
+ */
+TEST(ParallelTrainer_Test, sync_needs_rows_for_each_thread)
+{
+	// Setup
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "native"; settings.Structure = "10"; settings.LearnRate = 0.1;
+	settings.BatchSize = 1; settings.Epochs = 100; settings.TrainThreads = 4; settings.TrainMode = "sync";
+
+	// Confirm that the factory rejects the settings rather than quietly training on one thread
+	ASSERT_THROW(NVL_AI::NetworkFactory::Create(settings, 2), runtime_error);
+
+	// Confirm the number of workers that each mode runs on
+	ASSERT_EQ(NVL_AI::ParallelTrainer::GetWorkerCount(4, "sync", 1), 1);
+	ASSERT_EQ(NVL_AI::ParallelTrainer::GetWorkerCount(4, "sync", 16), 4);
+	ASSERT_EQ(NVL_AI::ParallelTrainer::GetWorkerCount(4, "hogwild", 1), 4);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a smooth two-input problem, y = sin(x0) * cos(x1)
+ * @param rows The number of rows
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateParallelData(int rows)
+{
+	Mat inputs = Mat_<float>(rows, 2); Mat outputs = Mat_<float>(rows, 1);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto x0 = (float) (row % 17) / 4.0f; auto x1 = (float) (row % 13) / 3.0f;
+		inputs.at<float>(row, 0) = x0; inputs.at<float>(row, 1) = x1;
+		outputs.at<float>(row) = sin(x0) * cos(x1);
+	}
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
+
+/**
+ * @brief Create a small native network that trains with plain mini-batch gradient descent
+ * @param batchSize The number of rows in each batch
+ * @return NVL_AI::NativeNetwork * The resultant network
+ */
+NVL_AI::NativeNetwork * CreateParallelNetwork(int batchSize)
+{
+	auto result = new NVL_AI::NativeNetwork(vector<int> { 2, 12, 8, 1 }, 0.1);
+	result->SetBatchSize(batchSize); result->SetMaxEpochs(20);
+	return result;
+}
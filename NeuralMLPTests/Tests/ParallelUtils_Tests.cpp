@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// Unit Tests for ParallelUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/ParallelUtils.h>
+#include <NeuralMLPLib/AllocationCounter.h>
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that every index runs, that a call made from inside a task still runs, and that repeated calls reuse the team without allocating
+ */
+TEST(ParallelUtils_Test, runs_every_index)
+{
+	// Setup
+	auto counts = vector<int>(4); auto nested = atomic<int>(0);
+	NVL_AI::ParallelUtils::Run(4, [&](int index) { counts[index]++; });
+
+	// Execute
+	auto start = NVL_AI::AllocationCounter::GetStats();
+	for (auto i = 0; i < 10; i++) NVL_AI::ParallelUtils::Run(4, [&](int index) { counts[index]++; });
+	auto change = NVL_AI::AllocationCounter::GetChange(start);
+
+	NVL_AI::ParallelUtils::Run(3, [&](int) { NVL_AI::ParallelUtils::Run(2, [&](int) { nested++; }); });
+
+	// Confirm
+	ASSERT_EQ(counts, (vector<int> { 11, 11, 11, 11 }));
+	ASSERT_EQ(change.Count, 0);
+	ASSERT_EQ(nested.load(), 6);
+}
+
+/**
+ * @brief Confirm that the failure of the lowest index is re-thrown, and that the team is free again afterwards
+ */
+TEST(ParallelUtils_Test, rethrows_failures)
+{
+	// Execute
+	auto message = string();
+	try { NVL_AI::ParallelUtils::Run(3, [](int index) { if (index > 0) throw runtime_error(to_string(index)); }); }
+	catch (runtime_error& error) { message = error.what(); }
+
+	auto total = atomic<int>(0);
+	NVL_AI::ParallelUtils::Run(3, [&](int index) { total += index; });
+
+	// Confirm
+	ASSERT_EQ(message, "1");
+	ASSERT_EQ(total.load(), 3);
+}
@@ -0,0 +1,96 @@
+//--------------------------------------------------
+// Unit Tests for QuantizedNetwork
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/NativeNetwork.h>
+#include <NeuralMLPLib/QuantizedNetwork.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+Ptr<NVL_AI::ModelData> BuildQuantizeModel();
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the INT8 network tracks the float network with either granularity of weight scales
+ */
+TEST(QuantizedNetwork_Test, predict_tracks_float)
+{
+	// Setup
+	auto model = BuildQuantizeModel(); auto native = NVL_AI::NativeNetwork(*model, 2);
+	Mat inputs = Mat_<float>(1000, 3); randu(inputs, -10, 10); Mat outputs = Mat_<float>::zeros(1000, 1);
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	Mat expected; native.Predict(inputs, expected);
+
+	for (auto granularity : { "channel", "layer" })
+	{
+		// Execute
+		auto network = NVL_AI::QuantizedNetwork(model, &data, granularity, 200, 2);
+		Mat actual; network.Predict(inputs, actual);
+
+		// Confirm
+		auto error = 0.0;
+		for (auto row = 0; row < actual.rows; row++) error = max(error, (double) abs(actual.at<float>(row) - expected.at<float>(row)));
+		ASSERT_EQ(actual.rows, 1000); ASSERT_LT(error, 0.05);
+		ASSERT_EQ(network.GetLayers().size(), 3); ASSERT_EQ(network.GetLayers()[0].Stride, 4);
+	}
+}
+
+/**
+ * @brief Confirm that the calibration sample is spread across the data and that the network refuses to train
+ */
+TEST(QuantizedNetwork_Test, calibration_and_errors)
+{
+	// Setup
+	auto model = BuildQuantizeModel();
+	Mat inputs = Mat_<float>(10, 3); randu(inputs, -10, 10); Mat outputs = Mat_<float>::zeros(10, 1);
+	auto data = NVL_AI::TrainData(inputs, outputs);
+
+	// Execute
+	auto sample = NVL_AI::QuantizedNetwork::GetSampleRows(&data, 4);
+	auto network = NVL_AI::QuantizedNetwork(model, &data);
+
+	// Confirm
+	ASSERT_EQ(sample, (vector<int> { 0, 2, 5, 7 }));
+	ASSERT_EQ(NVL_AI::QuantizedNetwork::GetSampleRows(&data, 0).size(), 10);
+	ASSERT_EQ(network.GetBackend(), "int8");
+	ASSERT_THROW(network.Train(&data, true), runtime_error);
+	ASSERT_THROW(NVL_AI::QuantizedNetwork(model, &data, "tensor"), runtime_error);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Build a 3-40-20-1 model with random weights and input scaling that brings the inputs into [-1, 1]
+ * @return Ptr<NVL_AI::ModelData> The resultant model
+ */
+Ptr<NVL_AI::ModelData> BuildQuantizeModel()
+{
+	auto result = Ptr<NVL_AI::ModelData>(new NVL_AI::ModelData(vector<int> { 3, 40, 20, 1 }, 0.01));
+	auto random = mt19937(11); auto values = uniform_real_distribution<double>(-0.5, 0.5);
+
+	for (auto layer = 1; layer < 4; layer++)
+	{
+		auto& weights = result->GetWeights(layer);
+		for (auto row = 0; row < weights.rows; row++) for (auto column = 0; column < weights.cols; column++) weights.at<double>(row, column) = values(random);
+	}
+
+	for (auto i = 0; i < 3; i++) { result->GetInputScale().at<double>(0, 2 * i) = 0.1; result->GetInputScale().at<double>(0, 2 * i + 1) = 0; }
+	result->GetOutputScale().at<double>(0, 0) = 1.0; result->GetOutputScale().at<double>(0, 1) = 0.0;
+
+	return result;
+}
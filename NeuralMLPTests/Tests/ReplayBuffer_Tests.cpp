@@ -0,0 +1,76 @@
+//--------------------------------------------------
+// Unit Tests for ReplayBuffer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/ReplayBuffer.h>
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the buffer stays at its capacity and keeps an even sample of a long run of rows
+ */
+TEST(ReplayBuffer_Test, keeps_an_even_sample)
+{
+	// Setup
+	auto buffer = NVL_AI::ReplayBuffer(100, 1, 1);
+	Mat inputs = Mat_<float>(1, 1); Mat outputs = Mat_<float>(1, 1);
+
+	// Execute
+	for (auto row = 0; row < 10000; row++)
+	{
+		inputs.at<float>(0) = (float) row; outputs.at<float>(0) = (float) -row;
+		buffer.Add(inputs, outputs, 1);
+	}
+
+	Mat sampleInputs = Mat_<float>(1000, 1); Mat sampleOutputs = Mat_<float>(1000, 1);
+	auto count = buffer.Sample(1000, sampleInputs, sampleOutputs, 0);
+
+	// Confirm: rows stay whole, and rows from across the run are kept (the mean of an even sample is near the middle)
+	ASSERT_EQ(buffer.GetSize(), 100); ASSERT_EQ(buffer.GetSeen(), 10000); ASSERT_EQ(count, 1000);
+
+	auto total = 0.0;
+	for (auto row = 0; row < count; row++)
+	{
+		ASSERT_EQ(sampleOutputs.at<float>(row), -sampleInputs.at<float>(row));
+		total += sampleInputs.at<float>(row);
+	}
+	ASSERT_NEAR(total / count, 5000, 1500);
+}
+
+/**
+ * @brief Confirm that samples fill the given part of a batch with rows that were added, and that an empty buffer gives none
+ */
+TEST(ReplayBuffer_Test, samples_into_batch)
+{
+	// Setup
+	Mat inputs = Mat_<float>(5, 2); Mat outputs = Mat_<float>(5, 1);
+	for (auto row = 0; row < 5; row++) { inputs.at<float>(row, 0) = (float) row; inputs.at<float>(row, 1) = (float) (row * 10); outputs.at<float>(row) = (float) (row * 100); }
+	auto data = NVL_AI::TrainData(inputs, outputs);
+	auto buffer = NVL_AI::ReplayBuffer(10, 2, 1);
+	auto empty = NVL_AI::ReplayBuffer(10, 2, 1);
+
+	Mat batchInputs = Mat_<float>(6, 2); batchInputs.setTo(-1); Mat batchOutputs = Mat_<float>(6, 1); batchOutputs.setTo(-1);
+
+	// Execute
+	buffer.Add(&data);
+	auto count = buffer.Sample(10, batchInputs, batchOutputs, 2);
+
+	// Confirm
+	ASSERT_EQ(buffer.GetSize(), 5); ASSERT_EQ(count, 4);
+	ASSERT_EQ(batchInputs.at<float>(1, 0), -1.0f); ASSERT_EQ(batchOutputs.at<float>(1), -1.0f);
+	for (auto row = 2; row < 6; row++)
+	{
+		auto value = batchInputs.at<float>(row, 0);
+		ASSERT_GE(value, 0.0f); ASSERT_LT(value, 5.0f);
+		ASSERT_EQ(batchInputs.at<float>(row, 1), value * 10); ASSERT_EQ(batchOutputs.at<float>(row), value * 100);
+	}
+	ASSERT_EQ(empty.Sample(3, batchInputs, batchOutputs, 0), 0);
+}
@@ -0,0 +1,107 @@
+//--------------------------------------------------
+// Unit Tests for Scorer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/Scorer.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateScoreData(int rows, Mat& predictions);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the metrics match a simple serial calculation
+ */
+TEST(Scorer_Test, metrics_match_reference)
+{
+	// Setup
+	Mat predictions; auto data = CreateScoreData(100, predictions);
+
+	// Find the expected values
+	auto& expected = data->GetOutputs(); auto mean = 0.0;
+	for (auto row = 0; row < expected.rows; row++) mean += expected.at<float>(row, 0);
+	mean /= expected.rows;
+
+	auto absError = 0.0; auto squaredError = 0.0; auto maxError = 0.0; auto totalSquares = 0.0;
+	for (auto row = 0; row < expected.rows; row++)
+	{
+		auto diff = abs((double)predictions.at<float>(row, 0) - expected.at<float>(row, 0));
+		absError += diff; squaredError += diff * diff; maxError = max(maxError, diff);
+		totalSquares += (expected.at<float>(row, 0) - mean) * (expected.at<float>(row, 0) - mean);
+	}
+
+	// Execute
+	auto scorer = NVL_AI::Scorer(data);
+	auto score = scorer.Evaluate(predictions);
+
+	// Confirm
+	ASSERT_NEAR(score.Total, absError, 1e-6);
+	ASSERT_NEAR(score.MAE, absError / 100, 1e-8);
+	ASSERT_NEAR(score.RMSE, sqrt(squaredError / 100), 1e-8);
+	ASSERT_NEAR(score.MaxError, maxError, 1e-8);
+	ASSERT_NEAR(score.R2, 1.0 - squaredError / totalSquares, 1e-8);
+
+	ASSERT_NEAR(NVL_AI::Scorer::GetLoss(score, "r2"), 1.0 - score.R2, 1e-12);
+	ASSERT_THROW(NVL_AI::Scorer::GetLoss(score, "unknown"), runtime_error);
+
+	// Teardown
+	delete data;
+}
+
+/**
+ * @brief Confirm that splitting the rows across threads gives the same score as a single thread
+ */
+TEST(Scorer_Test, threads_match_single)
+{
+	// Setup
+	Mat predictions; auto data = CreateScoreData(100000, predictions);
+
+	// Execute
+	auto single = NVL_AI::Scorer(data, 1).Evaluate(predictions);
+	auto threaded = NVL_AI::Scorer(data, 4).Evaluate(predictions);
+
+	// Confirm
+	ASSERT_NEAR(threaded.Total, single.Total, single.Total * 1e-12);
+	ASSERT_NEAR(threaded.RMSE, single.RMSE, single.RMSE * 1e-12);
+	ASSERT_EQ(threaded.MaxError, single.MaxError);
+	ASSERT_NEAR(threaded.R2, single.R2, 1e-12);
+
+	// Teardown
+	delete data;
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a dataset along with a set of noisy predictions for it
+ * @param rows The number of rows to create
+ * @param predictions The predictions that are created
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateScoreData(int rows, Mat& predictions)
+{
+	Mat inputs = Mat_<float>(rows, 1); randu(inputs, 0, 1);
+	Mat outputs = Mat_<float>(rows, 1); predictions = Mat_<float>(rows, 1);
+
+	for (auto row = 0; row < rows; row++)
+	{
+		auto value = inputs.at<float>(row, 0);
+		outputs.at<float>(row, 0) = value * 10;
+		predictions.at<float>(row, 0) = value * 10 + (row % 7) * 0.1f - 0.3f;
+	}
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
@@ -0,0 +1,105 @@
+//--------------------------------------------------
+// Unit Tests for ShardReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/ShardReader.h>
+#include <NeuralMLPLib/DatasetWriter.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+void WriteCountingDataset(const string& path, int rows);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that each pass hands over every row exactly once, in shards sized by the memory budget
+ */
+TEST(ShardReader_Test, epoch_covers_every_row)
+{
+	// Setup
+	WriteCountingDataset("shard_test.nmld", 1000);
+	auto reader = NVL_AI::ShardReader("shard_test.nmld", 4 * 100 * 3 * sizeof(float), 2);
+
+	// Execute
+	auto passes = vector<vector<int>>();
+	for (auto pass = 0; pass < 3; pass++)
+	{
+		auto starts = vector<int>(); auto seen = vector<int>(1000, 0);
+
+		reader.StartEpoch();
+		for (auto shard = reader.Next(); shard != nullptr; shard = reader.Next())
+		{
+			ASSERT_TRUE(shard->HasStats());
+			auto& inputs = shard->GetInputs(); starts.push_back((int) inputs.at<float>(0, 0));
+			for (auto row = 0; row < inputs.rows; row++)
+			{
+				auto value = (int) inputs.at<float>(row, 0); seen[value]++;
+				ASSERT_EQ(inputs.at<float>(row, 1), 2.0f * value); ASSERT_EQ(shard->GetOutputs().at<float>(row, 0), value + 0.5f);
+			}
+		}
+
+		for (auto count : seen) ASSERT_EQ(count, 1);
+		passes.push_back(starts);
+	}
+
+	// Confirm
+	ASSERT_EQ(reader.GetShardRows(), 100); ASSERT_EQ(reader.GetShardCount(), 10);
+	ASSERT_EQ(passes[0].size(), 10);
+	ASSERT_TRUE(passes[0] != passes[1] || passes[1] != passes[2]);
+
+	// Teardown
+	NVLib::FileUtils::Remove("shard_test.nmld");
+}
+
+/**
+ * @brief Confirm that the score sample is spread evenly across the dataset
+ */
+TEST(ShardReader_Test, sample_is_evenly_spaced)
+{
+	// Setup
+	WriteCountingDataset("shard_test.nmld", 1000);
+	auto reader = NVL_AI::ShardReader("shard_test.nmld", 1 << 20, 3);
+
+	// Execute
+	auto sample = reader.ReadSample(10);
+
+	// Confirm
+	ASSERT_EQ(sample->GetInputs().rows, 10);
+	for (auto row = 0; row < 10; row++) ASSERT_EQ(sample->GetInputs().at<float>(row, 0), row * 100.0f);
+	ASSERT_EQ(reader.GetShardCount(), 1);
+
+	// Teardown
+	delete sample;
+	NVLib::FileUtils::Remove("shard_test.nmld");
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Write a binary dataset whose rows are (i, 2i) -> i + 0.5, so that every row can be recognized
+ * @param path The path to the dataset
+ * @param rows The number of rows
+ */
+void WriteCountingDataset(const string& path, int rows)
+{
+	Mat inputs = Mat_<float>::zeros(rows, 2); Mat outputs = Mat_<float>::zeros(rows, 1);
+	for (auto row = 0; row < rows; row++) { inputs.at<float>(row, 0) = (float) row; inputs.at<float>(row, 1) = 2.0f * row; outputs.at<float>(row, 0) = row + 0.5f; }
+
+	auto writer = NVL_AI::DatasetWriter(path, "counting", "Counting rows", rows, 2, 1);
+	writer.WriteRows(inputs, outputs);
+	writer.Close();
+}
@@ -0,0 +1,111 @@
+//--------------------------------------------------
+// Unit Tests for Sweeper
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/Sweeper.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+NVL_AI::TrainData * CreateSweepData();
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that successive halving cuts the losing trial and trains the winner to its budget
+ */
+TEST(Sweeper_Test, halving_cuts_losers)
+{
+	// Setup
+	auto data = CreateSweepData();
+	auto settings = NVL_AI::SweepSettings();
+	settings.Base.Backend = "native"; settings.Base.Epochs = 5;
+	settings.Structures = NVL_AI::Sweeper::ParseList("2; 5");
+	settings.LearnRates = NVL_AI::Sweeper::ParseValues("0.1");
+	settings.Budgets = vector<int> { 9 };
+	settings.MinIterations = 1; settings.Eta = 2; settings.ThreadCount = 2;
+
+	// Execute
+	auto sweeper = NVL_AI::Sweeper(data, settings);
+	auto leaderboard = sweeper.Run();
+
+	// Confirm
+	ASSERT_EQ(leaderboard.size(), 2);
+	ASSERT_LE(leaderboard[0]->BestScore, leaderboard[1]->BestScore);
+	ASSERT_EQ(leaderboard[0]->Iterations, 9); ASSERT_EQ(leaderboard[0]->CutRung, -1);
+	ASSERT_TRUE(leaderboard[0]->BestModel != nullptr);
+	ASSERT_EQ(leaderboard[1]->Iterations, 1); ASSERT_EQ(leaderboard[1]->CutRung, 0);
+	ASSERT_TRUE(leaderboard[1]->BestModel == nullptr);
+
+	// Teardown
+	delete data;
+}
+
+/**
+ * @brief Confirm that a trial that was cut never leads the leaderboard, even when a duplicate grid point ties it
+ */
+TEST(Sweeper_Test, cut_trial_never_leads)
+{
+	// Setup
+	auto data = CreateSweepData();
+	auto settings = NVL_AI::SweepSettings();
+	settings.Base.Backend = "native"; settings.Base.Epochs = 1;
+	settings.Structures = NVL_AI::Sweeper::ParseList("3; 3");
+	settings.LearnRates = NVL_AI::Sweeper::ParseValues("0.1");
+	settings.Budgets = vector<int> { 1 };
+	settings.MinIterations = 1; settings.Eta = 2; settings.ThreadCount = 2;
+
+	// Execute
+	auto sweeper = NVL_AI::Sweeper(data, settings);
+	auto leaderboard = sweeper.Run();
+
+	// Confirm
+	ASSERT_EQ(sweeper.GetValidationData()->GetRowCount(), 13);
+	ASSERT_EQ(leaderboard.size(), 2);
+	ASSERT_TRUE(leaderboard[0]->BestModel != nullptr); ASSERT_EQ(leaderboard[0]->CutRung, -1);
+	ASSERT_TRUE(leaderboard[1]->BestModel == nullptr); ASSERT_EQ(leaderboard[1]->CutRung, 0);
+
+	// Teardown
+	delete data;
+}
+
+/**
+ * @brief Confirm that value lists and ranges are parsed
+ */
+TEST(Sweeper_Test, parse_values)
+{
+	auto list = NVL_AI::Sweeper::ParseValues("0.1;0.2");
+	ASSERT_EQ(list.size(), 2); ASSERT_EQ(list[1], 0.2);
+
+	auto range = NVL_AI::Sweeper::ParseValues("10:40:4");
+	ASSERT_EQ(range.size(), 4); ASSERT_EQ(range[0], 10); ASSERT_EQ(range[3], 40);
+
+	auto structures = NVL_AI::Sweeper::ParseList("60,60; 30");
+	ASSERT_EQ(structures.size(), 2); ASSERT_EQ(structures[0], "60,60"); ASSERT_EQ(structures[1], "30");
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Create a small dataset where the class is the product of the inputs
+ * @return NVL_AI::TrainData * The resultant data
+ */
+NVL_AI::TrainData * CreateSweepData()
+{
+	Mat inputs = Mat_<float>(64, 2); randu(inputs, -1, 1);
+	Mat outputs = Mat_<float>(64, 1);
+	for (auto row = 0; row < 64; row++) outputs.at<float>(row, 0) = inputs.at<float>(row, 0) * inputs.at<float>(row, 1);
+
+	return new NVL_AI::TrainData(inputs, outputs);
+}
@@ -0,0 +1,112 @@
+//--------------------------------------------------
+// Unit Tests for TrainingMetrics
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NVLib/FileUtils.h>
+
+#include <NeuralMLPLib/NetworkFactory.h>
+#include <NeuralMLPLib/TrainingMetrics.h>
+
+//--------------------------------------------------
+// Test Helpers
+//--------------------------------------------------
+
+vector<string> ReadMetricLines(const string& path);
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a JSON line is written for each iteration and the totals are exported for Prometheus
+ */
+TEST(TrainingMetrics_Test, json_lines_and_prometheus)
+{
+	// Setup
+	auto metrics = NVL_AI::IterationMetrics();
+	metrics.TrainSeconds = 0.5; metrics.ScoreSeconds = 0.25; metrics.Samples = 100;
+
+	// Execute
+	{
+		auto recorder = NVL_AI::TrainingMetrics("metrics_test.jsonl", "metrics_test.prom", 3600);
+		recorder.SetLoadSeconds(2);
+		for (auto i = 0; i < 3; i++) { metrics.Iteration = i; metrics.Score = 10 - i; recorder.Record(metrics); }
+		recorder.SetCheckpointStats(1, 0.125, 0.125);
+	}
+
+	// Confirm
+	auto lines = ReadMetricLines("metrics_test.jsonl");
+	ASSERT_EQ(lines.size(), 3);
+	ASSERT_EQ(lines[2].find("{\"iteration\":2,"), 0);
+	ASSERT_NE(lines[2].find("\"samples_per_second\":200"), string::npos);
+
+	auto exported = ReadMetricLines("metrics_test.prom");
+	ASSERT_NE(find(exported.begin(), exported.end(), "neuralmlp_iterations_total 3"), exported.end());
+	ASSERT_NE(find(exported.begin(), exported.end(), "neuralmlp_phase_seconds_total{phase=\"train\"} 1.5"), exported.end());
+	ASSERT_NE(find(exported.begin(), exported.end(), "neuralmlp_phase_seconds_total{phase=\"load\"} 2"), exported.end());
+	ASSERT_NE(find(exported.begin(), exported.end(), "neuralmlp_best_score 8"), exported.end());
+	ASSERT_NE(find(exported.begin(), exported.end(), "neuralmlp_checkpoint_writes_total 1"), exported.end());
+
+	// Teardown
+	NVLib::FileUtils::Remove("metrics_test.jsonl"); NVLib::FileUtils::Remove("metrics_test.prom");
+}
+
+/**
+ * @brief Confirm that a CSV path gets a header and a row for each iteration
+ */
+TEST(TrainingMetrics_Test, csv_output)
+{
+	// Execute
+	{
+		auto recorder = NVL_AI::TrainingMetrics("metrics_test.csv", "");
+		recorder.Record(NVL_AI::IterationMetrics());
+	}
+
+	// Confirm
+	auto lines = ReadMetricLines("metrics_test.csv");
+	ASSERT_EQ(lines.size(), 2);
+	ASSERT_EQ(lines[0].find("iteration,elapsed_seconds,"), 0);
+	ASSERT_EQ(lines[1].find("0,"), 0);
+	ASSERT_GT(NVL_AI::TrainingMetrics::GetPeakMemory(), 0);
+
+	// Teardown
+	NVLib::FileUtils::Remove("metrics_test.csv");
+}
+
+/**
+ * @brief Confirm that the OpenCV backend counts its epoch limit towards the samples per second, rather than one pass
+ */
+TEST(TrainingMetrics_Test, opencv_reports_epoch_limit)
+{
+	// Setup
+	auto settings = NVL_AI::NetworkSettings();
+	settings.Backend = "opencv"; settings.Structure = "4"; settings.Epochs = 120;
+
+	// Execute
+	auto network = NVL_AI::NetworkFactory::Create(settings, 2);
+
+	// Confirm
+	ASSERT_EQ(network->GetEpochs(), 120);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Read the lines of a text file
+ * @param path The path to the file
+ * @return vector<string> The resultant lines
+ */
+vector<string> ReadMetricLines(const string& path)
+{
+	auto reader = ifstream(path); auto result = vector<string>(); auto line = string();
+	while (getline(reader, line)) result.push_back(line);
+	return result;
+}
@@ -0,0 +1,56 @@
+//--------------------------------------------------
+// Unit Tests for WorkPool
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-17
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <NeuralMLPLib/WorkPool.h>
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that every task runs exactly once, including tasks of very different lengths
+ */
+TEST(WorkPool_Test, runs_every_task)
+{
+	// Setup
+	auto pool = NVL_AI::WorkPool(4);
+	auto counts = vector<atomic<int>>(100);
+
+	// Execute
+	for (auto i = 0; i < 100; i++) pool.Submit([&counts, i]()
+	{
+		if (i % 10 == 0) this_thread::sleep_for(chrono::milliseconds(5));
+		counts[i]++;
+	});
+	pool.Wait();
+
+	// Confirm
+	for (auto& count : counts) ASSERT_EQ(count, 1);
+}
+
+/**
+ * @brief Confirm that a failing task is reported by Wait and that the pool keeps working afterwards
+ */
+TEST(WorkPool_Test, wait_rethrows_failure)
+{
+	// Setup
+	auto pool = NVL_AI::WorkPool(2);
+	auto count = atomic<int>(0);
+
+	// Execute
+	pool.Submit([]() { throw runtime_error("Task failed"); });
+	pool.Submit([&count]() { count++; });
+
+	// Confirm
+	ASSERT_THROW(pool.Wait(), runtime_error);
+	pool.Submit([&count]() { count++; });
+	pool.Wait();
+	ASSERT_EQ(count, 2);
+}